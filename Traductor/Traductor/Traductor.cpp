@@ -14,6 +14,15 @@
 #include <filesystem>    // Para manipulacin de archivos y carpetas (C++17, fs::directory_iterator, fs::remove_all, etc.)
 #include <cstring>       // Para funciones de manejo de cadenas de bajo nivel (no se usa directamente, pero puede ser requerido)
 #include <limits>        // Para obtener valores lmite de tipos numricos (no se usa directamente, pero til en validaciones)
+#include <cstdint>       // Para enteros de tamao fijo (uint32_t, uint64_t) en los ndices del diccionario
+#include <string_view>   // Para comparar palabras sin copiarlas (string_view) en el ndice congelado
+#include <xmmintrin.h>   // Para la instruccin de prebsqueda en cach (_mm_prefetch)
+#include <emmintrin.h>   // Para comparar 16 bytes a la vez (SSE2) al leer el archivo de palabras
+#include <atomic>        // Para variables atmicas (atomic) en la lectura concurrente del diccionario
+#include <thread>        // Para crear hilos (thread) al medir la lectura concurrente
+#include <chrono>        // Para medir tiempos (steady_clock) al medir la lectura concurrente
+#include <cmath>         // Para calcular la tasa terica de falsos positivos del filtro de Bloom (exp, pow)
+#include <Psapi.h>       // Para obtener la memoria mxima del proceso (GetProcessMemoryInfo) en el benchmark
 
 
 // Uso del espacio de nombres estndar para evitar escribir std:: en todo el cdigo.
@@ -24,6 +33,19 @@ using namespace std;
 namespace fs = filesystem;
 
 
+// Instrumentacin del rbol AVL (ver `ContadoresAVL`): desactivada por defecto. Se activa compilando con
+// INSTRUMENTAR_AVL=1 (en Visual Studio, /D INSTRUMENTAR_AVL=1); desactivada, CONTAR_AVL(...) no genera cdigo.
+#ifndef INSTRUMENTAR_AVL
+#define INSTRUMENTAR_AVL 0
+#endif
+
+#if INSTRUMENTAR_AVL
+#define CONTAR_AVL(...) __VA_ARGS__
+#else
+#define CONTAR_AVL(...)
+#endif
+
+
 
 
 //==========================ESTRUCTURAS==========================
@@ -55,6 +77,48 @@ struct Palabra {
 
 
 
+// Estructura para ver una palabra y sus traducciones sin copiar las cadenas.
+// Cada campo apunta al texto ledo del archivo (o a las cadenas de un objeto `Palabra`).
+//
+// Campos:
+// - espanol, ingles, aleman, frances, italiano: Vistas de cada cadena.
+//
+// Uso:
+// - El lector del archivo de palabras (`separarArchivoPalabras`) entrega las palabras de esta forma,
+//   y el rbol se construye directamente a partir de ellas.
+// - Las vistas solo son vlidas mientras exista el texto al que apuntan.
+
+struct VistaPalabra {
+    string_view espanol;
+    string_view ingles;
+    string_view aleman;
+    string_view frances;
+    string_view italiano;
+};
+
+
+
+// Estructura para almacenar una palabra del diccionario de forma compacta.
+// En lugar de cadenas, cada campo guarda el identificador de la cadena en el pool de cadenas
+// (ver `internarCadena` y `cadenaDe`).
+//
+// Campos:
+// - espanol, ingles, aleman, frances, italiano: Identificadores de 32 bits de cada cadena.
+//
+// Uso:
+// - `Palabra` se sigue utilizando para leer y escribir palabras (archivo y consola);
+//   `PalabraInterna` es la forma en que se guardan dentro del diccionario.
+
+struct PalabraInterna {
+    uint32_t espanol;
+    uint32_t ingles;
+    uint32_t aleman;
+    uint32_t frances;
+    uint32_t italiano;
+};
+
+
+
 // Estructura para almacenar la informacin de un usuario registrado en el sistema.
 //
 // Campos:
@@ -73,28 +137,528 @@ struct Usuario {
 
 
 // Nodo del rbol Binario de Bsqueda (AVL) utilizado para almacenar palabras y sus traducciones.
+// El nodo es compacto: no guarda la palabra, sino su posicin en la tabla de palabras, y los hijos
+// se identifican con ndices de 32 bits dentro del pool de nodos en lugar de punteros.
 //
 // Campos:
-// - palabra: Objeto de tipo `Palabra` que contiene la palabra en espaol y sus traducciones.
-// - izquierda: Puntero al nodo hijo izquierdo.
-// - derecha: Puntero al nodo hijo derecho.
+// - prefijo: Primeros 8 bytes de la palabra en espaol empaquetados en un entero (ver `prefijoClave`).
+//   La mayora de las comparaciones se resuelven con este valor sin leer la palabra completa.
+// - izquierda: ndice del nodo hijo izquierdo (0 si no tiene).
+// - derecha: ndice del nodo hijo derecho (0 si no tiene).
+// - entrada: Posicin de la palabra y sus traducciones en `tablaPalabras`.
+// - tamano: Cantidad de nodos del subrbol que comienza en este nodo (incluido l mismo).
+//   Permite obtener la posicin alfabtica de una palabra y la palabra de una posicin en O(log n).
 // - altura: Altura del nodo en el rbol AVL (necesaria para mantener el balance del rbol).
 //
-// Constructor:
-// - Nodo(Palabra p): Inicializa un nodo con la palabra proporcionada y establece los punteros
-//   izquierdo y derecho en nullptr, y la altura en 1.
-//
 // Uso:
 // - Esta estructura se utiliza para construir el rbol AVL que almacena las palabras y sus traducciones.
 // - El rbol AVL permite realizar bsquedas, inserciones y eliminaciones de palabras de manera eficiente.
+// - El ndice 0 est reservado y representa un nodo nulo, por lo que `if (!nodo)` sigue siendo vlido.
+// - `tamano` y `altura` comparten 32 bits para que el nodo siga ocupando 24 bytes: cada rbol admite
+//   hasta 2^26 - 1 palabras (ms de 67 millones) y una altura de hasta 63.
 
 struct Nodo {
-    Palabra palabra;
-    Nodo* izquierda;
-    Nodo* derecha;
-    int altura;
+    uint64_t prefijo;
+    uint32_t izquierda;
+    uint32_t derecha;
+    uint32_t entrada;
+    uint32_t tamano : 26;
+    uint32_t altura : 6;
+};
+
+
+
+// Estructura para administrar la memoria de los nodos del rbol AVL mediante bloques (arena).
+// En lugar de pedir cada nodo por separado al heap, se reservan bloques grandes de nodos
+// contiguos y se reparten uno por uno.
+//
+// Campos:
+// - bloques: Bloques de memoria reservados, cada uno con espacio para NODOS_POR_BLOQUE nodos.
+// - usadosUltimoBloque: Cantidad de nodos ya entregados del ltimo bloque reservado.
+// - libres: Primer nodo de la lista de nodos liberados (enlazados a travs del campo `izquierda`).
+// - vivos: Cantidad de nodos actualmente en uso.
+//
+// Uso:
+// - Los nodos se crean con `crearNodo` y se liberan con `destruirNodo`.
+// - El ndice de un nodo es `bloque * NODOS_POR_BLOQUE + posicin`; `nodoEn` lo convierte en referencia.
+// - Al salir del programa, `liberarPoolNodos` libera todos los bloques de una sola vez.
+
+struct PoolNodos {
+    static const uint32_t BITS_POR_BLOQUE = 12;
+    static const uint32_t NODOS_POR_BLOQUE = 1u << BITS_POR_BLOQUE;
+
+    vector<Nodo*> bloques;
+    uint32_t usadosUltimoBloque = NODOS_POR_BLOQUE;
+    uint32_t libres = 0;
+    size_t vivos = 0;
+};
+
+
+// Pool global del que se obtienen todos los nodos del rbol AVL.
+PoolNodos poolNodos;
+
+
+
+// Estructura para almacenar las palabras y sus traducciones fuera de los nodos del rbol.
+//
+// Campos:
+// - palabras: Palabras almacenadas; la posicin de cada una es la `entrada` de su nodo.
+// - libres: Posiciones de palabras eliminadas que pueden reutilizarse.
+//
+// Uso:
+// - Separar las traducciones del rbol permite que los nodos sean pequeos y que el recorrido
+//   del rbol solo toque la memoria de los nodos.
+
+struct TablaPalabras {
+    vector<PalabraInterna> palabras;
+    vector<uint32_t> libres;
+};
+
+
+// Tabla global con las palabras referenciadas por los nodos del rbol AVL.
+TablaPalabras tablaPalabras;
+
+
+
+// Estructura para almacenar todas las cadenas del diccionario una sola vez (pool de cadenas).
+// Las cadenas se escriben una detrs de otra en un nico bloque de texto y las repetidas se
+// reutilizan: si "hotel" aparece en ingls, francs e italiano, se guarda una sola vez.
+//
+// Campos:
+// - texto: Bloque con todas las cadenas; cada una va precedida de su longitud
+//   (1 byte, o 0xFF seguido de 4 bytes si mide 255 o ms).
+// - tabla: Tabla hash de direccionamiento abierto con los identificadores de las cadenas guardadas,
+//   utilizada para encontrar una cadena repetida sin volver a guardarla.
+// - ocupados: Cantidad de posiciones usadas en `tabla`.
+//
+// Notas:
+// - El identificador de una cadena es su posicin dentro de `texto`, por lo que sigue siendo vlido
+//   aunque el bloque crezca.
+// - Las cadenas no se eliminan individualmente; el pool se vaca por completo con `liberarPoolNodos`.
+
+struct PoolCadenas {
+    static constexpr uint32_t SIN_CADENA = 0xFFFFFFFFu;
+
+    string texto;
+    vector<uint32_t> tabla;
+    size_t ocupados = 0;
+};
+
+
+// Pool global con las cadenas de todas las palabras del diccionario.
+PoolCadenas poolCadenas;
+
+
+
+// Idiomas de traduccin que cuentan con un ndice inverso (rbol AVL ordenado por esa traduccin).
+// El valor de cada idioma es su posicin en `raicesInversas`.
+
+enum Idioma {
+    IDIOMA_INGLES,
+    IDIOMA_ALEMAN,
+    IDIOMA_FRANCES,
+    IDIOMA_ITALIANO,
+    CANTIDAD_IDIOMAS
+};
+
+
+// Races de los ndices inversos, una por idioma de traduccin (0 si el ndice est vaco).
+uint32_t raicesInversas[CANTIDAD_IDIOMAS] = {};
+
+
+
+// Estructura con la columna de traducciones de un idioma (`columna_<idioma>.umg`) mapeada en memoria.
+//
+// Campos:
+// - archivo, mapeo: Manejadores de Windows del archivo y de su mapeo.
+// - datos: Inicio del archivo mapeado (nullptr si la columna no est mapeada).
+// - ids: Posicin dentro de `texto` de la traduccin de cada fila (palabra) del diccionario binario.
+// - texto: Traducciones, con el mismo formato que `poolCadenas.texto`.
+// - cantidad: Cantidad de filas.
+
+struct ColumnaMapeada {
+    HANDLE archivo = INVALID_HANDLE_VALUE;
+    HANDLE mapeo = nullptr;
+    const char* datos = nullptr;
+    const uint32_t* ids = nullptr;
+    const char* texto = nullptr;
+    size_t cantidad = 0;
+};
+
+
+
+// Estructura con las traducciones de un idioma comprimidas en memoria con un cdigo de Huffman propio
+// del idioma (ver `comprimirColumna`).
+//
+// Campos:
+// - PALABRAS_POR_BLOQUE: Cantidad de traducciones seguidas que comparten una posicin de inicio.
+// - BITS_TABLA: Bits que se decodifican de una vez con `tabla`.
+// - arbol: rbol de Huffman aplanado: los hijos del nodo k estn en las posiciones 2k (bit 0) y 2k + 1 (bit 1).
+//   Un valor negativo es una hoja con el carcter -(valor + 1); la raz es el nodo 0.
+// - tabla: Para cada valor de los prximos BITS_TABLA bits, `largo << 24 | carcter` si el cdigo mide como
+//   mximo BITS_TABLA bits, o el nodo del rbol al que se llega despus de leerlos (con largo 0).
+// - bits: Traducciones codificadas una detrs de otra, cada una terminada con el carcter '\0' (el primer bit
+//   de la columna es el menos significativo de `bits[0]`).
+// - inicios: Bit donde comienza cada bloque de PALABRAS_POR_BLOQUE posiciones de `tablaPalabras`.
+// - cantidad: Cantidad de posiciones comprimidas (0 si el idioma no est comprimido).
+//
+// Notas:
+// - Guardar un inicio por bloque (y no uno por palabra) cuesta 2 bits por palabra en lugar de 32; para leer
+//   una traduccin se saltan las anteriores de su bloque.
+// - Las posiciones comprimidas tienen la traduccin `PoolCadenas::SIN_CADENA` en `tablaPalabras`. Las palabras
+//   agregadas despus tienen su traduccin en el pool de cadenas, aunque reutilicen una posicin comprimida.
+// - Experimental: solo se usa desde la medicin de rendimiento (ver `comprimirTraducciones`).
+
+struct ColumnaComprimida {
+    static const uint32_t PALABRAS_POR_BLOQUE = 16;
+    static const uint32_t BITS_TABLA = 10;
+
+    vector<int32_t> arbol;
+    vector<uint32_t> tabla;
+    vector<uint64_t> bits;
+    vector<uint32_t> inicios;
+    size_t cantidad = 0;
+};
+
+
+
+// Estructura con el estado de las traducciones de cada idioma, que se guardan y se cargan por columnas.
+// Al abrir el diccionario binario solo se cargan las palabras en espaol; las traducciones de un idioma
+// se leen de su archivo de columna la primera vez que se necesitan (ver `cargarColumna`).
+//
+// Campos:
+// - MINUTOS_FRIO: Minutos sin usar un idioma para considerarlo fro.
+// - CARGA_MEMORIA_ALTA: Porcentaje de memoria fsica en uso a partir del cual se liberan los idiomas fros.
+// - rutas: Archivo de columna de cada idioma.
+// - cargada: Indica si las traducciones del idioma ya estn en `tablaPalabras` (y en el pool de cadenas).
+// - indexada: Indica si el ndice inverso del idioma est construido.
+// - pendientes: Las primeras `pendientes` posiciones de `tablaPalabras` son las filas del diccionario binario;
+//   mientras un idioma no est cargado, su traduccin en ellas vale `PoolCadenas::SIN_CADENA`.
+// - sumaDiccionario: Suma de verificacin del diccionario binario al que deben pertenecer las columnas.
+// - mapeadas: Columnas abiertas con `abrirColumna`.
+// - comprimidas: Traducciones comprimidas en memoria con `comprimirColumna`; un idioma comprimido no est
+//   cargado, y `cargarColumna` lo descomprime en el pool de cadenas.
+// - ultimoUso: ltimo momento en que se us cada idioma.
+//
+// Notas:
+// - Las palabras agregadas durante la sesin siempre tienen sus cuatro traducciones.
+// - Al cargar desde `palabras.umg` todas las traducciones quedan cargadas; solo los ndices inversos
+//   se construyen cuando se usan.
+// - Las columnas, igual que el diccionario binario, estn en `C:\\traductorbinario`, fuera de la carpeta que
+//   se comprime al salir, para poder mapearlas al iniciar sin descomprimirlas.
+
+struct ColumnasIdiomas {
+    static constexpr int MINUTOS_FRIO = 10;
+    static constexpr DWORD CARGA_MEMORIA_ALTA = 90;
+
+    string rutas[CANTIDAD_IDIOMAS] = {
+        "C:\\traductorbinario\\columna_ingles.umg",
+        "C:\\traductorbinario\\columna_aleman.umg",
+        "C:\\traductorbinario\\columna_frances.umg",
+        "C:\\traductorbinario\\columna_italiano.umg"
+    };
+    bool cargada[CANTIDAD_IDIOMAS] = { true, true, true, true }; // Un diccionario vaco no tiene traducciones pendientes.
+    bool indexada[CANTIDAD_IDIOMAS] = {};
+    size_t pendientes = 0;
+    uint64_t sumaDiccionario = 0;
+
+    ColumnaMapeada mapeadas[CANTIDAD_IDIOMAS];
+    ColumnaComprimida comprimidas[CANTIDAD_IDIOMAS];
+    chrono::steady_clock::time_point ultimoUso[CANTIDAD_IDIOMAS];
+};
+
+
+// Estado global de las columnas de traduccin.
+ColumnasIdiomas columnasIdiomas;
+
+
+
+// Estructura del autmata de Aho-Corasick con las palabras en espaol, usado para traducir textos completos.
+//
+// Campos:
+// - SIN_ENTRADA: Marca de los estados donde no termina ninguna palabra.
+// - inicioHijos: Las aristas del estado s son las posiciones [inicioHijos[s], inicioHijos[s + 1]) de
+//   `letras` y `destinos`, ordenadas por letra.
+// - letras, destinos: Letra y estado de llegada de cada arista.
+// - entradas: Posicin en `tablaPalabras` de la palabra que termina en cada estado, o SIN_ENTRADA.
+// - largos: Cantidad de letras de cada estado (su profundidad en el trie).
+// - falla: Estado del sufijo propio ms largo de cada estado que tambin est en el autmata y que
+//   comienza al inicio de una palabra (las coincidencias no pueden comenzar en medio de una palabra).
+// - salida: Estado ms cercano en la cadena de fallas donde termina una palabra (0 si no hay).
+// - vigente: Indica si el autmata corresponde al diccionario actual.
+//
+// Notas:
+// - Se construye la primera vez que se traduce un texto (ver `traducirTexto`) y se marca como
+//   desactualizado cada vez que se agrega o elimina una palabra; se reconstruye al volver a usarlo.
+
+struct AutomataFrases {
+    static constexpr uint32_t SIN_ENTRADA = 0xFFFFFFFFu;
+
+    vector<uint32_t> inicioHijos;
+    vector<unsigned char> letras;
+    vector<uint32_t> destinos;
+    vector<uint32_t> entradas;
+    vector<uint32_t> largos;
+    vector<uint32_t> falla;
+    vector<uint32_t> salida;
+    bool vigente = false;
+};
+
+
+// Autmata global para la traduccin de textos.
+AutomataFrases automataFrases;
+
+
+
+// Estructura de una ranura de la cach de bsquedas.
+//
+// Campos:
+// - clave: Palabra buscada.
+// - entrada: Posicin de la palabra en `tablaPalabras`, o CacheBusquedas::SIN_ENTRADA si no existe.
+// - referenciada: Bit de referencia del algoritmo CLOCK (se marca en cada acierto).
+
+struct RanuraCache {
+    string clave;
+    uint32_t entrada;
+    bool referenciada;
+};
+
+
+
+// Estructura de la cach de bsquedas frecuentes, delante del ndice congelado (ver `buscarConCache`).
+//
+// Campos:
+// - CAPACIDAD: Cantidad mxima de palabras guardadas.
+// - SIN_ENTRADA: Marca de las palabras buscadas que no existen.
+// - ranuras: Palabras guardadas; su orden es el recorrido de la manecilla.
+// - posiciones: Palabra -> ranura.
+// - libres: Ranuras liberadas por `olvidarEnCache`.
+// - manecilla: Prxima ranura que revisa el algoritmo CLOCK al desalojar.
+// - porCalentar: Palabras ms buscadas por el usuario, pendientes de cargar (ver `calentarCache`).
+// - aciertos, fallos, nanosAciertos, nanosFallos: Cantidad y duracin total de las bsquedas.
+// - desalojos, invalidaciones: Palabras quitadas por falta de lugar y por cambios en el diccionario.
+//
+// Notas:
+// - Las bsquedas se concentran en unos pocos cientos de palabras por usuario; CLOCK las mantiene
+//   con un solo bit por ranura y sin mover nada en cada acierto.
+
+struct CacheBusquedas {
+    static const size_t CAPACIDAD = 1024;
+    static constexpr uint32_t SIN_ENTRADA = 0xFFFFFFFFu;
+
+    vector<RanuraCache> ranuras;
+    unordered_map<string, uint32_t> posiciones;
+    vector<uint32_t> libres;
+    size_t manecilla = 0;
+    vector<string> porCalentar;
+
+    uint64_t aciertos = 0;
+    uint64_t fallos = 0;
+    uint64_t nanosAciertos = 0;
+    uint64_t nanosFallos = 0;
+    uint64_t desalojos = 0;
+    uint64_t invalidaciones = 0;
+};
+
+
+// Cach global de bsquedas.
+CacheBusquedas cacheBusquedas;
+
+
+
+// Estructura del ndice ponderado: un rbol de bsqueda armado segn las palabras que ms busca el
+// usuario, para que las frecuentes queden cerca de la raz (ver `construirIndicePonderado`).
+//
+// Campos:
+// - BUSQUEDAS_POR_RECONSTRUCCION: Bsquedas nuevas despus de las cuales se vuelve a leer el historial.
+// - prefijos: Prefijo de cada palabra (ver `prefijoClave`).
+// - cargas: Posicin de cada palabra en `tablaPalabras`.
+// - izquierda, derecha: Posicin de los hijos de cada palabra, o 0 si no tiene.
+// - vigente: Indica si el ndice corresponde al diccionario actual; si no, se busca en el ndice congelado.
+// - busquedas: Bsquedas registradas desde la ltima construccin.
+//
+// Notas:
+// - Las palabras se guardan en preorden: el hijo izquierdo suele ser la posicin siguiente, y las
+//   palabras ms buscadas quedan juntas al comienzo de los arreglos.
+// - La posicin 0 no se utiliza; la raz est en la posicin 1.
+
+struct IndicePonderado {
+    static const size_t BUSQUEDAS_POR_RECONSTRUCCION = 128;
+
+    vector<uint64_t> prefijos;
+    vector<uint32_t> cargas;
+    vector<uint32_t> izquierda;
+    vector<uint32_t> derecha;
+    bool vigente = false;
+    size_t busquedas = 0;
+};
+
+
+// ndice ponderado global del usuario actual.
+IndicePonderado indicePonderado;
+
+
+
+// Estructura del ndice de claves normalizadas (sin maysculas ni acentos), con el que una bsqueda
+// como "cancion" encuentra "Cancin" (ver `buscarNormalizada`).
+//
+// Campos:
+// - SIN_ENTRADA: Marca de posicin vaca en `tabla` y de fin de lista en `siguientes`.
+// - IGUAL_A_ORIGINAL: Valor de `claves` para las palabras cuya clave normalizada es la misma palabra.
+// - claves: Para cada posicin de `tablaPalabras`, la posicin de su clave normalizada dentro de
+//   `texto`, o IGUAL_A_ORIGINAL.
+// - texto: Claves normalizadas distintas de su palabra, con el mismo formato que el pool de cadenas
+//   (se leen con `cadenaEn`).
+// - tabla: Tabla hash con direccionamiento abierto; cada posicin guarda la primera palabra de una
+//   clave normalizada.
+// - siguientes: Para cada posicin de `tablaPalabras`, la siguiente palabra con la misma clave
+//   normalizada ("papa" y "pap").
+// - vigente: Indica si el ndice corresponde al diccionario actual.
+//
+// Notas:
+// - La mayora de las palabras ya estn en minsculas y sin acentos, por lo que solo se guarda aparte
+//   la clave de las dems.
+// - Las claves tienen su propio bloque de texto: el pool de cadenas puede compactarse y cambiar sus
+//   identificadores (ver `compactarPoolCadenas`).
+
+struct IndiceNormalizado {
+    static constexpr uint32_t SIN_ENTRADA = 0xFFFFFFFFu;
+    static constexpr uint32_t IGUAL_A_ORIGINAL = 0xFFFFFFFFu;
+
+    vector<uint32_t> claves;
+    string texto;
+    vector<uint32_t> tabla;
+    vector<uint32_t> siguientes;
+    bool vigente = false;
+};
+
+
+// ndice de claves normalizadas global.
+IndiceNormalizado indiceNormalizado;
+
+
+
+// Estructura del filtro de Bloom de las palabras en espaol, consultado antes de recorrer el rbol
+// para descartar rpido las palabras que no existen (ver `filtroPuedeContener`).
+//
+// Campos:
+// - BITS_POR_CLAVE: Bits por palabra predeterminados (unos 1 % de falsos positivos).
+// - PALABRAS_POR_BLOQUE: Enteros de 64 bits por bloque; un bloque (512 bits) ocupa una lnea de cach.
+// - bitsPorClave: Bits por palabra con los que se dimensiona el filtro (ver `configurarFiltro`).
+// - funciones: Bits que se marcan por palabra dentro de su bloque.
+// - bloques: Bits del filtro.
+// - capacidad: Palabras que admite el filtro sin superar `bitsPorClave`.
+// - claves: Palabras agregadas desde la ltima construccin.
+// - eliminadas: Palabras eliminadas desde la ltima construccin; sus bits siguen marcados.
+//
+// Notas:
+// - Un filtro vaco deja pasar todas las palabras.
+// - Un filtro de Bloom no puede quitar palabras: las eliminadas solo aumentan los falsos positivos
+//   hasta que el filtro se reconstruye (ver `anotarClaveEliminada`). Nunca da falsos negativos.
+
+struct FiltroBloom {
+    static const uint32_t BITS_POR_CLAVE = 10;
+    static const size_t PALABRAS_POR_BLOQUE = 8;
+
+    uint32_t bitsPorClave = BITS_POR_CLAVE;
+    uint32_t funciones = 0;
+    vector<uint64_t> bloques;
+    size_t capacidad = 0;
+    size_t claves = 0;
+    size_t eliminadas = 0;
+};
+
+
+// Filtro de Bloom global de las palabras de `tablaPalabras`.
+FiltroBloom filtroBloom;
+
+
+
+#if INSTRUMENTAR_AVL
+// Estructura con los contadores de la instrumentacin del rbol AVL (solo con INSTRUMENTAR_AVL=1).
+//
+// Campos:
+// - busquedas, descartadasPorFiltro: Llamadas a `buscar` y cuntas resolvi el filtro de Bloom sin recorrer el rbol.
+// - comparacionesBusqueda, profundidadMaximaBusqueda: Nodos comparados en total y en la bsqueda ms larga.
+// - inserciones, repetidas, comparacionesInsercion: Llamadas a `insertar` que agregaron una palabra, que la
+//   encontraron repetida, y nodos comparados al descender.
+// - eliminaciones, noEncontradas, comparacionesEliminacion: Lo mismo para `eliminarPalabra` (las comparaciones
+//   incluyen la eliminacin del sucesor).
+// - rotacionesDerecha, rotacionesIzquierda: Rotaciones simples (una rotacin doble cuenta una de cada una)
+//   en los rboles AVL principal e inversos; el benchmark las lee con `rotacionesContadas`.
+//
+// Notas:
+// - Los contadores no son atmicos: con la lectura concurrente, solo el escritor los modifica de forma exacta.
+//   Las rotaciones s lo son, porque las operaciones masivas (ver `aplicarOperacionMasiva`) rotan desde varios hilos.
+
+struct ContadoresAVL {
+    uint64_t busquedas = 0;
+    uint64_t descartadasPorFiltro = 0;
+    uint64_t comparacionesBusqueda = 0;
+    uint64_t profundidadMaximaBusqueda = 0;
+    uint64_t inserciones = 0;
+    uint64_t repetidas = 0;
+    uint64_t comparacionesInsercion = 0;
+    uint64_t eliminaciones = 0;
+    uint64_t noEncontradas = 0;
+    uint64_t comparacionesEliminacion = 0;
+    atomic<uint64_t> rotacionesDerecha{ 0 };
+    atomic<uint64_t> rotacionesIzquierda{ 0 };
+};
+
+
+// Contadores globales de la instrumentacin del rbol AVL.
+ContadoresAVL contadoresAVL;
+#endif
+
+
+
+// Funcin para obtener la cantidad de rotaciones contadas por la instrumentacin del rbol AVL.
+//
+// Retorno:
+// - La suma de `rotacionesDerecha` y `rotacionesIzquierda`, o 0 si el programa no se compil con
+//   INSTRUMENTAR_AVL=1.
+
+inline uint64_t rotacionesContadas() {
+#if INSTRUMENTAR_AVL
+    return contadoresAVL.rotacionesDerecha + contadoresAVL.rotacionesIzquierda;
+#else
+    return 0;
+#endif
+}
+
+
+
+// Estructura con el resultado de la validacin de un rbol AVL (ver `validarArbol`).
+//
+// Campos:
+// - nodos: Cantidad de nodos recorridos.
+// - altura: Altura real del rbol (calculada, no la guardada).
+// - sumaProfundidades: Suma de la profundidad de cada nodo (la raz tiene profundidad 1).
+// - errores: Cantidad de invariantes que no se cumplen.
+// - primerError: Descripcin del primer error encontrado.
+
+struct ResumenArbol {
+    size_t nodos = 0;
+    int altura = 0;
+    uint64_t sumaProfundidades = 0;
+    size_t errores = 0;
+    string primerError;
+};
 
-    Nodo(Palabra p) : palabra(p), izquierda(nullptr), derecha(nullptr), altura(1) {}
+
+
+// Operaciones masivas entre el diccionario y una lista de palabras (ver `aplicarOperacionMasiva`).
+//
+// Valores:
+// - OPERACION_UNION: Agrega las palabras de la lista que no estn en el diccionario.
+// - OPERACION_DIFERENCIA: Elimina del diccionario las palabras de la lista.
+// - OPERACION_INTERSECCION: Conserva solo las palabras del diccionario que estn en la lista.
+
+enum OperacionMasiva {
+    OPERACION_UNION,
+    OPERACION_DIFERENCIA,
+    OPERACION_INTERSECCION
 };
 
 
@@ -313,1245 +877,9837 @@ string deshacerXOR(const string& texto, const string& llave) {
 
 
 
-//===========================FUNCIONES DEL RBOL AVL==========================
+//==========================FUNCIONES DEL POOL DE CADENAS==========================
 
 
 
-// Funcin para obtener la altura de un nodo en el rbol AVL.
+// Funcin para calcular el hash de una cadena (FNV-1a de 32 bits).
 //
 // Parmetros:
-// - nodo: Puntero al nodo del cual se desea obtener la altura.
+// - cadena: Cadena de la que se desea calcular el hash.
 //
 // Retorno:
-// - Un entero que representa la altura del nodo.
-//   - Si el nodo es nulo, retorna 0 (altura de un rbol vaco).
-//   - Si el nodo no es nulo, retorna el valor almacenado en el campo `altura`.
-//
-// Notas:
-// - La altura de un nodo es la longitud del camino ms largo desde ese nodo hasta una hoja.
-// - Esta funcin es utilizada para calcular el balance de los nodos y mantener el rbol AVL balanceado.
+// - Un entero de 32 bits con el hash de la cadena.
 
-int altura(Nodo* nodo) {
-    if (!nodo) return 0; // Caso base: un nodo nulo tiene altura 0.
-    return nodo->altura; // Retornar la altura almacenada en el nodo.
+uint32_t hashCadena(string_view cadena) {
+    uint32_t hash = 2166136261u;
+    for (char c : cadena) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 16777619u;
+    }
+    return hash;
 }
 
 
 
-// Funcin para calcular el factor de balance de un nodo en el rbol AVL.
+// Funcin para obtener una cadena a partir de su identificador dentro de un bloque de texto dado.
 //
 // Parmetros:
-// - nodo: Puntero al nodo del cual se desea calcular el factor de balance.
+// - texto: Inicio del bloque de texto del pool (normalmente `poolCadenas.texto.data()`).
+// - id: Identificador de la cadena devuelto por `internarCadena`.
 //
 // Retorno:
-// - Un entero que representa el factor de balance del nodo.
-//   - Si el nodo es nulo, retorna 0.
-//   - Si el nodo no es nulo, retorna la diferencia entre la altura del subrbol izquierdo
-//     y la altura del subrbol derecho.
+// - Una vista (string_view) de la cadena dentro del bloque.
 //
 // Notas:
-// - El factor de balance se utiliza para determinar si un nodo est balanceado:
-//   - Un nodo est balanceado si el factor de balance est en el rango [-1, 1].
-//   - Si el factor de balance es menor que -1 o mayor que 1, el rbol necesita ser re-balanceado.
-// - Esta funcin es clave para mantener las propiedades del rbol AVL.
+// - Los lectores concurrentes la utilizan con el bloque de su instantnea, que puede ser
+//   anterior al bloque actual del pool (ver `Instantanea`).
+
+inline string_view cadenaEn(const char* texto, uint32_t id) {
+    const unsigned char* datos = reinterpret_cast<const unsigned char*>(texto) + id;
+    size_t largo = datos[0];
+    size_t inicio = 1;
+
+    // Longitudes de 255 o ms se guardan en los 4 bytes siguientes.
+    if (largo == 0xFF) {
+        uint32_t largoExtendido;
+        memcpy(&largoExtendido, datos + 1, sizeof(uint32_t));
+        largo = largoExtendido;
+        inicio = 5;
+    }
 
-int factorBalance(Nodo* nodo) {
-    if (!nodo) return 0; // Caso base: un nodo nulo tiene factor de balance 0.
-    return altura(nodo->izquierda) - altura(nodo->derecha); // Diferencia de alturas.
+    return string_view(reinterpret_cast<const char*>(datos + inicio), largo);
 }
 
 
 
-// Funcin para actualizar la altura de un nodo en el rbol AVL.
+// Funcin para obtener una cadena del pool a partir de su identificador.
 //
 // Parmetros:
-// - nodo: Puntero al nodo cuya altura se desea actualizar.
+// - id: Identificador de la cadena devuelto por `internarCadena`.
 //
-// Proceso:
-// 1. Verifica si el nodo es nulo. Si lo es, no realiza ninguna accin.
-// 2. Calcula la nueva altura del nodo como:
-//    - 1 + la altura mxima entre el subrbol izquierdo y el subrbol derecho.
-// 3. Asigna el valor calculado al campo `altura` del nodo.
+// Retorno:
+// - Una vista (string_view) de la cadena dentro del pool.
 //
 // Notas:
-// - Esta funcin debe ser llamada despus de realizar operaciones que puedan modificar
-//   la estructura del rbol, como inserciones, eliminaciones o rotaciones.
-// - Mantener actualizada la altura de los nodos es esencial para calcular el factor de balance
-//   y garantizar que el rbol AVL permanezca balanceado.
+// - La vista deja de ser vlida si se agregan cadenas nuevas al pool (el bloque puede moverse),
+//   por lo que no debe guardarse; se debe conservar el identificador.
+
+string_view cadenaDe(uint32_t id) {
+    return cadenaEn(poolCadenas.texto.data(), id);
+}
+
 
-void actualizarAltura(Nodo* nodo) {
-    if (!nodo) return; // Caso base: si el nodo es nulo, no hace nada.
 
-    // Calcular la nueva altura del nodo.
-    nodo->altura = 1 + max(altura(nodo->izquierda), altura(nodo->derecha));
+// Funcin para duplicar el tamao de la tabla hash del pool de cadenas.
+//
+// Proceso:
+// 1. Crea una tabla vaca con el doble de posiciones (como mnimo 1024).
+// 2. Vuelve a ubicar cada identificador segn el hash de su cadena.
+
+void agrandarTablaCadenas() {
+    vector<uint32_t> anterior;
+    anterior.swap(poolCadenas.tabla);
+
+    size_t tamano = anterior.empty() ? 1024 : anterior.size() * 2;
+    poolCadenas.tabla.assign(tamano, PoolCadenas::SIN_CADENA);
+    size_t mascara = tamano - 1;
+
+    for (uint32_t id : anterior) {
+        if (id == PoolCadenas::SIN_CADENA) continue;
+        size_t pos = hashCadena(cadenaDe(id)) & mascara;
+        while (poolCadenas.tabla[pos] != PoolCadenas::SIN_CADENA) {
+            pos = (pos + 1) & mascara;
+        }
+        poolCadenas.tabla[pos] = id;
+    }
 }
 
 
 
-// Funcin para realizar una rotacin a la derecha en un rbol AVL.
+// Funcin para guardar una cadena en el pool, reutilizndola si ya existe.
 //
 // Parmetros:
-// - y: Puntero al nodo que ser rotado hacia la derecha.
+// - cadena: Cadena que se desea guardar.
 //
 // Retorno:
-// - Un puntero al nuevo nodo raz despus de la rotacin.
+// - El identificador de la cadena dentro del pool.
 //
 // Proceso:
-// 1. Identifica el nodo izquierdo (`x`) como el nuevo nodo raz.
-// 2. Almacena el subrbol derecho de `x` (denominado `T2`) temporalmente.
-// 3. Realiza la rotacin:
-//    - El nodo `x` se convierte en la nueva raz.
-//    - El nodo `y` pasa a ser el hijo derecho de `x`.
-//    - El subrbol `T2` se asigna como el hijo izquierdo de `y`.
-// 4. Actualiza las alturas de los nodos afectados (`y` y `x`).
+// 1. Si la tabla hash est ocupada a la mitad, la agranda.
+// 2. Busca la cadena en la tabla (sondeo lineal). Si ya existe, retorna su identificador.
+// 3. Si no existe, escribe la longitud y el contenido al final de `texto` y registra
+//    el nuevo identificador en la tabla.
 //
 // Notas:
-// - Esta operacin se utiliza para re-balancear el rbol AVL cuando el subrbol izquierdo
-//   de un nodo est desbalanceado (caso de rotacin simple derecha).
-// - Mantiene las propiedades del rbol AVL (balance y orden).
+// - Dos palabras con la misma traduccin comparten la misma cadena en memoria.
 
-Nodo* rotarDerecha(Nodo* y) {
-    Nodo* x = y->izquierda; // El nuevo nodo raz ser el hijo izquierdo.
-    Nodo* T2 = x->derecha;  // Almacena temporalmente el subrbol derecho de `x`.
+uint32_t internarCadena(string_view cadena) {
+    if ((poolCadenas.ocupados + 1) * 2 > poolCadenas.tabla.size()) {
+        agrandarTablaCadenas();
+    }
 
-    // Realizar la rotacin.
-    x->derecha = y;
-    y->izquierda = T2;
+    // Buscar si la cadena ya est guardada.
+    size_t mascara = poolCadenas.tabla.size() - 1;
+    size_t pos = hashCadena(cadena) & mascara;
+    while (poolCadenas.tabla[pos] != PoolCadenas::SIN_CADENA) {
+        if (cadenaDe(poolCadenas.tabla[pos]) == cadena) {
+            return poolCadenas.tabla[pos];
+        }
+        pos = (pos + 1) & mascara;
+    }
 
-    // Actualizar las alturas de los nodos afectados.
-    actualizarAltura(y);
-    actualizarAltura(x);
+    // Escribir la cadena nueva al final del bloque de texto.
+    uint32_t id = static_cast<uint32_t>(poolCadenas.texto.size());
+    if (cadena.size() < 0xFF) {
+        poolCadenas.texto += static_cast<char>(cadena.size());
+    }
+    else {
+        uint32_t largo = static_cast<uint32_t>(cadena.size());
+        poolCadenas.texto += static_cast<char>(0xFF);
+        poolCadenas.texto.append(reinterpret_cast<const char*>(&largo), sizeof(uint32_t));
+    }
+    poolCadenas.texto.append(cadena.data(), cadena.size());
 
-    // Retornar el nuevo nodo raz.
-    return x;
+    poolCadenas.tabla[pos] = id;
+    poolCadenas.ocupados++;
+    return id;
 }
 
 
 
-// Funcin para realizar una rotacin a la izquierda en un rbol AVL.
+// Funcin para obtener las vistas de las cadenas de una palabra.
 //
 // Parmetros:
-// - x: Puntero al nodo que ser rotado hacia la izquierda.
+// - p: Palabra con sus traducciones.
 //
 // Retorno:
-// - Un puntero al nuevo nodo raz despus de la rotacin.
+// - Un objeto `VistaPalabra` que apunta a las cadenas de `p` (vlido mientras `p` exista).
+
+VistaPalabra vistaDe(const Palabra& p) {
+    return { p.espanol, p.ingles, p.aleman, p.frances, p.italiano };
+}
+
+
+
+// Funcin para convertir una palabra leda (con cadenas) a su forma interna (con identificadores).
 //
-// Proceso:
-// 1. Identifica el nodo derecho (`y`) como el nuevo nodo raz.
-// 2. Almacena el subrbol izquierdo de `y` (denominado `T2`) temporalmente.
-// 3. Realiza la rotacin:
-//    - El nodo `y` se convierte en la nueva raz.
-//    - El nodo `x` pasa a ser el hijo izquierdo de `y`.
-//    - El subrbol `T2` se asigna como el hijo derecho de `x`.
-// 4. Actualiza las alturas de los nodos afectados (`x` y `y`).
+// Parmetros:
+// - p: Vistas de la palabra y sus traducciones.
 //
-// Notas:
-// - Esta operacin se utiliza para re-balancear el rbol AVL cuando el subrbol derecho
-//   de un nodo est desbalanceado (caso de rotacin simple izquierda).
-// - Mantiene las propiedades del rbol AVL (balance y orden).
+// Retorno:
+// - Un objeto `PalabraInterna` con los identificadores de cada cadena en el pool.
+
+PalabraInterna internarPalabra(const VistaPalabra& p) {
+    PalabraInterna interna;
+    interna.espanol = internarCadena(p.espanol);
+    interna.ingles = internarCadena(p.ingles);
+    interna.aleman = internarCadena(p.aleman);
+    interna.frances = internarCadena(p.frances);
+    interna.italiano = internarCadena(p.italiano);
+    return interna;
+}
 
-Nodo* rotarIzquierda(Nodo* x) {
-    Nodo* y = x->derecha; // El nuevo nodo raz ser el hijo derecho.
-    Nodo* T2 = y->izquierda; // Almacena temporalmente el subrbol izquierdo de `y`.
 
-    // Realizar la rotacin.
-    y->izquierda = x;
-    x->derecha = T2;
 
-    // Actualizar las alturas de los nodos afectados.
-    actualizarAltura(x);
-    actualizarAltura(y);
+// Funcin para reconstruir la tabla hash del pool a partir del bloque de texto.
+//
+// Proceso:
+// 1. Recorre `texto` de principio a fin; cada cadena comienza donde termina la anterior.
+// 2. Crea una tabla con espacio para el doble de cadenas y ubica cada identificador segn su hash.
+//
+// Notas:
+// - Se usa cuando `texto` se copia completo desde el diccionario binario, sin pasar por `internarCadena`.
+// - Supone que el bloque no tiene cadenas repetidas.
+
+void reconstruirTablaCadenas() {
+    vector<uint32_t> ids;
+    size_t id = 0;
+    while (id < poolCadenas.texto.size()) {
+        ids.push_back(static_cast<uint32_t>(id));
+        string_view cadena = cadenaDe(static_cast<uint32_t>(id));
+        id = static_cast<size_t>(cadena.data() - poolCadenas.texto.data()) + cadena.size();
+    }
 
-    // Retornar el nuevo nodo raz.
-    return y;
+    size_t tamano = 1024;
+    while (tamano < (ids.size() + 1) * 2) tamano *= 2;
+    poolCadenas.tabla.assign(tamano, PoolCadenas::SIN_CADENA);
+    size_t mascara = tamano - 1;
+
+    for (uint32_t cadena : ids) {
+        size_t pos = hashCadena(cadenaDe(cadena)) & mascara;
+        while (poolCadenas.tabla[pos] != PoolCadenas::SIN_CADENA) {
+            pos = (pos + 1) & mascara;
+        }
+        poolCadenas.tabla[pos] = cadena;
+    }
+    poolCadenas.ocupados = ids.size();
 }
 
 
 
-// Funcin para insertar un nuevo nodo en el rbol AVL.
-//
-// Parmetros:
-// - nodo: Puntero al nodo raz del rbol donde se realizar la insercin.
-// - nuevaPalabra: Objeto de tipo `Palabra` que contiene la palabra en espaol y sus traducciones.
-//
-// Retorno:
-// - Un puntero al nodo raz actualizado despus de la insercin.
+// Funcin para reconstruir el pool de cadenas solo con las cadenas que usa `tablaPalabras`.
 //
 // Proceso:
-// 1. Si el nodo actual es nulo, crea un nuevo nodo con la palabra proporcionada y lo retorna.
-// 2. Compara la palabra en espaol de `nuevaPalabra` con la palabra del nodo actual:
-//    - Si es menor, realiza la insercin en el subrbol izquierdo.
-//    - Si es mayor, realiza la insercin en el subrbol derecho.
-//    - Si es igual, no realiza la insercin (no se permiten duplicados).
-// 3. Actualiza la altura del nodo actual despus de la insercin.
-// 4. Calcula el factor de balance del nodo actual para verificar si est balanceado.
-// 5. Si el nodo est desbalanceado, aplica las rotaciones necesarias segn el caso:
-//    - Caso Izquierda Izquierda: Rotacin derecha.
-//    - Caso Derecha Derecha: Rotacin izquierda.
-//    - Caso Izquierda Derecha: Rotacin izquierda en el hijo izquierdo, luego rotacin derecha.
-//    - Caso Derecha Izquierda: Rotacin derecha en el hijo derecho, luego rotacin izquierda.
+// 1. Toma el bloque de texto actual y deja el pool vaco (la tabla hash crece a medida que se guardan las cadenas).
+// 2. Vuelve a guardar cada cadena de cada palabra con `internarCadena` y actualiza su identificador; las
+//    traducciones `SIN_CADENA` (pendientes o comprimidas) no se tocan, y las posiciones libres quedan vacas.
 //
 // Notas:
-// - Esta funcin asegura que el rbol AVL permanezca balanceado despus de cada insercin.
-// - Las rotaciones mantienen las propiedades del rbol AVL (balance y orden).
+// - Las cadenas no se eliminan una por una (varias palabras pueden compartirlas); esta funcin libera de una vez
+//   las que ya nadie usa, por ejemplo las traducciones de un idioma despus de comprimirlo.
+// - Todos los identificadores de cadenas cambian: solo `tablaPalabras` los guarda (los ndices guardan posiciones).
+
+void compactarPoolCadenas() {
+    string anterior;
+    anterior.swap(poolCadenas.texto);
+    poolCadenas.tabla.clear();
+    poolCadenas.tabla.shrink_to_fit();
+    poolCadenas.ocupados = 0;
+
+    vector<bool> libre(tablaPalabras.palabras.size(), false);
+    for (uint32_t entrada : tablaPalabras.libres) libre[entrada] = true;
+
+    for (size_t entrada = 0; entrada < tablaPalabras.palabras.size(); ++entrada) {
+        PalabraInterna& p = tablaPalabras.palabras[entrada];
+        uint32_t* campos[] = { &p.espanol, &p.ingles, &p.aleman, &p.frances, &p.italiano };
+        for (uint32_t* campo : campos) {
+            if (*campo == PoolCadenas::SIN_CADENA) continue;
+            *campo = internarCadena(libre[entrada] ? string_view() : cadenaEn(anterior.data(), *campo));
+        }
+    }
+    poolCadenas.texto.shrink_to_fit();
+}
 
-Nodo* insertar(Nodo* nodo, Palabra nuevaPalabra) {
-    // Caso base: si el nodo es nulo, crea un nuevo nodo con la palabra.
-    if (!nodo) return new Nodo(nuevaPalabra);
 
-    // Comparar la palabra en espaol para decidir la direccin de la insercin.
-    if (nuevaPalabra.espanol < nodo->palabra.espanol)
-        nodo->izquierda = insertar(nodo->izquierda, nuevaPalabra); // Insertar en el subrbol izquierdo.
-    else if (nuevaPalabra.espanol > nodo->palabra.espanol)
-        nodo->derecha = insertar(nodo->derecha, nuevaPalabra); // Insertar en el subrbol derecho.
-    else
-        return nodo; // No se permiten duplicados.
 
-    // Actualizar la altura del nodo actual.
-    actualizarAltura(nodo);
 
-    // Calcular el factor de balance del nodo actual.
-    int balance = factorBalance(nodo);
+//==========================FUNCIONES DE LECTURA CSV==========================
 
-    // Verificar y corregir el desbalance si es necesario.
-    // Caso Izquierda Izquierda
-    if (balance > 1 && nuevaPalabra.espanol < nodo->izquierda->palabra.espanol)
-        return rotarDerecha(nodo);
 
-    // Caso Derecha Derecha
-    if (balance < -1 && nuevaPalabra.espanol > nodo->derecha->palabra.espanol)
-        return rotarIzquierda(nodo);
 
-    // Caso Izquierda Derecha
-    if (balance > 1 && nuevaPalabra.espanol > nodo->izquierda->palabra.espanol) {
-        nodo->izquierda = rotarIzquierda(nodo->izquierda);
-        return rotarDerecha(nodo);
-    }
+// Estructura para guardar las palabras ledas de un archivo sin copiar su texto.
+//
+// Campos:
+// - TAMANO_BLOQUE: Cantidad de bytes que se leen del archivo en cada lectura.
+// - bloques: Bloques ledos del archivo; las vistas de `palabras` apuntan a su contenido.
+// - palabras: Palabras ledas, en el orden del archivo (o ya ordenadas, ver `leerArchivoPalabras`).
+//
+// Notas:
+// - Mover un `vector<char>` conserva su contenido en la misma direccin, por lo que las vistas siguen
+//   siendo vlidas aunque `bloques` crezca.
 
-    // Caso Derecha Izquierda
-    if (balance < -1 && nuevaPalabra.espanol < nodo->derecha->palabra.espanol) {
-        nodo->derecha = rotarDerecha(nodo->derecha);
-        return rotarIzquierda(nodo);
-    }
+struct ArchivoPalabras {
+    static const size_t TAMANO_BLOQUE = 1 << 20;
 
-    // Retornar el nodo actual si no hubo desbalance.
-    return nodo;
-}
+    vector<vector<char>> bloques;
+    vector<VistaPalabra> palabras;
+};
 
 
 
-// Funcin para buscar una palabra en el rbol AVL.
+// Funcin para buscar la primera aparicin de un carcter comparando 16 bytes a la vez.
 //
 // Parmetros:
-// - raiz: Puntero al nodo raz del rbol donde se realizar la bsqueda.
-// - palabraBuscada: Cadena que contiene la palabra en espaol que se desea buscar.
+// - desde: Inicio del texto.
+// - fin: Posicin siguiente al ltimo carcter del texto.
+// - caracter: Carcter buscado (por ejemplo `,` o el salto de lnea).
 //
 // Retorno:
-// - Un puntero al nodo que contiene la palabra buscada.
-// - Si la palabra no se encuentra en el rbol, retorna nullptr.
+// - La posicin del carcter, o `fin` si no aparece.
 //
 // Proceso:
-// 1. Verifica si el nodo actual (`raiz`) es nulo o si contiene la palabra buscada:
-//    - Si es nulo, significa que la palabra no est en el rbol.
-//    - Si contiene la palabra buscada, retorna el nodo actual.
-// 2. Compara la palabra buscada con la palabra en espaol del nodo actual:
-//    - Si es menor, realiza la bsqueda en el subrbol izquierdo.
-//    - Si es mayor, realiza la bsqueda en el subrbol derecho.
-//
-// Notas:
-// - Esta funcin utiliza la propiedad de orden del rbol AVL para realizar la bsqueda de manera eficiente.
-// - La bsqueda tiene una complejidad de O(log n) en promedio, donde `n` es el nmero de nodos en el rbol.
-
-Nodo* buscar(Nodo* raiz, const string& palabraBuscada) {
-    // Caso base: el nodo es nulo o contiene la palabra buscada.
-    if (!raiz || raiz->palabra.espanol == palabraBuscada)
-        return raiz;
-
-    // Decidir la direccin de la bsqueda.
-    if (palabraBuscada < raiz->palabra.espanol)
-        return buscar(raiz->izquierda, palabraBuscada); // Buscar en el subrbol izquierdo.
-    else
-        return buscar(raiz->derecha, palabraBuscada); // Buscar en el subrbol derecho.
+// 1. Compara de a 16 bytes con SSE2 (`_mm_cmpeq_epi8`) y rene el resultado en una mscara de 16 bits;
+//    si la mscara no es 0, el bit ms bajo encendido indica la posicin.
+// 2. Revisa uno por uno los ltimos bytes (menos de 16), para no leer fuera del texto.
+
+inline char* buscarCaracter(char* desde, char* fin, char caracter) {
+    const __m128i buscado = _mm_set1_epi8(caracter);
+    while (fin - desde >= 16) {
+        __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(desde));
+        unsigned long mascara = static_cast<unsigned long>(_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, buscado)));
+        if (mascara) {
+            unsigned long posicion;
+            _BitScanForward(&posicion, mascara);
+            return desde + posicion;
+        }
+        desde += 16;
+    }
+    while (desde < fin && *desde != caracter) ++desde;
+    return desde;
 }
 
 
 
-// Funcin para cargar palabras desde un archivo y construir el rbol AVL.
+// Funcin para separar una lnea CSV en campos, sin copiarlos.
+//
+// Parmetros:
+// - inicio: Inicio de la lnea (sin el salto de lnea).
+// - fin: Fin de la lnea.
+// - campos: Arreglo donde se guardan las vistas de los campos.
+// - cantidad: Cantidad de campos que debe tener la lnea.
 //
 // Retorno:
-// - Un puntero al nodo raz del rbol AVL construido a partir de las palabras en el archivo.
-// - Si el archivo no se puede abrir, retorna nullptr.
+// - true si la lnea tiene exactamente `cantidad` campos bien formados, false en caso contrario.
 //
 // Proceso:
-// 1. Abre el archivo `palabras.umg` en modo lectura.
-// 2. Si el archivo no se puede abrir, muestra un mensaje de error y retorna nullptr.
-// 3. Inicializa un puntero `raiz` como nullptr para construir el rbol AVL.
-// 4. Lee cada lnea del archivo, donde cada lnea contiene una palabra y sus traducciones separadas por comas.
-// 5. Divide la lnea en sus componentes (palabra en espaol y traducciones) y crea un objeto `Palabra`.
-// 6. Inserta el objeto `Palabra` en el rbol AVL utilizando la funcin `insertar`.
-// 7. Cierra el archivo y retorna el puntero a la raz del rbol.
+// 1. Un campo sin comillas termina en la siguiente coma (buscada con `buscarCaracter`).
+// 2. Un campo que empieza con comillas termina en las comillas que cierran; las comillas dobles
+//    (`""`) dentro de l representan una comilla. El campo se reescribe en el mismo lugar sin las
+//    comillas, por lo que puede contener comas.
 //
 // Notas:
-// - El archivo debe estar ubicado en la ruta `C:\\traductor\\palabras.umg`.
-// - Cada lnea del archivo debe tener el formato: `espanol,ingles,aleman,frances,italiano`.
-// - La funcin utiliza la funcin `insertar` para mantener el rbol AVL balanceado.
-// - Si el archivo est vaco, la funcin retorna un rbol vaco (nullptr).
+// - La lnea se modifica solo cuando tiene campos entre comillas.
+// - Una comilla en medio de un campo sin comillas se toma como parte del texto, igual que antes de
+//   que el archivo admitiera comillas.
 
-Nodo* cargarPalabras() {
-    const string nombreArchivo = "C:\\traductor\\palabras.umg";
-    ifstream archivo(nombreArchivo);
-    if (!archivo.is_open()) {
-        cerr << "Error al abrir el archivo: " << nombreArchivo << endl;
-        return nullptr;
+bool separarCampos(char* inicio, char* fin, string_view* campos, size_t cantidad) {
+    size_t campo = 0;
+    char* p = inicio;
+    while (true) {
+        if (campo == cantidad) return false; // Sobran campos.
+
+        if (p < fin && *p == '"') {
+            // Campo entre comillas: copiar su contenido sobre la comilla inicial.
+            char* escritura = p;
+            char* inicioCampo = p;
+            ++p;
+            while (true) {
+                char* comilla = buscarCaracter(p, fin, '"');
+                if (comilla == fin) return false; // Faltan las comillas que cierran.
+                memmove(escritura, p, comilla - p);
+                escritura += comilla - p;
+                p = comilla + 1;
+                if (p < fin && *p == '"') {
+                    *escritura++ = '"'; // Comilla escapada.
+                    ++p;
+                    continue;
+                }
+                break;
+            }
+            campos[campo++] = string_view(inicioCampo, escritura - inicioCampo);
+            if (p == fin) break;
+            if (*p != ',') return false; // Texto despus de las comillas que cierran.
+            ++p;
+        }
+        else {
+            char* coma = buscarCaracter(p, fin, ',');
+            campos[campo++] = string_view(p, coma - p);
+            if (coma == fin) break;
+            p = coma + 1;
+        }
     }
+    return campo == cantidad;
+}
 
-    Nodo* raiz = nullptr; // Inicializar la raz del rbol AVL como nula.
-    string linea;
 
-    // Leer cada lnea del archivo.
-    while (getline(archivo, linea)) {
-        stringstream ss(linea);
-        Palabra p;
 
-        // Dividir la lnea en sus componentes y asignarlas al objeto `Palabra`.
-        if (getline(ss, p.espanol, ',') &&
-            getline(ss, p.ingles, ',') &&
-            getline(ss, p.aleman, ',') &&
-            getline(ss, p.frances, ',') &&
-            getline(ss, p.italiano, ',')) {
-            // Insertar la palabra en el rbol AVL.
-            raiz = insertar(raiz, p);
-        }
-    }
+// Funcin para agregar un campo a una lnea CSV, ponindolo entre comillas si es necesario.
+//
+// Parmetros:
+// - linea: Lnea a la que se agrega el campo.
+// - campo: Texto del campo.
+//
+// Notas:
+// - Solo se usan comillas si el campo contiene comas o comillas; as los archivos sin esos caracteres
+//   quedan igual que antes.
+// - Los campos no pueden contener saltos de lnea: cada lnea del archivo es una palabra.
 
-    archivo.close(); // Cerrar el archivo despus de leerlo.
-    return raiz; // Retornar la raz del rbol AVL.
+void agregarCampoCSV(string& linea, string_view campo) {
+    if (campo.find_first_of(",\"") == string_view::npos) {
+        linea.append(campo.data(), campo.size());
+        return;
+    }
+    linea += '"';
+    for (char c : campo) {
+        if (c == '"') linea += '"';
+        linea += c;
+    }
+    linea += '"';
 }
 
 
 
-// Funcin para agregar una nueva palabra al rbol AVL y al archivo de palabras.
+// Funcin para leer un archivo de palabras en bloques grandes y separarlo en palabras sin copiar el texto.
 //
 // Parmetros:
-// - raiz: Puntero al nodo raz del rbol AVL donde se agregar la nueva palabra.
-// - archivo: Ruta del archivo donde se almacenarn las palabras.
+// - ruta: Ruta del archivo de palabras.
+// - archivo: Estructura donde se guardan los bloques ledos y las palabras (en el orden del archivo).
+// - registros: Cantidad de lneas vlidas ledas.
 //
 // Retorno:
-// - Un puntero al nodo raz actualizado despus de agregar la nueva palabra.
+// - true si el archivo se pudo abrir, false en caso contrario.
 //
 // Proceso:
-// 1. Solicita al usuario que ingrese la palabra en espaol y sus traducciones (ingls, alemn, francs, italiano).
-// 2. Crea un objeto `Palabra` con los datos ingresados por el usuario.
-// 3. Inserta la nueva palabra en el rbol AVL utilizando la funcin `insertar`.
-// 4. Abre el archivo en modo de adicin (append) para guardar la nueva palabra.
-// 5. Escribe la palabra y sus traducciones en el archivo en formato CSV (separadas por comas).
-// 6. Cierra el archivo y muestra un mensaje de xito.
+// 1. Lee el archivo de a TAMANO_BLOQUE bytes. La lnea incompleta al final de un bloque se pasa
+//    al principio del siguiente.
+// 2. Busca los saltos de lnea con `buscarCaracter` y separa cada lnea con `separarCampos`.
+// 3. Guarda una `VistaPalabra` por lnea vlida, apuntando al bloque, que se conserva en `archivo.bloques`.
+// 4. Informa en `cerr` el nmero de las lneas mal formadas (campos de ms o de menos, comillas sin
+//    cerrar o palabra en espaol vaca) y las omite.
 //
 // Notas:
-// - Si el archivo no se puede abrir, muestra un mensaje de error y retorna la raz sin cambios.
-// - La funcin asegura que la nueva palabra se agrega tanto al rbol AVL como al archivo.
-// - El archivo debe estar ubicado en la ruta especificada por el parmetro `archivo`.
+// - Acepta saltos de lnea `\n` y `\r\n`, y una ltima lnea sin salto de lnea.
+// - Las lneas vacas se omiten sin avisar.
+// - Solo se muestran las primeras 10 lneas mal formadas, seguidas del total.
+
+bool separarArchivoPalabras(const string& ruta, ArchivoPalabras& archivo, size_t& registros) {
+    ifstream entrada(ruta, ios::binary);
+    if (!entrada.is_open()) return false;
+
+    const size_t MAXIMO_AVISOS = 10;
+    vector<char> pendiente; // Lnea incompleta al final del bloque anterior.
+    size_t numeroLinea = 0;
+    size_t malformadas = 0;
+    registros = 0;
+
+    bool terminado = false;
+    while (!terminado) {
+        // Leer el siguiente bloque a continuacin de la lnea pendiente.
+        vector<char> bloque(pendiente.size() + ArchivoPalabras::TAMANO_BLOQUE);
+        copy(pendiente.begin(), pendiente.end(), bloque.begin());
+        entrada.read(bloque.data() + pendiente.size(), ArchivoPalabras::TAMANO_BLOQUE);
+        size_t leidos = static_cast<size_t>(entrada.gcount());
+        terminado = leidos < ArchivoPalabras::TAMANO_BLOQUE;
+        bloque.resize(pendiente.size() + leidos);
+        if (terminado && !bloque.empty() && bloque.back() != '\n') bloque.push_back('\n');
+
+        // Separar las lneas completas; lo que sigue al ltimo salto de lnea queda pendiente.
+        char* p = bloque.data();
+        char* ultimo = p + bloque.size();
+        while (ultimo > p && ultimo[-1] != '\n') --ultimo;
+        pendiente.assign(ultimo, bloque.data() + bloque.size());
+
+        while (p < ultimo) {
+            char* salto = buscarCaracter(p, ultimo, '\n');
+            char* finLinea = salto;
+            if (finLinea > p && finLinea[-1] == '\r') --finLinea;
+            ++numeroLinea;
+
+            if (finLinea > p) {
+                string_view campos[5];
+                if (separarCampos(p, finLinea, campos, 5) && !campos[0].empty()) {
+                    archivo.palabras.push_back({ campos[0], campos[1], campos[2], campos[3], campos[4] });
+                    ++registros;
+                }
+                else {
+                    if (malformadas < MAXIMO_AVISOS) {
+                        cerr << "Linea " << numeroLinea << " mal formada en " << ruta << ", se omite.\n";
+                    }
+                    ++malformadas;
+                }
+            }
+            p = salto + 1;
+        }
 
-Nodo* agregarPalabra(Nodo* raiz, const string& archivo) {
-    Palabra nuevaPalabra;
+        if (ultimo != bloque.data()) archivo.bloques.push_back(move(bloque));
+    }
 
-    // Solicitar al usuario los datos de la nueva palabra.
-    cout << "\nIngrese la palabra en espanol: ";
-    cin >> nuevaPalabra.espanol;
-    cout << "Ingrese la traduccion en ingles: ";
-    cin >> nuevaPalabra.ingles;
-    cout << "Ingrese la traduccion en aleman: ";
-    cin >> nuevaPalabra.aleman;
-    cout << "Ingrese la traduccion en frances: ";
-    cin >> nuevaPalabra.frances;
-    cout << "Ingrese la traduccion en italiano: ";
-    cin >> nuevaPalabra.italiano;
+    if (malformadas > MAXIMO_AVISOS) {
+        cerr << "Total de lineas mal formadas en " << ruta << ": " << malformadas << "\n";
+    }
+    return true;
+}
 
-    // Agregar la nueva palabra al rbol AVL.
-    raiz = insertar(raiz, nuevaPalabra);
 
-    // Abrir el archivo en modo de adicin para guardar la nueva palabra.
-    ofstream archivoOut(archivo, ios::app);
-    if (!archivoOut.is_open()) {
-        cerr << "Error al abrir el archivo para escritura.\n";
-        return raiz; // Retornar la raz sin cambios si ocurre un error.
-    }
 
-    // Escribir la nueva palabra en el archivo en formato CSV.
-    archivoOut << nuevaPalabra.espanol << "," << nuevaPalabra.ingles << ","
-        << nuevaPalabra.aleman << "," << nuevaPalabra.frances << ","
-        << nuevaPalabra.italiano << endl;
-    archivoOut.close(); // Cerrar el archivo.
 
-    cout << "Palabra agregada con exito.\n"; // Mostrar mensaje de xito.
-    return raiz; // Retornar la raz actualizada.
-}
+//==========================FUNCIONES DEL REGISTRO DE CAMBIOS==========================
 
 
 
-// Funcin para encontrar el nodo con la clave mnima en un rbol AVL.
+// Estructura para administrar el registro de cambios del diccionario.
+// En lugar de reescribir `palabras.umg` en cada cambio, las palabras agregadas y eliminadas se anotan
+// al final de `cambios.umg`; cada cierto tiempo un hilo aparte las incorpora a `palabras.umg` (compactacin).
+//
+// Campos:
+// - rutaBase: Archivo con las palabras (una por lnea: `espanol,ingles,aleman,frances,italiano`).
+// - rutaCambios: Registro de cambios; cada lnea es `+,espanol,ingles,aleman,frances,italiano` (palabra
+//   agregada) o `-,espanol` (marca de palabra eliminada).
+// - rutaAnterior: Registro que se est incorporando a `rutaBase` mientras los cambios nuevos van a `rutaCambios`.
+// - registrosBase, registrosAnterior, registrosCambios: Cantidad de lneas de cada archivo.
+// - compactador: Hilo que realiza la compactacin.
+// - compactando: Indica si el hilo todava est trabajando.
+// - compactacionExitosa, registrosCompactados: Resultado de la ltima compactacin (lneas del nuevo archivo base).
+//
+// Notas:
+// - Cada palabra viva est representada por un solo registro; el resto de los registros (marcas de
+//   eliminacin y palabras reemplazadas o eliminadas) es basura. Cuando la basura supera UMBRAL_BASURA
+//   del total, o el registro de cambios es ms largo que el archivo base, se compacta.
+
+struct RegistroCambios {
+    static constexpr double UMBRAL_BASURA = 0.5;
+    static const size_t MINIMO_REGISTROS = 1024;
+
+    string rutaBase = "C:\\traductor\\palabras.umg";
+    string rutaCambios = "C:\\traductor\\cambios.umg";
+    string rutaAnterior = "C:\\traductor\\cambios_anterior.umg";
+
+    size_t registrosBase = 0;
+    size_t registrosAnterior = 0;
+    size_t registrosCambios = 0;
+
+    thread compactador;
+    atomic<bool> compactando{ false };
+    atomic<bool> compactacionExitosa{ false };
+    atomic<size_t> registrosCompactados{ 0 };
+};
+
+
+// Registro global de cambios del diccionario.
+RegistroCambios registroCambios;
+
+
+
+// Funcin para leer un archivo de palabras y dejarlas ordenadas y sin repetir.
 //
 // Parmetros:
-// - nodo: Puntero al nodo raz del rbol o subrbol donde se buscar el nodo mnimo.
+// - ruta: Ruta del archivo de palabras.
+// - archivo: Estructura donde se guardan el texto ledo y las palabras.
+// - registros: Cantidad de lneas vlidas ledas (incluidas las repetidas).
 //
 // Retorno:
-// - Un puntero al nodo que contiene la clave mnima en el rbol o subrbol.
+// - true si el archivo se pudo abrir, false en caso contrario.
 //
 // Proceso:
-// 1. Comienza desde el nodo raz proporcionado.
-// 2. Itera hacia el hijo izquierdo de cada nodo, ya que en un rbol binario de bsqueda
-//    el nodo con la clave mnima siempre se encuentra en el extremo izquierdo.
-// 3. Retorna el nodo ms a la izquierda encontrado.
-//
-// Notas:
-// - Esta funcin se utiliza principalmente en operaciones como eliminacin de nodos
-//   para encontrar el sucesor en caso de que el nodo a eliminar tenga dos hijos.
-// - Si el rbol o subrbol est vaco (nodo es nulo), retorna nullptr.
-// - La complejidad de esta funcin es O(h), donde `h` es la altura del rbol o subrbol.
+// 1. Lee el archivo con `separarArchivoPalabras` y verifica si las palabras vienen en orden alfabtico.
+// 2. Si el archivo no est ordenado (por ejemplo, con palabras agregadas al final), las ordena
+//    manteniendo el orden original entre repetidas.
+// 3. Descarta las repetidas conservando la primera aparicin (como lo hara `insertar`).
 
-Nodo* minimo(Nodo* nodo) {
-    // Iterar hacia el hijo izquierdo hasta encontrar el nodo ms a la izquierda.
-    while (nodo->izquierda) {
-        nodo = nodo->izquierda;
+bool leerArchivoPalabras(const string& ruta, ArchivoPalabras& archivo, size_t& registros) {
+    if (!separarArchivoPalabras(ruta, archivo, registros)) return false;
+
+    vector<VistaPalabra>& palabras = archivo.palabras;
+    auto menor = [](const VistaPalabra& a, const VistaPalabra& b) {
+        return a.espanol < b.espanol;
+        };
+    if (!is_sorted(palabras.begin(), palabras.end(), menor)) {
+        stable_sort(palabras.begin(), palabras.end(), menor);
     }
-    return nodo; // Retornar el nodo con la clave mnima.
+
+    palabras.erase(unique(palabras.begin(), palabras.end(), [](const VistaPalabra& a, const VistaPalabra& b) {
+        return a.espanol == b.espanol;
+        }), palabras.end());
+    return true;
 }
 
 
 
-// Funcin para eliminar una palabra del rbol AVL.
+// Funcin para aplicar un registro de cambios a un vector de palabras ordenado.
 //
 // Parmetros:
-// - nodo: Puntero al nodo raz del rbol o subrbol donde se realizar la eliminacin.
-// - palabra: Cadena que contiene la palabra en espaol que se desea eliminar.
+// - ruta: Ruta del registro de cambios.
+// - archivo: Palabras ordenadas y sin repetir; al terminar contiene el resultado de aplicar los cambios.
 //
 // Retorno:
-// - Un puntero al nodo raz actualizado despus de la eliminacin.
+// - La cantidad de registros ledos (0 si el archivo no existe).
 //
 // Proceso:
-// 1. Realiza una bsqueda normal en el rbol AVL para encontrar el nodo que contiene la palabra:
-//    - Si la palabra es menor que la palabra del nodo actual, busca en el subrbol izquierdo.
-//    - Si la palabra es mayor, busca en el subrbol derecho.
-//    - Si encuentra el nodo, procede con la eliminacin.
-// 2. Elimina el nodo segn los siguientes casos:
-//    - Caso 1: El nodo no tiene hijos (es una hoja). Elimina el nodo y lo reemplaza con nullptr.
-//    - Caso 2: El nodo tiene un solo hijo. Reemplaza el nodo con su nico hijo y lo elimina.
-//    - Caso 3: El nodo tiene dos hijos. Encuentra el sucesor en el subrbol derecho (el nodo con la clave mnima),
-//      copia su contenido al nodo actual, y elimina el sucesor recursivamente.
-// 3. Despus de eliminar el nodo, actualiza la altura del nodo actual.
-// 4. Calcula el factor de balance del nodo actual para verificar si est balanceado.
-// 5. Si el nodo est desbalanceado, aplica las rotaciones necesarias segn el caso:
-//    - Caso Izquierda Izquierda: Rotacin derecha.
-//    - Caso Izquierda Derecha: Rotacin izquierda en el hijo izquierdo, luego rotacin derecha.
-//    - Caso Derecha Derecha: Rotacin izquierda.
-//    - Caso Derecha Izquierda: Rotacin derecha en el hijo derecho, luego rotacin izquierda.
+// 1. Lee el registro completo en un bloque y separa sus lneas con `buscarCaracter` y `separarCampos`.
+// 2. Calcula el estado final de cada palabra modificada: un `+` agrega la palabra si no estaba
+//    (igual que `insertar`) y un `-` la elimina si estaba.
+// 3. Combina en un solo recorrido las palabras sin cambios con las agregadas, omitiendo las eliminadas.
 //
 // Notas:
-// - Esta funcin asegura que el rbol AVL permanezca balanceado despus de cada eliminacin.
-// - Las rotaciones mantienen las propiedades del rbol AVL (balance y orden).
+// - Una ltima lnea sin salto de lnea se ignora: es un registro que qued a medio escribir.
+// - Aplicar dos veces el mismo registro da el mismo resultado, por lo que se puede repetir sin riesgo
+//   si una compactacin se interrumpe.
+// - Las palabras agregadas apuntan al bloque del registro, que se guarda en `archivo.bloques`.
+
+size_t aplicarCambios(const string& ruta, ArchivoPalabras& archivo) {
+    ifstream entrada(ruta, ios::binary);
+    if (!entrada.is_open()) return 0;
+    vector<char> datos((istreambuf_iterator<char>(entrada)), istreambuf_iterator<char>());
+    entrada.close();
+
+    // Estado final de cada palabra modificada: presente (con sus datos) o eliminada.
+    map<string_view, pair<bool, VistaPalabra>> cambios;
+    vector<VistaPalabra>& palabras = archivo.palabras;
+    size_t registros = 0;
+
+    char* p = datos.data();
+    char* fin = p + datos.size();
+    while (p < fin) {
+        char* salto = buscarCaracter(p, fin, '\n');
+        if (salto == fin) break; // Registro incompleto.
+        char* linea = p;
+        char* finLinea = salto > linea && salto[-1] == '\r' ? salto - 1 : salto;
+        p = salto + 1;
+        if (finLinea - linea < 3 || linea[1] != ',' || (linea[0] != '+' && linea[0] != '-')) continue;
+
+        bool agregar = linea[0] == '+';
+        string_view campos[5];
+        if (!separarCampos(linea + 2, finLinea, campos, agregar ? 5 : 1)) continue;
+        VistaPalabra vista = { campos[0], campos[1], campos[2], campos[3], campos[4] };
+        ++registros;
+
+        // Determinar si la palabra est presente antes de este registro.
+        auto cambio = cambios.find(vista.espanol);
+        bool presente;
+        if (cambio != cambios.end()) {
+            presente = cambio->second.first;
+        }
+        else {
+            presente = binary_search(palabras.begin(), palabras.end(), vista, [](const VistaPalabra& a, const VistaPalabra& b) {
+                return a.espanol < b.espanol;
+                });
+        }
 
-Nodo* eliminarPalabra(Nodo* nodo, const string& palabra) {
-    if (!nodo) return nodo; // Caso base: el nodo es nulo.
+        if (agregar && !presente) {
+            cambios[vista.espanol] = { true, vista };
+        }
+        else if (!agregar && presente) {
+            cambios[vista.espanol] = { false, VistaPalabra() };
+        }
+    }
 
-    // Bsqueda normal en el rbol AVL.
-    if (palabra < nodo->palabra.espanol)
-        nodo->izquierda = eliminarPalabra(nodo->izquierda, palabra); // Buscar en el subrbol izquierdo.
-    else if (palabra > nodo->palabra.espanol)
-        nodo->derecha = eliminarPalabra(nodo->derecha, palabra); // Buscar en el subrbol derecho.
-    else {
-        // Nodo encontrado.
-        if (!nodo->izquierda || !nodo->derecha) {
-            // Caso 1 y Caso 2: El nodo tiene 0 o 1 hijo.
-            Nodo* temp = nodo->izquierda ? nodo->izquierda : nodo->derecha;
-            if (!temp) {
-                // Caso 1: Nodo sin hijos.
-                temp = nodo;
-                nodo = nullptr;
-            }
-            else {
-                // Caso 2: Nodo con un solo hijo.
-                *nodo = *temp; // Reemplazar el nodo actual con su nico hijo.
-            }
-            delete temp; // Eliminar el nodo.
+    if (cambios.empty()) return registros;
+    archivo.bloques.push_back(move(datos)); // Las palabras agregadas apuntan a este bloque.
+
+    // Combinar las palabras ordenadas con los cambios (tambin ordenados).
+    vector<VistaPalabra> resultado;
+    resultado.reserve(palabras.size() + cambios.size());
+    auto cambio = cambios.begin();
+    for (const VistaPalabra& palabra : palabras) {
+        while (cambio != cambios.end() && cambio->first < palabra.espanol) {
+            if (cambio->second.first) resultado.push_back(cambio->second.second);
+            ++cambio;
         }
-        else {
-            // Caso 3: Nodo con dos hijos.
-            Nodo* temp = minimo(nodo->derecha); // Encontrar el sucesor (mnimo en el subrbol derecho).
-            nodo->palabra = temp->palabra; // Copiar los datos del sucesor al nodo actual.
-            nodo->derecha = eliminarPalabra(nodo->derecha, temp->palabra.espanol); // Eliminar el sucesor.
+        if (cambio != cambios.end() && cambio->first == palabra.espanol) {
+            // La palabra fue eliminada o reemplazada por una versin agregada despus.
+            if (cambio->second.first) resultado.push_back(cambio->second.second);
+            ++cambio;
+            continue;
         }
+        resultado.push_back(palabra);
+    }
+    for (; cambio != cambios.end(); ++cambio) {
+        if (cambio->second.first) resultado.push_back(cambio->second.second);
     }
 
-    // Si el rbol est vaco despus de la eliminacin.
-    if (!nodo) return nodo;
+    palabras.swap(resultado);
+    return registros;
+}
 
-    // Actualizar la altura del nodo actual.
-    actualizarAltura(nodo);
 
-    // Calcular el factor de balance del nodo actual.
-    int balance = factorBalance(nodo);
 
-    // Verificar y corregir el desbalance si es necesario.
-    // Caso Izquierda Izquierda
-    if (balance > 1 && factorBalance(nodo->izquierda) >= 0)
-        return rotarDerecha(nodo);
+// Funcin para escribir un archivo de palabras reemplazando al anterior de forma segura.
+//
+// Parmetros:
+// - ruta: Ruta del archivo de palabras.
+// - palabras: Palabras que se desean escribir (una por lnea, en formato CSV).
+//
+// Retorno:
+// - true si el archivo se escribi y reemplaz al anterior, false en caso contrario.
+//
+// Notas:
+// - Escribe primero un archivo temporal y luego lo renombra, de modo que una interrupcin nunca
+//   deja un archivo de palabras a medio escribir.
+// - Los campos con comas o comillas se escriben entre comillas (ver `agregarCampoCSV`).
 
-    // Caso Izquierda Derecha
-    if (balance > 1 && factorBalance(nodo->izquierda) < 0) {
-        nodo->izquierda = rotarIzquierda(nodo->izquierda);
-        return rotarDerecha(nodo);
+bool escribirArchivoPalabras(const string& ruta, const vector<VistaPalabra>& palabras) {
+    const string rutaTemporal = ruta + ".tmp";
+    ofstream archivo(rutaTemporal, ios::trunc);
+    if (!archivo.is_open()) return false;
+
+    string linea;
+    for (const VistaPalabra& p : palabras) {
+        linea.clear();
+        agregarCampoCSV(linea, p.espanol);
+        linea += ',';
+        agregarCampoCSV(linea, p.ingles);
+        linea += ',';
+        agregarCampoCSV(linea, p.aleman);
+        linea += ',';
+        agregarCampoCSV(linea, p.frances);
+        linea += ',';
+        agregarCampoCSV(linea, p.italiano);
+        linea += '\n';
+        archivo << linea;
     }
+    archivo.close();
+    if (!archivo) return false;
 
-    // Caso Derecha Derecha
-    if (balance < -1 && factorBalance(nodo->derecha) <= 0)
-        return rotarIzquierda(nodo);
+    error_code error;
+    fs::rename(rutaTemporal, ruta, error);
+    return !error;
+}
 
-    // Caso Derecha Izquierda
-    if (balance < -1 && factorBalance(nodo->derecha) > 0) {
-        nodo->derecha = rotarDerecha(nodo->derecha);
-        return rotarIzquierda(nodo);
+
+
+// Funcin que ejecuta el hilo de compactacin.
+//
+// Proceso:
+// 1. Lee el archivo base y le aplica el registro anterior (`rutaAnterior`).
+// 2. Escribe el resultado como nuevo archivo base y elimina el registro anterior.
+// 3. Guarda el resultado en `compactacionExitosa` y `registrosCompactados`.
+//
+// Notas:
+// - Solo trabaja con archivos: el rbol AVL puede seguir modificndose mientras tanto, porque
+//   los cambios nuevos se anotan en `rutaCambios`, que este hilo no toca.
+// - Si se interrumpe antes de eliminar el registro anterior, `recuperarCompactacion` lo vuelve
+//   a aplicar al cargar, lo cual no altera el resultado.
+
+void compactarRegistro() {
+    ArchivoPalabras archivo;
+    size_t registros = 0;
+    bool exito = false;
+
+    if (leerArchivoPalabras(registroCambios.rutaBase, archivo, registros)) {
+        aplicarCambios(registroCambios.rutaAnterior, archivo);
+        if (escribirArchivoPalabras(registroCambios.rutaBase, archivo.palabras)) {
+            error_code error;
+            fs::remove(registroCambios.rutaAnterior, error);
+            registroCambios.registrosCompactados = archivo.palabras.size();
+            exito = true;
+        }
     }
 
-    return nodo; // Retornar el nodo actual.
+    registroCambios.compactacionExitosa = exito;
+    registroCambios.compactando = false;
 }
 
 
 
+// Funcin para esperar a que termine la compactacin en curso (si la hay) y recoger su resultado.
+//
+// Notas:
+// - Se debe llamar antes de salir del programa, para no comprimir la carpeta con archivos a medio escribir.
+
+void esperarCompactacion() {
+    if (!registroCambios.compactador.joinable()) return;
 
-//==========================FUNCIONES DE COMPRESION==========================
+    registroCambios.compactador.join();
+    if (registroCambios.compactacionExitosa) {
+        registroCambios.registrosBase = registroCambios.registrosCompactados;
+        registroCambios.registrosAnterior = 0;
+    }
+}
 
 
 
-// Estructura para almacenar informacin de un archivo a comprimir.
-// Cada campo representa:
-// - rutaRelativa: Ruta del archivo relativa a la carpeta base de compresin.
-// - contenido: Vector de caracteres que contiene los datos binarios del archivo.
+// Funcin para comenzar una compactacin en segundo plano.
 //
-// Uso:
-// - Esta estructura se utiliza para recopilar y manipular los archivos que sern comprimidos
-//   y descomprimidos mediante el algoritmo de Huffman.
-
-struct ArchivoParaComprimir {
-    string rutaRelativa;      // Ruta relativa del archivo respecto a la carpeta base
-    vector<char> contenido;   // Contenido binario del archivo
-};
+// Proceso:
+// 1. Renombra el registro de cambios como registro anterior; los cambios siguientes van a un registro nuevo.
+// 2. Inicia el hilo `compactarRegistro`.
+//
+// Notas:
+// - Si qued un registro anterior de una compactacin fallida, no se inicia otra, para no sobrescribirlo;
+//   se incorpora al cargar el diccionario la prxima vez.
+
+void iniciarCompactacion() {
+    error_code error;
+    if (fs::exists(registroCambios.rutaAnterior, error)) return;
+    fs::rename(registroCambios.rutaCambios, registroCambios.rutaAnterior, error);
+    if (error) return;
+
+    registroCambios.registrosAnterior = registroCambios.registrosCambios;
+    registroCambios.registrosCambios = 0;
+    registroCambios.compactando = true;
+    registroCambios.compactador = thread(compactarRegistro);
+}
 
 
 
-// Funcin para leer completamente un archivo binario y devolver su contenido en un vector de caracteres.
+// Funcin para descartar la lnea incompleta con la que puede terminar un registro de cambios.
 //
 // Parmetros:
-// - ruta: Ruta completa del archivo que se desea leer.
+// - ruta: Ruta del registro.
 //
 // Retorno:
-// - Un vector de caracteres que contiene el contenido binario del archivo.
-//   Si el archivo no se puede abrir, retorna un vector vaco.
+// - true si el registro no existe o ya termina en un salto de lnea (o vaco), false si no se pudo recortar.
 //
 // Notas:
-// - Esta funcin se utiliza para cargar archivos que sern comprimidos o descomprimidos.
-// - El archivo se abre en modo binario para preservar todos los datos tal como estn en disco.
+// - Una ltima lnea sin salto de lnea es un registro que qued a medio escribir (el programa se cerr
+//   o fall la escritura). Si se dejara, el siguiente registro se escribira a continuacin de ella y
+//   ambos se perderan al aplicar el registro.
+// - Lee el archivo desde el final en bloques, por lo que solo recorre la ltima lnea.
+
+bool recortarLineaIncompleta(const string& ruta) {
+    error_code error;
+    uintmax_t tamano = fs::file_size(ruta, error);
+    if (error) return true; // El registro no existe.
+
+    ifstream archivo(ruta, ios::binary);
+    if (!archivo.is_open()) return false;
+
+    // Buscar el ltimo salto de lnea, leyendo bloques desde el final.
+    const size_t BLOQUE = 4096;
+    char datos[BLOQUE];
+    uintmax_t fin = tamano;
+    uintmax_t conservar = 0;
+    bool encontrado = false;
+    while (fin > 0 && !encontrado) {
+        size_t leer = static_cast<size_t>(min<uintmax_t>(BLOQUE, fin));
+        fin -= leer;
+        archivo.seekg(static_cast<streamoff>(fin));
+        if (!archivo.read(datos, leer)) return false;
+        for (size_t i = leer; i > 0; --i) {
+            if (datos[i - 1] == '\n') {
+                conservar = fin + i;
+                encontrado = true;
+                break;
+            }
+        }
+    }
+    archivo.close();
 
-vector<char> leerArchivo(const string& ruta) {
-    ifstream file(ruta, ios::binary);
-    if (!file) {
-        cerr << "No se pudo abrir archivo: " << ruta << "\n";
-        return {};
-    }
-    return vector<char>((istreambuf_iterator<char>(file)), istreambuf_iterator<char>());
+    if (conservar == tamano) return true;
+    fs::resize_file(ruta, conservar, error);
+    return !error;
 }
 
 
 
-// Funcin para guardar el contenido binario en un archivo.
+// Funcin para anotar un cambio al final del registro y compactar si hay demasiada basura.
 //
 // Parmetros:
-// - ruta: Ruta completa del archivo donde se desea guardar el contenido.
-// - contenido: Vector de caracteres que contiene los datos binarios a guardar.
+// - registro: Lnea que se desea anotar (sin el salto de lnea final).
+// - palabrasVivas: Cantidad de palabras del diccionario despus del cambio.
+// - cantidad: Cantidad de lneas de `registro`; las operaciones masivas anotan todos sus cambios de una vez,
+//   separados por saltos de lnea.
 //
 // Proceso:
-// 1. Abre el archivo en modo binario para escritura.
-// 2. Si no se puede abrir el archivo, muestra un mensaje de error y retorna.
-// 3. Escribe el contenido del vector en el archivo.
-// 4. Cierra el archivo.
+// 1. Agrega las lneas al final de `cambios.umg`; el costo no depende del tamao del diccionario.
+// 2. Si la compactacin anterior ya termin, recoge su resultado.
+// 3. Si no hay una compactacin en curso y los registros de basura superan UMBRAL_BASURA del total
+//    (o el registro de cambios supera al archivo base), inicia una compactacin.
 //
 // Notas:
-// - Esta funcin se utiliza para restaurar archivos durante la descompresin o para guardar archivos binarios generados.
-// - Si el archivo no se puede crear o abrir, no se realiza ninguna accin.
+// - Si la escritura falla, informa el error, no cuenta los registros y descarta lo que haya quedado
+//   escrito a medias (`recortarLineaIncompleta`), para que el prximo cambio empiece en una lnea nueva.
 
-void guardarArchivo(const string& ruta, const vector<char>& contenido) {
-    ofstream file(ruta, ios::binary);
-    if (!file) {
-        cerr << "No se pudo guardar archivo: " << ruta << "\n";
+void registrarCambio(const string& registro, size_t palabrasVivas, size_t cantidad = 1) {
+    ofstream archivo(registroCambios.rutaCambios, ios::app);
+    if (!archivo.is_open()) {
+        cerr << "Error al abrir el registro de cambios.\n";
         return;
     }
-    file.write(contenido.data(), contenido.size());
+    archivo << registro << "\n";
+    archivo.close();
+    if (!archivo) {
+        cerr << "Error al escribir el registro de cambios.\n";
+        recortarLineaIncompleta(registroCambios.rutaCambios);
+        return;
+    }
+    registroCambios.registrosCambios += cantidad;
+
+    if (registroCambios.compactando) return;
+    esperarCompactacion();
+
+    size_t pendientes = registroCambios.registrosAnterior + registroCambios.registrosCambios;
+    size_t total = registroCambios.registrosBase + pendientes;
+    size_t basura = total > palabrasVivas ? total - palabrasVivas : 0;
+    if (total >= RegistroCambios::MINIMO_REGISTROS &&
+        (basura > RegistroCambios::UMBRAL_BASURA * total || pendientes > registroCambios.registrosBase)) {
+        iniciarCompactacion();
+    }
 }
 
 
 
-// Funcin para recorrer una carpeta de forma recursiva y obtener todos los archivos que contiene,
-// almacenando su ruta relativa y su contenido binario en un vector de estructuras.
+// Funcin para agregar al final de un texto la lnea del registro de una palabra agregada.
 //
 // Parmetros:
-// - carpetaBase: Ruta de la carpeta base desde donde se inicia la bsqueda de archivos.
-// - archivos: Vector de estructuras ArchivoParaComprimir donde se almacenarn los archivos encontrados.
-//
-// Proceso:
-// 1. Utiliza un iterador recursivo para recorrer todos los archivos dentro de la carpeta base y sus subcarpetas.
-// 2. Para cada archivo regular encontrado:
-//    - Obtiene la ruta completa del archivo.
-//    - Calcula la ruta relativa respecto a la carpeta base.
-//    - Lee el contenido binario del archivo usando la funcin leerArchivo.
-//    - Agrega una estructura ArchivoParaComprimir al vector con la ruta relativa y el contenido.
+// - registro: Texto al que se agrega la lnea (sin el salto de lnea).
+// - p: Palabra agregada con sus traducciones.
+
+void agregarRegistroAgregada(string& registro, const VistaPalabra& p) {
+    registro += "+,";
+    agregarCampoCSV(registro, p.espanol);
+    registro += ',';
+    agregarCampoCSV(registro, p.ingles);
+    registro += ',';
+    agregarCampoCSV(registro, p.aleman);
+    registro += ',';
+    agregarCampoCSV(registro, p.frances);
+    registro += ',';
+    agregarCampoCSV(registro, p.italiano);
+}
+
+
+
+// Funcin para agregar al final de un texto la lnea del registro de una palabra eliminada.
 //
-// Notas:
-// - Solo se procesan archivos regulares (no carpetas).
-// - Esta funcin es utilizada para preparar los archivos antes de la compresin Huffman.
+// Parmetros:
+// - registro: Texto al que se agrega la lnea (sin el salto de lnea).
+// - espanol: Palabra en espaol eliminada.
 
-void obtenerArchivos(const string& carpetaBase, vector<ArchivoParaComprimir>& archivos) {
-    for (const auto& entry : fs::recursive_directory_iterator(carpetaBase)) {
-        if (fs::is_regular_file(entry.path())) {
-            string rutaCompleta = entry.path().string();
-            string rutaRelativa = fs::relative(entry.path(), carpetaBase).string();
-            vector<char> contenido = leerArchivo(rutaCompleta);
-            archivos.push_back({ rutaRelativa, contenido });
-        }
-    }
+void agregarRegistroEliminada(string& registro, string_view espanol) {
+    registro += "-,";
+    agregarCampoCSV(registro, espanol);
 }
 
 
 
-// Funcin para serializar un conjunto de archivos en un solo buffer binario.
-// El formato del buffer es:
-// [numArchivos][longRuta][ruta][tamContenido][contenido]...
+// Funcin para anotar una palabra agregada en el registro de cambios.
 //
 // Parmetros:
-// - archivos: Vector de estructuras ArchivoParaComprimir que contiene la ruta relativa y el contenido de cada archivo.
+// - p: Palabra agregada con sus traducciones.
+// - palabrasVivas: Cantidad de palabras del diccionario despus de agregarla.
+
+void registrarAgregada(const Palabra& p, size_t palabrasVivas) {
+    string registro;
+    agregarRegistroAgregada(registro, vistaDe(p));
+    registrarCambio(registro, palabrasVivas);
+}
+
+
+
+// Funcin para anotar una palabra eliminada (marca de eliminacin) en el registro de cambios.
 //
-// Retorno:
-// - Un vector de caracteres que representa el buffer binario serializado con todos los archivos.
+// Parmetros:
+// - espanol: Palabra en espaol eliminada.
+// - palabrasVivas: Cantidad de palabras del diccionario despus de eliminarla.
+
+void registrarEliminada(const string& espanol, size_t palabrasVivas) {
+    string registro;
+    agregarRegistroEliminada(registro, espanol);
+    registrarCambio(registro, palabrasVivas);
+}
+
+
+
+// Funcin para recuperar el registro anterior de una compactacin que no termin.
 //
 // Proceso:
-// 1. Inserta el nmero total de archivos al inicio del buffer.
-// 2. Para cada archivo:
-//    - Inserta la longitud de la ruta relativa.
-//    - Inserta la ruta relativa como cadena de caracteres.
-//    - Inserta el tamao del contenido binario.
-//    - Inserta el contenido binario del archivo.
+// 1. Descarta la posible lnea final incompleta de `cambios.umg` y de `cambios_anterior.umg`
+//    (`recortarLineaIncompleta`).
+// 2. Si existe `cambios_anterior.umg`, escribe su contenido seguido del de `cambios.umg` en un solo registro.
+// 3. Reemplaza `cambios.umg` con el resultado y elimina el registro anterior.
 //
 // Notas:
-// - Este buffer puede ser comprimido y almacenado, o deserializado posteriormente para reconstruir los archivos.
-// - El formato es compacto y permite reconstruir la estructura de archivos y carpetas original.
+// - Se llama al cargar, antes de aplicar los cambios, para que todos los registros pendientes estn
+//   en `cambios.umg` y en el orden en que ocurrieron, y para que el prximo cambio no se escriba a
+//   continuacin de una lnea incompleta.
 
-vector<char> serializarArchivos(const vector<ArchivoParaComprimir>& archivos) {
-    vector<char> buffer;
+void recuperarCompactacion() {
+    recortarLineaIncompleta(registroCambios.rutaCambios);
 
-    int numArchivos = static_cast<int>(archivos.size());
-    buffer.insert(buffer.end(), reinterpret_cast<char*>(&numArchivos), reinterpret_cast<char*>(&numArchivos) + sizeof(int));
+    error_code error;
+    if (!fs::exists(registroCambios.rutaAnterior, error)) return;
+    if (!recortarLineaIncompleta(registroCambios.rutaAnterior)) return;
 
-    for (const auto& archivo : archivos) {
-        int lenRuta = static_cast<int>(archivo.rutaRelativa.size());
-        buffer.insert(buffer.end(), reinterpret_cast<char*>(&lenRuta), reinterpret_cast<char*>(&lenRuta) + sizeof(int));
-        buffer.insert(buffer.end(), archivo.rutaRelativa.begin(), archivo.rutaRelativa.end());
+    ifstream anterior(registroCambios.rutaAnterior, ios::binary);
+    string contenido((istreambuf_iterator<char>(anterior)), istreambuf_iterator<char>());
+    anterior.close();
 
-        int tamContenido = static_cast<int>(archivo.contenido.size());
-        buffer.insert(buffer.end(), reinterpret_cast<char*>(&tamContenido), reinterpret_cast<char*>(&tamContenido) + sizeof(int));
-        buffer.insert(buffer.end(), archivo.contenido.begin(), archivo.contenido.end());
+    ifstream cambios(registroCambios.rutaCambios, ios::binary);
+    if (cambios.is_open()) {
+        contenido.append(istreambuf_iterator<char>(cambios), istreambuf_iterator<char>());
+        cambios.close();
     }
-    return buffer;
+
+    const string rutaTemporal = registroCambios.rutaCambios + ".tmp";
+    ofstream archivo(rutaTemporal, ios::binary | ios::trunc);
+    if (!archivo.is_open()) return;
+    archivo.write(contenido.data(), contenido.size());
+    archivo.close();
+    if (!archivo) return;
+
+    fs::rename(rutaTemporal, registroCambios.rutaCambios, error);
+    if (!error) fs::remove(registroCambios.rutaAnterior, error);
 }
 
 
 
-// Funcin para deserializar un buffer binario y reconstruir los archivos originales en una carpeta destino.
-// El buffer debe tener el formato: [numArchivos][longRuta][ruta][tamContenido][contenido]...
+
+//==========================FUNCIONES DEL FILTRO DE BLOOM==========================
+
+
+
+// Funcin para calcular el hash de 64 bits de una palabra para el filtro de Bloom.
 //
 // Parmetros:
-// - buffer: Vector de caracteres que contiene los datos serializados de los archivos.
-// - carpetaDestino: Ruta de la carpeta donde se restaurarn los archivos y carpetas.
-//
-// Proceso:
-// 1. Lee el nmero total de archivos almacenados en el buffer.
-// 2. Para cada archivo:
-//    - Lee la longitud de la ruta relativa y la ruta relativa.
-//    - Lee el tamao del contenido y el contenido binario.
-//    - Crea las carpetas necesarias en la ruta destino.
-//    - Guarda el contenido en la ruta correspondiente usando la funcin guardarArchivo.
+// - clave: Palabra en espaol.
 //
-// Notas:
-// - Si el buffer est corrupto o incompleto, lanza una excepcin.
-// - Esta funcin se utiliza durante la descompresin para restaurar la estructura original de archivos y carpetas.
-
-void deserializarYReconstruir(const vector<char>& buffer, const string& carpetaDestino) {
-    size_t pos = 0;
+// Retorno:
+// - FNV-1a de 64 bits de la palabra, con una mezcla final para repartir los bits altos y bajos.
 
-    auto leerInt = [&](int& val) {
-        if (pos + sizeof(int) > buffer.size()) throw runtime_error("Buffer corrupto");
-        val = *reinterpret_cast<const int*>(&buffer[pos]);
-        pos += sizeof(int);
-        };
+uint64_t hashFiltro(string_view clave) {
+    uint64_t hash = 14695981039346656037ull;
+    for (char c : clave) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ull;
+    }
+    hash ^= hash >> 33;
+    hash *= 0xFF51AFD7ED558CCDull;
+    hash ^= hash >> 33;
+    return hash;
+}
 
-    int numArchivos = 0;
-    leerInt(numArchivos);
 
-    for (int i = 0; i < numArchivos; i++) {
-        int lenRuta = 0;
-        leerInt(lenRuta);
 
-        if (pos + lenRuta > buffer.size()) throw runtime_error("Buffer corrupto");
-        string ruta(buffer.begin() + pos, buffer.begin() + pos + lenRuta);
-        pos += lenRuta;
+// Funcin para calcular cuntos bits se marcan por palabra.
+//
+// Parmetros:
+// - bitsPorClave: Bits del filtro por palabra.
+//
+// Retorno:
+// - bitsPorClave * ln 2 redondeado (la cantidad que minimiza los falsos positivos), entre 1 y 16.
 
-        int tamContenido = 0;
-        leerInt(tamContenido);
+uint32_t funcionesFiltro(uint32_t bitsPorClave) {
+    uint32_t funciones = static_cast<uint32_t>(bitsPorClave * 0.693 + 0.5);
+    return max(1u, min(funciones, 16u));
+}
 
-        if (pos + tamContenido > buffer.size()) throw runtime_error("Buffer corrupto");
-        vector<char> contenido(buffer.begin() + pos, buffer.begin() + pos + tamContenido);
-        pos += tamContenido;
 
-        // Crear carpetas necesarias
-        fs::path rutaCompleta = fs::path(carpetaDestino) / ruta;
-        fs::create_directories(rutaCompleta.parent_path());
 
-        // Guardar archivo
-        guardarArchivo(rutaCompleta.string(), contenido);
+// Funcin para saber si una palabra puede estar en un filtro de Bloom.
+//
+// Parmetros:
+// - bloques: Bits del filtro (el del diccionario o uno mapeado desde el diccionario binario).
+// - cantidadBloques: Cantidad de bloques de FiltroBloom::PALABRAS_POR_BLOQUE enteros.
+// - funciones: Bits marcados por palabra.
+// - clave: Palabra en espaol.
+//
+// Retorno:
+// - false si la palabra seguro no est; true si puede estar (o si el filtro est vaco).
+//
+// Proceso:
+// 1. Elige el bloque con los 32 bits altos del hash (multiplicacin en lugar de mdulo).
+// 2. Deriva las posiciones de los bits dentro del bloque con doble hash (a + i * b) y verifica que
+//    todos estn marcados. Como el bloque ocupa una sola lnea de cach, la consulta lee memoria una vez.
+
+bool filtroPuedeContener(const uint64_t* bloques, size_t cantidadBloques, uint32_t funciones, string_view clave) {
+    if (cantidadBloques == 0) return true;
+
+    uint64_t hash = hashFiltro(clave);
+    const uint64_t* bloque = bloques + ((hash >> 32) * cantidadBloques >> 32) * FiltroBloom::PALABRAS_POR_BLOQUE;
+    uint64_t mezcla = hash * 0x9E3779B97F4A7C15ull;
+    uint32_t a = static_cast<uint32_t>(mezcla);
+    uint32_t b = static_cast<uint32_t>(mezcla >> 32) | 1;
+    for (uint32_t i = 0; i < funciones; ++i) {
+        uint32_t bit = (a + i * b) & 511;
+        if (!(bloque[bit >> 6] & (1ull << (bit & 63)))) return false;
     }
+    return true;
 }
 
 
 
-// Estructura para representar un nodo del rbol de Huffman utilizado en la compresin de archivos.
-// Cada nodo puede ser una hoja (carcter y frecuencia) o un nodo interno (suma de frecuencias).
-//
-// Campos:
-// - c: Carcter representado por el nodo (solo vlido en hojas; '\0' en nodos internos).
-// - freq: Frecuencia total de aparicin del carcter o suma de frecuencias de los hijos.
-// - izq: Puntero al hijo izquierdo del nodo Huffman.
-// - der: Puntero al hijo derecho del nodo Huffman.
+// Funcin para saber si una palabra puede estar en el diccionario, segn el filtro global.
 //
-// Constructores:
-// - NodoHuffman(char c, int freq): Crea una hoja con un carcter y su frecuencia.
-// - NodoHuffman(NodoHuffman* izq, NodoHuffman* der): Crea un nodo interno a partir de dos hijos.
+// Parmetros:
+// - clave: Palabra en espaol.
 //
-// Uso:
-// - Esta estructura se utiliza para construir el rbol de Huffman necesario para la codificacin y decodificacin de datos binarios.
-
-struct NodoHuffman {
-    char c;                // Carcter (solo vlido en hojas)
-    int freq;              // Frecuencia del carcter o suma de frecuencias
-    NodoHuffman* izq;      // Puntero al hijo izquierdo
-    NodoHuffman* der;      // Puntero al hijo derecho
+// Retorno:
+// - false si la palabra seguro no est en `tablaPalabras`; true si puede estar.
 
-    NodoHuffman(char c, int freq) : c(c), freq(freq), izq(nullptr), der(nullptr) {}
-    NodoHuffman(NodoHuffman* izq, NodoHuffman* der)
-        : c('\0'), freq(izq->freq + der->freq), izq(izq), der(der) {
-    }
-};
+inline bool puedeExistir(string_view clave) {
+    const FiltroBloom& filtro = filtroBloom;
+    return filtroPuedeContener(filtro.bloques.data(), filtro.bloques.size() / FiltroBloom::PALABRAS_POR_BLOQUE, filtro.funciones, clave);
+}
 
 
 
-// Estructura comparadora para nodos de Huffman utilizada en la priority_queue.
-// Compara dos punteros a NodoHuffman segn su frecuencia (freq).
-// El nodo con menor frecuencia tendr mayor prioridad (menor freq sale primero).
+// Funcin para agregar una palabra a un filtro de Bloom.
 //
-// Uso:
-// - Esta estructura se utiliza como comparador en la cola de prioridad (priority_queue)
-//   para construir el rbol de Huffman de manera eficiente.
-
-struct CompareNodo {
-    bool operator()(NodoHuffman* a, NodoHuffman* b) {
-        return a->freq > b->freq;
+// Parmetros:
+// - bloques, cantidadBloques, funciones: Filtro (ver `filtroPuedeContener`); debe tener al menos un bloque.
+// - clave: Palabra en espaol.
+
+void marcarEnFiltro(uint64_t* bloques, size_t cantidadBloques, uint32_t funciones, string_view clave) {
+    uint64_t hash = hashFiltro(clave);
+    uint64_t* bloque = bloques + ((hash >> 32) * cantidadBloques >> 32) * FiltroBloom::PALABRAS_POR_BLOQUE;
+    uint64_t mezcla = hash * 0x9E3779B97F4A7C15ull;
+    uint32_t a = static_cast<uint32_t>(mezcla);
+    uint32_t b = static_cast<uint32_t>(mezcla >> 32) | 1;
+    for (uint32_t i = 0; i < funciones; ++i) {
+        uint32_t bit = (a + i * b) & 511;
+        bloque[bit >> 6] |= 1ull << (bit & 63);
     }
-};
+}
 
 
 
-// Funcin para construir el rbol de Huffman a partir de un mapa de frecuencias de caracteres.
-// Utiliza una cola de prioridad (priority_queue) para combinar los nodos de menor frecuencia.
+// Funcin para calcular cuntos bloques necesita un filtro.
 //
 // Parmetros:
-// - freq: Mapa que asocia cada carcter con su frecuencia de aparicin.
+// - capacidad: Palabras que debe admitir.
+// - bitsPorClave: Bits por palabra.
 //
 // Retorno:
-// - Un puntero a la raz del rbol de Huffman construido.
-//
-// Proceso:
-// 1. Crea un nodo hoja para cada carcter y lo inserta en la cola de prioridad.
-// 2. Mientras haya ms de un nodo en la cola:
-//    - Extrae los dos nodos con menor frecuencia.
-//    - Crea un nuevo nodo interno con estos dos nodos como hijos y la suma de sus frecuencias.
-//    - Inserta el nuevo nodo en la cola.
-// 3. El nodo restante en la cola es la raz del rbol de Huffman.
-//
-// Notas:
-// - El rbol de Huffman se utiliza para la compresin y descompresin eficiente de datos binarios.
+// - La cantidad de bloques de 512 bits (al menos uno).
 
-NodoHuffman* construirArbol(const map<char, int>& freq) {
-    priority_queue<NodoHuffman*, vector<NodoHuffman*>, CompareNodo> pq;
-    for (auto& p : freq) {
-        pq.push(new NodoHuffman(p.first, p.second));
-    }
-    while (pq.size() > 1) {
-        NodoHuffman* a = pq.top(); pq.pop();
-        NodoHuffman* b = pq.top(); pq.pop();
-        pq.push(new NodoHuffman(a, b));
-    }
-    return pq.top();
+size_t bloquesFiltro(size_t capacidad, uint32_t bitsPorClave) {
+    return max<size_t>(1, (capacidad * bitsPorClave + 511) / 512);
 }
 
 
 
-// Funcin para construir la tabla de cdigos Huffman a partir del rbol de Huffman.
-// Asigna a cada carcter una cadena de bits nica segn el recorrido del rbol.
+// Funcin para reconstruir el filtro global con todas las palabras de `tablaPalabras`.
 //
 // Parmetros:
-// - nodo: Puntero al nodo actual del rbol de Huffman.
-// - codigo: Cadena que representa el cdigo binario acumulado hasta el nodo actual.
-// - tabla: Mapa donde se almacenarn los cdigos Huffman generados para cada carcter.
+// - nuevas: Palabras que se agregarn enseguida (por ejemplo, al cargar el diccionario), para dejar lugar.
 //
 // Proceso:
-// 1. Si el nodo es nulo, retorna (caso base).
-// 2. Si el nodo es una hoja (no tiene hijos), asigna el cdigo acumulado al carcter del nodo.
-// 3. Llama recursivamente para el hijo izquierdo agregando '0' al cdigo.
-// 4. Llama recursivamente para el hijo derecho agregando '1' al cdigo.
+// 1. Dimensiona el filtro para las palabras existentes y las nuevas, ms un margen de un cuarto
+//    (y al menos 1024 palabras) para no reconstruirlo en cada agregado.
+// 2. Marca las palabras de todas las posiciones de la tabla que no estn libres.
 //
 // Notas:
-// - Esta funcin se utiliza para generar los cdigos Huffman necesarios para la compresin y descompresin de datos.
-
-void construirCodigos(NodoHuffman* nodo, const string& codigo, map<char, string>& tabla) {
-    if (!nodo) return;
-    if (!nodo->izq && !nodo->der) { // Es una hoja
-        tabla[nodo->c] = codigo;
+// - Se llama cuando el filtro se llena (`anotarClaveNueva`), cuando acumula muchas eliminadas
+//   (`anotarClaveEliminada`) y cuando cambian los bits por palabra (`configurarFiltro`).
+
+void reconstruirFiltro(size_t nuevas = 0) {
+    FiltroBloom& filtro = filtroBloom;
+    vector<bool> libre(tablaPalabras.palabras.size(), false);
+    for (uint32_t entrada : tablaPalabras.libres) libre[entrada] = true;
+    size_t vivas = tablaPalabras.palabras.size() - tablaPalabras.libres.size();
+
+    size_t cantidadBloques = bloquesFiltro((vivas + nuevas) + (vivas + nuevas) / 4 + 1024, filtro.bitsPorClave);
+    filtro.funciones = funcionesFiltro(filtro.bitsPorClave);
+    filtro.bloques.assign(cantidadBloques * FiltroBloom::PALABRAS_POR_BLOQUE, 0);
+    filtro.capacidad = cantidadBloques * 512 / filtro.bitsPorClave;
+    filtro.claves = vivas;
+    filtro.eliminadas = 0;
+
+    for (size_t entrada = 0; entrada < tablaPalabras.palabras.size(); ++entrada) {
+        if (libre[entrada]) continue;
+        marcarEnFiltro(filtro.bloques.data(), cantidadBloques, filtro.funciones, cadenaDe(tablaPalabras.palabras[entrada].espanol));
     }
-    construirCodigos(nodo->izq, codigo + "0", tabla);
-    construirCodigos(nodo->der, codigo + "1", tabla);
 }
 
 
 
-// Funcin para liberar la memoria utilizada por un rbol binario (como el rbol de Huffman).
+// Funcin para agregar al filtro global una palabra recin guardada en `tablaPalabras`.
 //
 // Parmetros:
-// - nodo: Puntero al nodo raz del rbol a liberar.
-//
-// Proceso:
-// 1. Llama recursivamente a la funcin para liberar el subrbol izquierdo.
-// 2. Llama recursivamente a la funcin para liberar el subrbol derecho.
-// 3. Elimina el nodo actual.
+// - clave: Palabra en espaol.
 //
 // Notas:
-// - Es importante llamar a esta funcin para evitar fugas de memoria cuando se termina de usar el rbol.
+// - Se llama desde `crearNodo`. Si el filtro est lleno, lo reconstruye ms grande (la palabra ya
+//   est en la tabla, por lo que queda incluida).
 
-void liberarArbol(NodoHuffman* nodo) {
-    if (!nodo) return;
-    liberarArbol(nodo->izq);
-    liberarArbol(nodo->der);
-    delete nodo;
+void anotarClaveNueva(string_view clave) {
+    FiltroBloom& filtro = filtroBloom;
+    if (filtro.claves >= filtro.capacidad) {
+        reconstruirFiltro();
+        return;
+    }
+    marcarEnFiltro(filtro.bloques.data(), filtro.bloques.size() / FiltroBloom::PALABRAS_POR_BLOQUE, filtro.funciones, clave);
+    ++filtro.claves;
 }
 
 
 
-// Funcin para comprimir un buffer de datos utilizando el algoritmo de Huffman y guardar el resultado en un archivo binario.
+// Funcin para anotar en el filtro global que se elimin una palabra.
 //
-// Parmetros:
-// - buffer: Vector de caracteres que contiene los datos originales a comprimir.
-// - archivoSalida: Ruta del archivo donde se guardar el resultado comprimido.
+// Notas:
+// - Se llama desde `liberarEntrada`, con la posicin ya libre. Los bits de la palabra no se pueden
+//   borrar; cuando las eliminadas superan un cuarto de la capacidad, el filtro se reconstruye sin ellas.
+
+void anotarClaveEliminada() {
+    FiltroBloom& filtro = filtroBloom;
+    if (filtro.bloques.empty()) return;
+    if (++filtro.eliminadas > filtro.capacidad / 4) reconstruirFiltro();
+}
+
+
+
+// Funcin para cambiar los bits por palabra del filtro global y reconstruirlo.
+//
+// Parmetros:
+// - bitsPorClave: Bits por palabra (entre 1 y 64). Con b bits por palabra, la tasa de falsos
+//   positivos es de aproximadamente 0.6185^b (10 bits: ~1 %, 16 bits: ~0.05 %).
+//
+// Notas:
+// - El valor se guarda con el diccionario binario, por lo que se conserva en las prximas sesiones.
+
+void configurarFiltro(uint32_t bitsPorClave) {
+    filtroBloom.bitsPorClave = max(1u, min(bitsPorClave, 64u));
+    reconstruirFiltro();
+}
+
+
+
+
+//===========================FUNCIONES DEL RBOL AVL==========================
+
+
+
+// Funcin para obtener la referencia a un nodo a partir de su ndice en el pool.
+//
+// Parmetros:
+// - nodo: ndice del nodo (distinto de 0).
+//
+// Retorno:
+// - Una referencia al nodo almacenado en el bloque correspondiente.
+//
+// Notas:
+// - Los bloques nunca se mueven, por lo que la referencia sigue siendo vlida aunque se creen
+//   nodos nuevos, hasta que se llame a `liberarPoolNodos`.
+
+inline Nodo& nodoEn(uint32_t nodo) {
+    return poolNodos.bloques[nodo >> PoolNodos::BITS_POR_BLOQUE][nodo & (PoolNodos::NODOS_POR_BLOQUE - 1)];
+}
+
+
+
+// Funcin para obtener la palabra y sus traducciones asociadas a un nodo.
+//
+// Parmetros:
+// - nodo: ndice del nodo (distinto de 0).
+//
+// Retorno:
+// - Una referencia a la palabra (con los identificadores de sus cadenas) almacenada en `tablaPalabras`.
+
+inline const PalabraInterna& palabraDe(uint32_t nodo) {
+    return tablaPalabras.palabras[nodoEn(nodo).entrada];
+}
+
+
+
+// Funcin para empaquetar los primeros 8 bytes de una palabra en un entero de 64 bits.
+//
+// Parmetros:
+// - clave: Palabra que se desea empaquetar.
+//
+// Retorno:
+// - Un entero cuyo byte ms significativo es el primer carcter de la palabra.
+//   Si la palabra tiene menos de 8 caracteres, los bytes restantes quedan en 0.
+//
+// Notas:
+// - Comparar dos prefijos como enteros da el mismo resultado que comparar las palabras,
+//   salvo cuando los prefijos son iguales; en ese caso se deben comparar las palabras completas.
+
+uint64_t prefijoClave(string_view clave) {
+    uint64_t prefijo = 0;
+    size_t largo = clave.size() < 8 ? clave.size() : 8;
+    for (size_t i = 0; i < 8; ++i) {
+        prefijo <<= 8;
+        if (i < largo) prefijo |= static_cast<unsigned char>(clave[i]);
+    }
+    return prefijo;
+}
+
+
+
+// Funcin para comparar una palabra con la palabra almacenada en un nodo.
+//
+// Parmetros:
+// - clave: Palabra en espaol que se desea comparar.
+// - prefijo: Prefijo de `clave` calculado con `prefijoClave`.
+// - nodo: ndice del nodo contra el que se compara.
+//
+// Retorno:
+// - Un nmero negativo si `clave` es menor que la palabra del nodo, 0 si son iguales
+//   y un nmero positivo si es mayor.
+//
+// Notas:
+// - Solo se lee la palabra completa cuando los prefijos son iguales.
+
+inline int compararClave(string_view clave, uint64_t prefijo, uint32_t nodo) {
+    uint64_t prefijoNodo = nodoEn(nodo).prefijo;
+    if (prefijo != prefijoNodo) return prefijo < prefijoNodo ? -1 : 1;
+    return clave.compare(cadenaDe(palabraDe(nodo).espanol));
+}
+
+
+
+// Funcin para obtener el identificador de la traduccin de una palabra en un idioma.
+//
+// Parmetros:
+// - p: Palabra interna almacenada en `tablaPalabras`.
+// - idioma: Idioma de la traduccin (ver `Idioma`).
+//
+// Retorno:
+// - El identificador de la cadena en el pool de cadenas.
+
+inline uint32_t traduccionDe(const PalabraInterna& p, int idioma) {
+    switch (idioma) {
+    case IDIOMA_INGLES: return p.ingles;
+    case IDIOMA_ALEMAN: return p.aleman;
+    case IDIOMA_FRANCES: return p.frances;
+    default: return p.italiano;
+    }
+}
+
+
+
+// Funcin para obtener el campo de la traduccin de una palabra en un idioma, para modificarlo.
+//
+// Parmetros:
+// - p: Palabra interna almacenada en `tablaPalabras`.
+// - idioma: Idioma de la traduccin (ver `Idioma`).
+//
+// Retorno:
+// - Una referencia al identificador de la traduccin (ver `cargarColumna`).
+
+inline uint32_t& traduccionDe(PalabraInterna& p, int idioma) {
+    switch (idioma) {
+    case IDIOMA_INGLES: return p.ingles;
+    case IDIOMA_ALEMAN: return p.aleman;
+    case IDIOMA_FRANCES: return p.frances;
+    default: return p.italiano;
+    }
+}
+
+
+
+// Funcin para tomar un nodo del pool de nodos e inicializarlo como hoja.
+//
+// Parmetros:
+// - prefijo: Prefijo de la clave del nodo (ver `prefijoClave`).
+// - entrada: Posicin de la palabra en `tablaPalabras`.
+//
+// Retorno:
+// - El ndice del nodo reservado.
+//
+// Proceso:
+// 1. Si hay nodos liberados en la lista de libres, reutiliza el primero.
+// 2. Si no, toma el siguiente espacio disponible del ltimo bloque.
+// 3. Si el ltimo bloque est lleno, reserva un bloque nuevo de NODOS_POR_BLOQUE nodos.
+// 4. Inicializa el nodo como hoja (sin hijos, con tamao 1 y altura 1).
+//
+// Notas:
+// - Reservar los nodos en bloques evita miles de asignaciones dispersas en el heap al cargar
+//   el diccionario y mantiene los nodos del rbol cerca unos de otros en memoria.
+// - La posicin 0 del primer bloque nunca se entrega, porque el ndice 0 representa un nodo nulo.
+// - El rbol principal y los ndices inversos toman sus nodos del mismo pool.
+
+uint32_t reservarNodo(uint64_t prefijo, uint32_t entrada) {
+    uint32_t nodo;
+    if (poolNodos.libres) {
+        // Reutilizar un nodo liberado anteriormente.
+        nodo = poolNodos.libres;
+        poolNodos.libres = nodoEn(nodo).izquierda;
+    }
+    else {
+        // Reservar un bloque nuevo si el actual ya est lleno.
+        if (poolNodos.usadosUltimoBloque == PoolNodos::NODOS_POR_BLOQUE) {
+            poolNodos.bloques.push_back(new Nodo[PoolNodos::NODOS_POR_BLOQUE]);
+            poolNodos.usadosUltimoBloque = poolNodos.bloques.size() == 1 ? 1 : 0; // Saltar el ndice 0.
+        }
+        nodo = static_cast<uint32_t>((poolNodos.bloques.size() - 1) << PoolNodos::BITS_POR_BLOQUE)
+            + poolNodos.usadosUltimoBloque++;
+    }
+
+    Nodo& n = nodoEn(nodo);
+    n.prefijo = prefijo;
+    n.izquierda = 0;
+    n.derecha = 0;
+    n.entrada = entrada;
+    n.tamano = 1;
+    n.altura = 1;
+
+    poolNodos.vivos++;
+    return nodo;
+}
+
+
+
+// Funcin para guardar una palabra nueva en la tabla de palabras.
+//
+// Parmetros:
+// - p: Vistas de la palabra (sus cadenas se copian al pool).
+//
+// Retorno:
+// - La posicin de la palabra en `tablaPalabras`.
+//
+// Proceso:
+// 1. Guarda las cadenas de la palabra en el pool de cadenas y la palabra interna en
+//    `tablaPalabras`, reutilizando una posicin libre si la hay.
+// 2. Agrega la palabra en espaol al filtro de Bloom (`anotarClaveNueva`).
+//
+// Notas:
+// - La usan `crearNodo` y la tabla hash de palabras (ver `agregarHash`); la posicin se devuelve con `liberarEntrada`.
+
+uint32_t crearEntrada(const VistaPalabra& p) {
+    PalabraInterna interna = internarPalabra(p);
+
+    uint32_t entrada;
+    if (!tablaPalabras.libres.empty()) {
+        // Reutilizar la posicin de una palabra eliminada.
+        entrada = tablaPalabras.libres.back();
+        tablaPalabras.libres.pop_back();
+        tablaPalabras.palabras[entrada] = interna;
+    }
+    else {
+        entrada = static_cast<uint32_t>(tablaPalabras.palabras.size());
+        tablaPalabras.palabras.push_back(interna);
+    }
+    anotarClaveNueva(p.espanol);
+    return entrada;
+}
+
+
+
+// Funcin para crear un nuevo nodo del rbol AVL utilizando el pool de nodos.
+//
+// Parmetros:
+// - p: Vistas de la palabra que se almacenar en la tabla de palabras (sus cadenas se copian al pool).
+//
+// Retorno:
+// - El ndice del nodo creado.
+//
+// Proceso:
+// 1. Guarda la palabra en `tablaPalabras` con `crearEntrada`.
+// 2. Reserva el nodo con `reservarNodo`, usando como prefijo el de la palabra en espaol.
+
+uint32_t crearNodo(const VistaPalabra& p) {
+    uint32_t entrada = crearEntrada(p);
+    return reservarNodo(prefijoClave(p.espanol), entrada);
+}
+
+
+
+// Funcin para devolver una palabra de la tabla de palabras para que su posicin se reutilice.
+//
+// Parmetros:
+// - entrada: Posicin de la palabra en `tablaPalabras`.
+//
+// Notas:
+// - La posicin queda en la lista de libres. Las cadenas permanecen en el pool de cadenas,
+//   porque otras palabras pueden estar compartindolas.
+// - La palabra se anota como eliminada en el filtro de Bloom (`anotarClaveEliminada`).
+
+void liberarEntrada(uint32_t entrada) {
+    tablaPalabras.libres.push_back(entrada);
+    anotarClaveEliminada();
+}
+
+
+
+// Funcin para devolver un nodo al pool de nodos.
+//
+// Parmetros:
+// - nodo: ndice del nodo que se desea liberar.
+//
+// Proceso:
+// 1. Agrega el nodo al inicio de la lista de libres para reutilizarlo, enlazndolo con su campo `izquierda`.
+//
+// Notas:
+// - La memoria no se devuelve al sistema; queda disponible para el siguiente `crearNodo`.
+// - La palabra asociada no se libera aqu; de eso se encarga `eliminarPalabra` con `liberarEntrada`,
+//   porque al eliminar un nodo con dos hijos la palabra del sucesor pasa a otro nodo.
+
+void destruirNodo(uint32_t nodo) {
+    if (!nodo) return;
+
+    nodoEn(nodo).izquierda = poolNodos.libres;
+    poolNodos.libres = nodo;
+    poolNodos.vivos--;
+}
+
+
+
+// Funcin para liberar todos los nodos del rbol AVL y los bloques del pool.
+//
+// Proceso:
+// 1. Libera todos los bloques reservados de una sola vez.
+// 2. Reinicia el pool para que pueda volver a utilizarse y deja vacos los ndices inversos.
+// 3. Vaca la tabla de palabras y el pool de cadenas.
+//
+// Notas:
+// - Como los nodos no contienen cadenas, no es necesario recorrer el rbol para liberarlos.
+// - Despus de llamar a esta funcin, todos los ndices de nodos quedan invlidos.
+
+void liberarPoolNodos() {
+    // Liberar los bloques completos.
+    for (Nodo* bloque : poolNodos.bloques) {
+        delete[] bloque;
+    }
+
+    poolNodos.bloques.clear();
+    poolNodos.usadosUltimoBloque = PoolNodos::NODOS_POR_BLOQUE;
+    poolNodos.libres = 0;
+    poolNodos.vivos = 0;
+
+    for (int idioma = 0; idioma < CANTIDAD_IDIOMAS; ++idioma) {
+        raicesInversas[idioma] = 0;
+        columnasIdiomas.indexada[idioma] = false;
+    }
+    automataFrases.vigente = false;
+    indicePonderado.vigente = false;
+    indiceNormalizado.vigente = false;
+
+    // Las traducciones comprimidas corresponden a posiciones de `tablaPalabras`.
+    for (ColumnaComprimida& columna : columnasIdiomas.comprimidas) {
+        columna = ColumnaComprimida();
+    }
+
+    // La cach de bsquedas guarda posiciones de `tablaPalabras`.
+    cacheBusquedas.ranuras.clear();
+    cacheBusquedas.posiciones.clear();
+    cacheBusquedas.libres.clear();
+    cacheBusquedas.manecilla = 0;
+
+    // El filtro de Bloom queda vaco (deja pasar todo) hasta que se agreguen palabras.
+    filtroBloom.bloques.clear();
+    filtroBloom.bloques.shrink_to_fit();
+    filtroBloom.capacidad = 0;
+    filtroBloom.claves = 0;
+    filtroBloom.eliminadas = 0;
+
+    tablaPalabras.palabras.clear();
+    tablaPalabras.palabras.shrink_to_fit();
+    tablaPalabras.libres.clear();
+
+    poolCadenas.texto.clear();
+    poolCadenas.texto.shrink_to_fit();
+    poolCadenas.tabla.clear();
+    poolCadenas.tabla.shrink_to_fit();
+    poolCadenas.ocupados = 0;
+}
+
+
+
+// Funcin para obtener la altura de un nodo en el rbol AVL.
+//
+// Parmetros:
+// - nodo: ndice del nodo del cual se desea obtener la altura.
+//
+// Retorno:
+// - Un entero que representa la altura del nodo.
+//   - Si el nodo es nulo, retorna 0 (altura de un rbol vaco).
+//   - Si el nodo no es nulo, retorna el valor almacenado en el campo `altura`.
+//
+// Notas:
+// - La altura de un nodo es la longitud del camino ms largo desde ese nodo hasta una hoja.
+// - Esta funcin es utilizada para calcular el balance de los nodos y mantener el rbol AVL balanceado.
+
+int altura(uint32_t nodo) {
+    if (!nodo) return 0; // Caso base: un nodo nulo tiene altura 0.
+    return nodoEn(nodo).altura; // Retornar la altura almacenada en el nodo.
+}
+
+
+
+// Funcin para calcular el factor de balance de un nodo en el rbol AVL.
+//
+// Parmetros:
+// - nodo: ndice del nodo del cual se desea calcular el factor de balance.
+//
+// Retorno:
+// - Un entero que representa el factor de balance del nodo.
+//   - Si el nodo es nulo, retorna 0.
+//   - Si el nodo no es nulo, retorna la diferencia entre la altura del subrbol izquierdo
+//     y la altura del subrbol derecho.
+//
+// Notas:
+// - El factor de balance se utiliza para determinar si un nodo est balanceado:
+//   - Un nodo est balanceado si el factor de balance est en el rango [-1, 1].
+//   - Si el factor de balance es menor que -1 o mayor que 1, el rbol necesita ser re-balanceado.
+// - Esta funcin es clave para mantener las propiedades del rbol AVL.
+
+int factorBalance(uint32_t nodo) {
+    if (!nodo) return 0; // Caso base: un nodo nulo tiene factor de balance 0.
+    return altura(nodoEn(nodo).izquierda) - altura(nodoEn(nodo).derecha); // Diferencia de alturas.
+}
+
+
+
+// Funcin para obtener la cantidad de nodos de un subrbol.
+//
+// Parmetros:
+// - nodo: ndice del nodo raz del subrbol.
+//
+// Retorno:
+// - La cantidad de nodos del subrbol, o 0 si el nodo es nulo.
+
+uint32_t tamano(uint32_t nodo) {
+    if (!nodo) return 0; // Caso base: un subrbol vaco no tiene nodos.
+    return nodoEn(nodo).tamano;
+}
+
+
+
+// Funcin para actualizar la altura (y el tamao del subrbol) de un nodo en el rbol AVL.
+//
+// Parmetros:
+// - nodo: ndice del nodo cuya altura se desea actualizar.
+//
+// Proceso:
+// 1. Verifica si el nodo es nulo. Si lo es, no realiza ninguna accin.
+// 2. Calcula la nueva altura del nodo como:
+//    - 1 + la altura mxima entre el subrbol izquierdo y el subrbol derecho.
+// 3. Asigna el valor calculado al campo `altura` del nodo.
+// 4. Recalcula el campo `tamano` como 1 + el tamao de ambos subrboles.
+//
+// Notas:
+// - Esta funcin debe ser llamada despus de realizar operaciones que puedan modificar
+//   la estructura del rbol, como inserciones, eliminaciones o rotaciones.
+// - Mantener actualizada la altura de los nodos es esencial para calcular el factor de balance
+//   y garantizar que el rbol AVL permanezca balanceado.
+// - Como el tamao depende de los mismos hijos que la altura, ambos se actualizan juntos y las
+//   rotaciones y el balanceo no necesitan cambios adicionales.
+
+void actualizarAltura(uint32_t nodo) {
+    if (!nodo) return; // Caso base: si el nodo es nulo, no hace nada.
+
+    // Calcular la nueva altura y el nuevo tamao del nodo.
+    Nodo& n = nodoEn(nodo);
+    n.altura = static_cast<uint32_t>(1 + max(altura(n.izquierda), altura(n.derecha)));
+    n.tamano = 1 + tamano(n.izquierda) + tamano(n.derecha);
+}
+
+
+
+// Funcin para realizar una rotacin a la derecha en un rbol AVL.
+//
+// Parmetros:
+// - y: ndice del nodo que ser rotado hacia la derecha.
+//
+// Retorno:
+// - El ndice del nuevo nodo raz despus de la rotacin.
+//
+// Proceso:
+// 1. Identifica el nodo izquierdo (`x`) como el nuevo nodo raz.
+// 2. Almacena el subrbol derecho de `x` (denominado `T2`) temporalmente.
+// 3. Realiza la rotacin:
+//    - El nodo `x` se convierte en la nueva raz.
+//    - El nodo `y` pasa a ser el hijo derecho de `x`.
+//    - El subrbol `T2` se asigna como el hijo izquierdo de `y`.
+// 4. Actualiza las alturas de los nodos afectados (`y` y `x`) y cuenta la rotacin (ver `ContadoresAVL`).
+//
+// Notas:
+// - Esta operacin se utiliza para re-balancear el rbol AVL cuando el subrbol izquierdo
+//   de un nodo est desbalanceado (caso de rotacin simple derecha).
+// - Mantiene las propiedades del rbol AVL (balance y orden).
+
+uint32_t rotarDerecha(uint32_t y) {
+    uint32_t x = nodoEn(y).izquierda; // El nuevo nodo raz ser el hijo izquierdo.
+    uint32_t T2 = nodoEn(x).derecha;  // Almacena temporalmente el subrbol derecho de `x`.
+
+    // Realizar la rotacin.
+    nodoEn(x).derecha = y;
+    nodoEn(y).izquierda = T2;
+
+    // Actualizar las alturas de los nodos afectados.
+    actualizarAltura(y);
+    actualizarAltura(x);
+    CONTAR_AVL(contadoresAVL.rotacionesDerecha.fetch_add(1, memory_order_relaxed));
+
+    // Retornar el nuevo nodo raz.
+    return x;
+}
+
+
+
+// Funcin para realizar una rotacin a la izquierda en un rbol AVL.
+//
+// Parmetros:
+// - x: ndice del nodo que ser rotado hacia la izquierda.
+//
+// Retorno:
+// - El ndice del nuevo nodo raz despus de la rotacin.
+//
+// Proceso:
+// 1. Identifica el nodo derecho (`y`) como el nuevo nodo raz.
+// 2. Almacena el subrbol izquierdo de `y` (denominado `T2`) temporalmente.
+// 3. Realiza la rotacin:
+//    - El nodo `y` se convierte en la nueva raz.
+//    - El nodo `x` pasa a ser el hijo izquierdo de `y`.
+//    - El subrbol `T2` se asigna como el hijo derecho de `x`.
+// 4. Actualiza las alturas de los nodos afectados (`x` y `y`) y cuenta la rotacin (ver `ContadoresAVL`).
+//
+// Notas:
+// - Esta operacin se utiliza para re-balancear el rbol AVL cuando el subrbol derecho
+//   de un nodo est desbalanceado (caso de rotacin simple izquierda).
+// - Mantiene las propiedades del rbol AVL (balance y orden).
+
+uint32_t rotarIzquierda(uint32_t x) {
+    uint32_t y = nodoEn(x).derecha; // El nuevo nodo raz ser el hijo derecho.
+    uint32_t T2 = nodoEn(y).izquierda; // Almacena temporalmente el subrbol izquierdo de `y`.
+
+    // Realizar la rotacin.
+    nodoEn(y).izquierda = x;
+    nodoEn(x).derecha = T2;
+
+    // Actualizar las alturas de los nodos afectados.
+    actualizarAltura(x);
+    actualizarAltura(y);
+    CONTAR_AVL(contadoresAVL.rotacionesIzquierda.fetch_add(1, memory_order_relaxed));
+
+    // Retornar el nuevo nodo raz.
+    return y;
+}
+
+
+
+// Funcin para actualizar la altura de un nodo y corregir su desbalance con las rotaciones necesarias.
+//
+// Parmetros:
+// - nodo: ndice del nodo (distinto de 0) cuyo subrbol acaba de modificarse.
+//
+// Retorno:
+// - El ndice de la raz del subrbol despus de balancearlo.
+//
+// Proceso:
+// 1. Actualiza la altura del nodo y calcula su factor de balance.
+// 2. Decide el caso segn el factor de balance del hijo ms alto:
+//    - Caso Izquierda Izquierda: Rotacin derecha.
+//    - Caso Izquierda Derecha: Rotacin izquierda en el hijo izquierdo, luego rotacin derecha.
+//    - Caso Derecha Derecha: Rotacin izquierda.
+//    - Caso Derecha Izquierda: Rotacin derecha en el hijo derecho, luego rotacin izquierda.
+//
+// Notas:
+// - Como no depende de la clave, sirve tanto para el rbol principal como para los ndices inversos.
+
+uint32_t rebalancear(uint32_t nodo) {
+    // Actualizar la altura del nodo actual.
+    actualizarAltura(nodo);
+
+    // Calcular el factor de balance del nodo actual.
+    int balance = factorBalance(nodo);
+
+    // Verificar y corregir el desbalance si es necesario.
+    // Caso Izquierda Izquierda
+    if (balance > 1 && factorBalance(nodoEn(nodo).izquierda) >= 0)
+        return rotarDerecha(nodo);
+
+    // Caso Izquierda Derecha
+    if (balance > 1 && factorBalance(nodoEn(nodo).izquierda) < 0) {
+        nodoEn(nodo).izquierda = rotarIzquierda(nodoEn(nodo).izquierda);
+        return rotarDerecha(nodo);
+    }
+
+    // Caso Derecha Derecha
+    if (balance < -1 && factorBalance(nodoEn(nodo).derecha) <= 0)
+        return rotarIzquierda(nodo);
+
+    // Caso Derecha Izquierda
+    if (balance < -1 && factorBalance(nodoEn(nodo).derecha) > 0) {
+        nodoEn(nodo).derecha = rotarDerecha(nodoEn(nodo).derecha);
+        return rotarIzquierda(nodo);
+    }
+
+    return nodo; // Retornar el nodo actual.
+}
+
+
+
+// Funciones para mantener los ndices inversos al agregar o eliminar palabras
+// (definidas en la seccin de ndices inversos).
+void indexarTraducciones(uint32_t entrada);
+void desindexarTraducciones(uint32_t entrada);
+
+
+
+// Funcin para insertar un nuevo nodo en el rbol AVL.
+//
+// Parmetros:
+// - nodo: ndice del nodo raz del rbol donde se realizar la insercin.
+// - nuevaPalabra: Objeto de tipo `Palabra` que contiene la palabra en espaol y sus traducciones.
+//
+// Retorno:
+// - El ndice del nodo raz actualizado despus de la insercin.
+//
+// Proceso:
+// 1. Si el nodo actual es nulo, crea un nuevo nodo (tomado del pool de nodos) con la palabra proporcionada,
+//    agrega sus traducciones a los ndices inversos (`indexarTraducciones`) y lo retorna.
+// 2. Compara la palabra en espaol de `nuevaPalabra` con la palabra del nodo actual
+//    (primero por el prefijo guardado en el nodo, ver `compararClave`):
+//    - Si es menor, realiza la insercin en el subrbol izquierdo.
+//    - Si es mayor, realiza la insercin en el subrbol derecho.
+//    - Si es igual, no realiza la insercin (no se permiten duplicados).
+// 3. Actualiza la altura del nodo actual despus de la insercin.
+// 4. Calcula el factor de balance del nodo actual para verificar si est balanceado.
+// 5. Si el nodo est desbalanceado, aplica las rotaciones necesarias segn el caso:
+//    - Caso Izquierda Izquierda: Rotacin derecha.
+//    - Caso Derecha Derecha: Rotacin izquierda.
+//    - Caso Izquierda Derecha: Rotacin izquierda en el hijo izquierdo, luego rotacin derecha.
+//    - Caso Derecha Izquierda: Rotacin derecha en el hijo derecho, luego rotacin izquierda.
+//
+// Notas:
+// - Esta funcin asegura que el rbol AVL permanezca balanceado despus de cada insercin.
+// - Las rotaciones mantienen las propiedades del rbol AVL (balance y orden).
+
+uint32_t insertar(uint32_t nodo, const Palabra& nuevaPalabra) {
+    // Caso base: si el nodo es nulo, crea un nuevo nodo con la palabra y la agrega a los ndices inversos.
+    if (!nodo) {
+        CONTAR_AVL(++contadoresAVL.inserciones);
+        uint32_t nuevo = crearNodo(vistaDe(nuevaPalabra));
+        indexarTraducciones(nodoEn(nuevo).entrada);
+        return nuevo;
+    }
+
+    const string& clave = nuevaPalabra.espanol;
+    uint64_t prefijo = prefijoClave(clave);
+
+    // Comparar la palabra en espaol para decidir la direccin de la insercin.
+    CONTAR_AVL(++contadoresAVL.comparacionesInsercion);
+    int comparacion = compararClave(clave, prefijo, nodo);
+    if (comparacion < 0)
+        nodoEn(nodo).izquierda = insertar(nodoEn(nodo).izquierda, nuevaPalabra); // Insertar en el subrbol izquierdo.
+    else if (comparacion > 0)
+        nodoEn(nodo).derecha = insertar(nodoEn(nodo).derecha, nuevaPalabra); // Insertar en el subrbol derecho.
+    else {
+        CONTAR_AVL(++contadoresAVL.repetidas);
+        return nodo; // No se permiten duplicados.
+    }
+
+    // Actualizar la altura del nodo actual.
+    actualizarAltura(nodo);
+
+    // Calcular el factor de balance del nodo actual.
+    int balance = factorBalance(nodo);
+
+    // Verificar y corregir el desbalance si es necesario.
+    // Caso Izquierda Izquierda
+    if (balance > 1 && compararClave(clave, prefijo, nodoEn(nodo).izquierda) < 0)
+        return rotarDerecha(nodo);
+
+    // Caso Derecha Derecha
+    if (balance < -1 && compararClave(clave, prefijo, nodoEn(nodo).derecha) > 0)
+        return rotarIzquierda(nodo);
+
+    // Caso Izquierda Derecha
+    if (balance > 1 && compararClave(clave, prefijo, nodoEn(nodo).izquierda) > 0) {
+        nodoEn(nodo).izquierda = rotarIzquierda(nodoEn(nodo).izquierda);
+        return rotarDerecha(nodo);
+    }
+
+    // Caso Derecha Izquierda
+    if (balance < -1 && compararClave(clave, prefijo, nodoEn(nodo).derecha) < 0) {
+        nodoEn(nodo).derecha = rotarDerecha(nodoEn(nodo).derecha);
+        return rotarIzquierda(nodo);
+    }
+
+    // Retornar el nodo actual si no hubo desbalance.
+    return nodo;
+}
+
+
+
+// Funcin para buscar una palabra en el rbol AVL.
+//
+// Parmetros:
+// - raiz: ndice del nodo raz del rbol donde se realizar la bsqueda.
+// - palabraBuscada: Cadena que contiene la palabra en espaol que se desea buscar.
+//
+// Retorno:
+// - El ndice del nodo que contiene la palabra buscada.
+// - Si la palabra no se encuentra en el rbol, retorna 0.
+//
+// Proceso:
+// 1. Consulta el filtro de Bloom (`puedeExistir`): si la palabra seguro no existe, retorna 0 sin
+//    recorrer el rbol. Si no, calcula una sola vez el prefijo de la palabra buscada.
+// 2. Desde la raz, compara la palabra buscada con la palabra en espaol del nodo actual:
+//    - Si es igual, retorna el nodo actual.
+//    - Si es menor, contina la bsqueda en el subrbol izquierdo.
+//    - Si es mayor, contina la bsqueda en el subrbol derecho.
+// 3. Si llega a un nodo nulo, la palabra no est en el rbol.
+//
+// Notas:
+// - Esta funcin utiliza la propiedad de orden del rbol AVL para realizar la bsqueda de manera eficiente.
+// - La bsqueda tiene una complejidad de O(log n) en promedio, donde `n` es el nmero de nodos en el rbol.
+// - Gracias al prefijo guardado en cada nodo, la mayora de las comparaciones no leen la palabra completa.
+
+uint32_t buscar(uint32_t raiz, const string& palabraBuscada) {
+    CONTAR_AVL(++contadoresAVL.busquedas);
+    if (!puedeExistir(palabraBuscada)) {
+        CONTAR_AVL(++contadoresAVL.descartadasPorFiltro);
+        return 0;
+    }
+    uint64_t prefijo = prefijoClave(palabraBuscada);
+    CONTAR_AVL(uint64_t comparaciones = 0);
+
+    // Descender hasta encontrar la palabra o llegar a un nodo nulo (0: la palabra no est en el rbol).
+    while (raiz) {
+        CONTAR_AVL(++comparaciones);
+        int comparacion = compararClave(palabraBuscada, prefijo, raiz);
+        if (comparacion == 0)
+            break;
+
+        // Decidir la direccin de la bsqueda.
+        raiz = comparacion < 0 ? nodoEn(raiz).izquierda : nodoEn(raiz).derecha;
+    }
+
+    CONTAR_AVL(contadoresAVL.comparacionesBusqueda += comparaciones);
+    CONTAR_AVL(contadoresAVL.profundidadMaximaBusqueda = max(contadoresAVL.profundidadMaximaBusqueda, comparaciones));
+    return raiz;
+}
+
+
+
+// Estructura con el estado de un recorrido dentro de una bsqueda por lotes.
+//
+// Campos:
+// - prefijo: Prefijo de la palabra buscada (ver `prefijoClave`).
+// - nodo: Nodo en el que se encuentra el recorrido.
+// - consulta: Posicin de la palabra buscada dentro del lote.
+// - etapa: 0 si falta comparar el prefijo del nodo; 1 o 2 si el prefijo coincidi y se est
+//   esperando la palabra de la tabla (1) o su texto (2) para compararla completa.
+
+struct RecorridoLote {
+    uint64_t prefijo;
+    uint32_t nodo;
+    uint32_t consulta;
+    uint32_t etapa;
+};
+
+
+
+// Funcin para buscar muchas palabras en el rbol AVL avanzando varios recorridos a la vez.
+//
+// Parmetros:
+// - raiz: ndice del nodo raz del rbol.
+// - palabras: Arreglo con las palabras en espaol que se desean buscar.
+// - cantidad: Cantidad de palabras del arreglo.
+// - resultados: Arreglo de `cantidad` posiciones donde se escribe, para cada palabra, el ndice de su
+//   nodo o 0 si no est en el rbol (el mismo resultado que `buscar`).
+//
+// Proceso:
+// 1. Mantiene hasta RECORRIDOS_POR_LOTE bsquedas en curso y las avanza por turnos, un paso cada una.
+// 2. En cada paso compara el prefijo del nodo actual, baja al hijo que corresponde y pide a la cach
+//    ese hijo (`_mm_prefetch`); cuando vuelve a tocarle el turno, el nodo normalmente ya lleg.
+// 3. Si el prefijo coincide, pide la palabra de la tabla y luego su texto en turnos sucesivos,
+//    y recin entonces compara la palabra completa.
+// 4. Cuando una bsqueda termina, su lugar lo toma la siguiente palabra del arreglo.
+//
+// Notas:
+// - Con una sola bsqueda, cada nivel del rbol espera a que llegue el nodo desde la memoria.
+//   Al intercalar varias, esas esperas se superponen y el costo por palabra baja en rboles grandes.
+// - Conviene para traducir textos completos o repetir bsquedas registradas, donde las palabras son
+//   independientes entre s.
+
+void buscarLote(uint32_t raiz, const string* palabras, size_t cantidad, uint32_t* resultados) {
+    const size_t RECORRIDOS_POR_LOTE = 16;
+    RecorridoLote recorridos[RECORRIDOS_POR_LOTE];
+    size_t activos = 0;
+    size_t siguiente = 0;
+
+    if (!raiz) {
+        fill(resultados, resultados + cantidad, 0u);
+        return;
+    }
+
+    // Iniciar los primeros recorridos desde la raz.
+    while (activos < RECORRIDOS_POR_LOTE && siguiente < cantidad) {
+        recorridos[activos++] = { prefijoClave(palabras[siguiente]), raiz, static_cast<uint32_t>(siguiente), 0 };
+        ++siguiente;
+    }
+
+    while (activos) {
+        size_t i = 0;
+        while (i < activos) {
+            RecorridoLote& r = recorridos[i];
+            const Nodo& n = nodoEn(r.nodo);
+            int comparacion;
+
+            if (r.etapa == 0 && r.prefijo != n.prefijo) {
+                comparacion = r.prefijo < n.prefijo ? -1 : 1;
+            }
+            else if (r.etapa == 0) {
+                // El prefijo coincide: pedir la palabra y compararla en otro turno.
+                _mm_prefetch(reinterpret_cast<const char*>(&tablaPalabras.palabras[n.entrada]), _MM_HINT_T0);
+                r.etapa = 1;
+                ++i;
+                continue;
+            }
+            else if (r.etapa == 1) {
+                // Pedir el texto de la palabra.
+                _mm_prefetch(poolCadenas.texto.data() + tablaPalabras.palabras[n.entrada].espanol, _MM_HINT_T0);
+                r.etapa = 2;
+                ++i;
+                continue;
+            }
+            else {
+                comparacion = string_view(palabras[r.consulta]).compare(cadenaDe(tablaPalabras.palabras[n.entrada].espanol));
+                r.etapa = 0;
+            }
+
+            uint32_t hijo = comparacion < 0 ? n.izquierda : n.derecha;
+            if (comparacion != 0 && hijo) {
+                // Bajar un nivel y pedir el nodo para el siguiente turno.
+                r.nodo = hijo;
+                _mm_prefetch(reinterpret_cast<const char*>(&nodoEn(hijo)), _MM_HINT_T0);
+                ++i;
+                continue;
+            }
+
+            // La bsqueda termin: guardar el resultado y dar el lugar a la siguiente palabra.
+            resultados[r.consulta] = comparacion == 0 ? r.nodo : 0;
+            if (siguiente < cantidad) {
+                r = { prefijoClave(palabras[siguiente]), raiz, static_cast<uint32_t>(siguiente), 0 };
+                ++siguiente;
+                ++i;
+            }
+            else {
+                r = recorridos[--activos];
+            }
+        }
+    }
+}
+
+
+
+// Funcin para construir un rbol AVL perfectamente balanceado a partir de palabras ordenadas.
+//
+// Parmetros:
+// - palabras: Vistas de las palabras, ordenadas alfabticamente por `espanol` y sin duplicados.
+// - inicio: ndice de la primera palabra del rango a construir.
+// - fin: ndice siguiente a la ltima palabra del rango (rango semiabierto [inicio, fin)).
+//
+// Retorno:
+// - El ndice de la raz del subrbol construido, o 0 si el rango est vaco.
+//
+// Proceso:
+// 1. Si el rango est vaco, retorna 0.
+// 2. Toma la palabra del medio del rango como raz del subrbol.
+// 3. Construye recursivamente el subrbol izquierdo con la mitad izquierda del rango
+//    y el subrbol derecho con la mitad derecha.
+// 4. Calcula la altura del nodo a partir de las alturas de sus hijos.
+//
+// Notas:
+// - Cada palabra se visita una sola vez, por lo que la construccin es O(n), sin comparaciones
+//   ni rotaciones.
+// - Las mitades difieren como mximo en un elemento, por lo que el rbol resultante cumple
+//   la propiedad AVL y sus alturas quedan correctas.
+
+uint32_t construirBalanceado(const vector<VistaPalabra>& palabras, size_t inicio, size_t fin) {
+    if (inicio >= fin) return 0; // Caso base: rango vaco.
+
+    size_t medio = inicio + (fin - inicio) / 2;
+    uint32_t nodo = crearNodo(palabras[medio]);
+    uint32_t izquierda = construirBalanceado(palabras, inicio, medio);
+    uint32_t derecha = construirBalanceado(palabras, medio + 1, fin);
+    nodoEn(nodo).izquierda = izquierda;
+    nodoEn(nodo).derecha = derecha;
+
+    // Actualizar la altura del nodo a partir de sus hijos.
+    actualizarAltura(nodo);
+    return nodo;
+}
+
+
+
+// Funcin para cargar palabras desde un archivo y construir el rbol AVL.
+//
+// Retorno:
+// - El ndice del nodo raz del rbol AVL construido a partir de las palabras en el archivo.
+// - Si el archivo no se puede abrir, retorna 0.
+//
+// Proceso:
+// 1. Lee el archivo `palabras.umg` con `leerArchivoPalabras`, que deja las palabras ordenadas y sin repetir
+//    sin copiar su texto (cada palabra apunta a los bloques ledos del archivo).
+// 2. Si el archivo no se puede abrir, muestra un mensaje de error y retorna 0.
+// 3. Recupera el registro de una compactacin interrumpida (`recuperarCompactacion`) y aplica a las
+//    palabras los cambios anotados en `cambios.umg` (`aplicarCambios`).
+// 4. Construye el rbol balanceado de una sola vez con `construirBalanceado`.
+// 5. Marca las traducciones de todos los idiomas como cargadas; los ndices inversos se construyen
+//    la primera vez que se usan (ver `asegurarIndiceInverso`).
+// 6. Retorna el ndice de la raz del rbol.
+//
+// Notas:
+// - El archivo debe estar ubicado en la ruta `C:\\traductor\\palabras.umg`.
+// - Cada lnea del archivo debe tener el formato: `espanol,ingles,aleman,frances,italiano`; un campo
+//   entre comillas puede contener comas. Las lneas mal formadas se informan y se omiten.
+// - Con palabras repetidas se conserva la primera aparicin, igual que al usar `insertar`.
+// - Los cambios se aplican antes de construir el rbol, por lo que cargar no depende de cuntos
+//   cambios haya pendientes de compactar ms all de leerlos.
+// - Si el archivo est vaco, la funcin retorna un rbol vaco (0).
+
+uint32_t cargarPalabras() {
+    ArchivoPalabras archivo;
+    size_t registros = 0;
+    if (!leerArchivoPalabras(registroCambios.rutaBase, archivo, registros)) {
+        cerr << "Error al abrir el archivo: " << registroCambios.rutaBase << endl;
+        return 0;
+    }
+
+    // Aplicar los cambios registrados desde la ltima compactacin.
+    recuperarCompactacion();
+    registroCambios.registrosBase = registros;
+    registroCambios.registrosAnterior = 0;
+    registroCambios.registrosCambios = aplicarCambios(registroCambios.rutaCambios, archivo);
+
+    // Construir el rbol balanceado en tiempo lineal, directamente desde el texto ledo.
+    const vector<VistaPalabra>& palabras = archivo.palabras;
+    tablaPalabras.palabras.reserve(tablaPalabras.palabras.size() + palabras.size());
+    reconstruirFiltro(palabras.size()); // Dimensionar el filtro de Bloom una sola vez para todas las palabras
+    uint32_t raiz = construirBalanceado(palabras, 0, palabras.size());
+
+    // Todas las traducciones quedan cargadas; los ndices inversos se construyen cuando se usan.
+    for (int idioma = 0; idioma < CANTIDAD_IDIOMAS; ++idioma) {
+        columnasIdiomas.cargada[idioma] = true;
+    }
+    columnasIdiomas.pendientes = 0;
+    return raiz; // Retornar la raz del rbol AVL.
+}
+
+
+
+// Funcin para agregar una nueva palabra al rbol AVL y al registro de cambios.
+//
+// Parmetros:
+// - raiz: ndice del nodo raz del rbol AVL donde se agregar la nueva palabra.
+//
+// Retorno:
+// - El ndice del nodo raz actualizado despus de agregar la nueva palabra.
+//
+// Proceso:
+// 1. Solicita al usuario que ingrese la palabra en espaol y sus traducciones (ingls, alemn, francs, italiano).
+// 2. Crea un objeto `Palabra` con los datos ingresados por el usuario.
+// 3. Inserta la nueva palabra en el rbol AVL utilizando la funcin `insertar`.
+// 4. Si la palabra no exista, la anota al final de `cambios.umg` con `registrarAgregada` y muestra un mensaje de xito.
+//
+// Notas:
+// - Si la palabra ya existe, no se modifica el rbol ni el registro.
+// - Anotar el cambio no depende del tamao del diccionario; el archivo `palabras.umg` se actualiza
+//   despus, al compactar el registro en segundo plano.
+
+uint32_t agregarPalabra(uint32_t raiz) {
+    Palabra nuevaPalabra;
+
+    // Solicitar al usuario los datos de la nueva palabra.
+    cout << "\nIngrese la palabra en espanol: ";
+    cin >> nuevaPalabra.espanol;
+    cout << "Ingrese la traduccion en ingles: ";
+    cin >> nuevaPalabra.ingles;
+    cout << "Ingrese la traduccion en aleman: ";
+    cin >> nuevaPalabra.aleman;
+    cout << "Ingrese la traduccion en frances: ";
+    cin >> nuevaPalabra.frances;
+    cout << "Ingrese la traduccion en italiano: ";
+    cin >> nuevaPalabra.italiano;
+
+    // Agregar la nueva palabra al rbol AVL.
+    size_t antes = tamano(raiz);
+    raiz = insertar(raiz, nuevaPalabra);
+    if (tamano(raiz) == antes) {
+        cout << "La palabra ya existe en el diccionario.\n";
+        return raiz;
+    }
+
+    // Anotar la palabra en el registro de cambios.
+    registrarAgregada(nuevaPalabra, tamano(raiz));
+
+    cout << "Palabra agregada con exito.\n"; // Mostrar mensaje de xito.
+    return raiz; // Retornar la raz actualizada.
+}
+
+
+
+// Funcin para encontrar el nodo con la clave mnima en un rbol AVL.
+//
+// Parmetros:
+// - nodo: ndice del nodo raz del rbol o subrbol donde se buscar el nodo mnimo.
+//
+// Retorno:
+// - El ndice del nodo que contiene la clave mnima en el rbol o subrbol.
+//
+// Proceso:
+// 1. Comienza desde el nodo raz proporcionado.
+// 2. Itera hacia el hijo izquierdo de cada nodo, ya que en un rbol binario de bsqueda
+//    el nodo con la clave mnima siempre se encuentra en el extremo izquierdo.
+// 3. Retorna el nodo ms a la izquierda encontrado.
+//
+// Notas:
+// - Esta funcin se utiliza principalmente en operaciones como eliminacin de nodos
+//   para encontrar el sucesor en caso de que el nodo a eliminar tenga dos hijos.
+// - El rbol o subrbol no debe estar vaco (nodo distinto de 0).
+// - La complejidad de esta funcin es O(h), donde `h` es la altura del rbol o subrbol.
+
+uint32_t minimo(uint32_t nodo) {
+    // Iterar hacia el hijo izquierdo hasta encontrar el nodo ms a la izquierda.
+    while (nodoEn(nodo).izquierda) {
+        nodo = nodoEn(nodo).izquierda;
+    }
+    return nodo; // Retornar el nodo con la clave mnima.
+}
+
+
+
+// Funcin para obtener los nodos de un rbol en inorden (orden de sus claves).
+//
+// Parmetros:
+// - raiz: ndice del nodo raz del rbol.
+// - nodos: Vector donde se agregan los ndices de los nodos en orden.
+//
+// Notas:
+// - Utiliza una pila explcita en lugar de recursin, por lo que no depende de la pila del programa.
+// - Sirve tanto para el rbol principal como para los ndices inversos.
+
+void recorrerInorden(uint32_t raiz, vector<uint32_t>& nodos) {
+    vector<uint32_t> pila;
+    uint32_t actual = raiz;
+
+    while (actual || !pila.empty()) {
+        // Bajar por la izquierda guardando el camino.
+        while (actual) {
+            pila.push_back(actual);
+            actual = nodoEn(actual).izquierda;
+        }
+        actual = pila.back();
+        pila.pop_back();
+        nodos.push_back(actual);
+        actual = nodoEn(actual).derecha;
+    }
+}
+
+
+
+// Funcin para eliminar una palabra del rbol AVL.
+//
+// Parmetros:
+// - nodo: ndice del nodo raz del rbol o subrbol donde se realizar la eliminacin.
+// - palabra: Cadena que contiene la palabra en espaol que se desea eliminar.
+// - liberarPalabra: Si es true, la palabra eliminada se quita de los ndices inversos y se libera
+//   de `tablaPalabras`. Se usa false
+//   nicamente al eliminar el sucesor en el Caso 3, porque su palabra pasa al nodo actual.
+//
+// Retorno:
+// - El ndice del nodo raz actualizado despus de la eliminacin.
+//
+// Proceso:
+// 1. Realiza una bsqueda normal en el rbol AVL para encontrar el nodo que contiene la palabra:
+//    - Si la palabra es menor que la palabra del nodo actual, busca en el subrbol izquierdo.
+//    - Si la palabra es mayor, busca en el subrbol derecho.
+//    - Si encuentra el nodo, procede con la eliminacin.
+// 2. Elimina el nodo segn los siguientes casos:
+//    - Caso 1: El nodo no tiene hijos (es una hoja). Elimina el nodo y lo reemplaza con 0.
+//    - Caso 2: El nodo tiene un solo hijo. Reemplaza el nodo con su nico hijo y lo elimina.
+//    - Caso 3: El nodo tiene dos hijos. Encuentra el sucesor en el subrbol derecho (el nodo con la clave mnima),
+//      toma su palabra (solo la posicin en la tabla y el prefijo), y elimina el sucesor recursivamente.
+// 3. Despus de eliminar el nodo, actualiza la altura del nodo actual y aplica las rotaciones
+//    necesarias con `rebalancear`.
+//
+// Notas:
+// - Esta funcin asegura que el rbol AVL permanezca balanceado despus de cada eliminacin.
+// - Las rotaciones mantienen las propiedades del rbol AVL (balance y orden).
+
+uint32_t eliminarPalabra(uint32_t nodo, string_view palabra, bool liberarPalabra = true) {
+    if (!nodo) {
+        CONTAR_AVL(++contadoresAVL.noEncontradas);
+        return nodo; // Caso base: el nodo es nulo.
+    }
+
+    // Bsqueda normal en el rbol AVL.
+    CONTAR_AVL(++contadoresAVL.comparacionesEliminacion);
+    int comparacion = compararClave(palabra, prefijoClave(palabra), nodo);
+    if (comparacion < 0)
+        nodoEn(nodo).izquierda = eliminarPalabra(nodoEn(nodo).izquierda, palabra, liberarPalabra); // Buscar en el subrbol izquierdo.
+    else if (comparacion > 0)
+        nodoEn(nodo).derecha = eliminarPalabra(nodoEn(nodo).derecha, palabra, liberarPalabra); // Buscar en el subrbol derecho.
+    else {
+        // Nodo encontrado.
+        CONTAR_AVL(if (liberarPalabra) ++contadoresAVL.eliminaciones);
+        Nodo& actual = nodoEn(nodo);
+        if (!actual.izquierda || !actual.derecha) {
+            // Caso 1 y Caso 2: El nodo tiene 0 o 1 hijo.
+            if (liberarPalabra) {
+                desindexarTraducciones(actual.entrada);
+                liberarEntrada(actual.entrada);
+            }
+            uint32_t temp = actual.izquierda ? actual.izquierda : actual.derecha;
+            if (!temp) {
+                // Caso 1: Nodo sin hijos.
+                temp = nodo;
+                nodo = 0;
+            }
+            else {
+                // Caso 2: Nodo con un solo hijo.
+                actual = nodoEn(temp); // Reemplazar el nodo actual con su nico hijo.
+            }
+            destruirNodo(temp); // Devolver el nodo al pool.
+        }
+        else {
+            // Caso 3: Nodo con dos hijos.
+            uint32_t temp = minimo(actual.derecha); // Encontrar el sucesor (mnimo en el subrbol derecho).
+            if (liberarPalabra) {
+                desindexarTraducciones(actual.entrada);
+                liberarEntrada(actual.entrada);
+            }
+            actual.entrada = nodoEn(temp).entrada; // Tomar la palabra del sucesor.
+            actual.prefijo = nodoEn(temp).prefijo;
+            actual.derecha = eliminarPalabra(actual.derecha, cadenaDe(palabraDe(nodo).espanol), false); // Eliminar el sucesor.
+        }
+    }
+
+    // Si el rbol est vaco despus de la eliminacin.
+    if (!nodo) return nodo;
+
+    // Actualizar la altura y corregir el desbalance si es necesario.
+    return rebalancear(nodo);
+}
+
+
+
+// Funcin auxiliar para validar un subrbol en inorden (ver `validarArbol`).
+//
+// Parmetros:
+// - nodo: ndice de la raz del subrbol.
+// - profundidad: Profundidad de `nodo` (la raz del rbol tiene profundidad 1).
+// - anterior: ltimo nodo visitado en inorden (0 al comenzar); se actualiza.
+// - resumen: Resultado que se va completando.
+//
+// Retorno:
+// - La altura real del subrbol.
+
+int validarSubarbol(uint32_t nodo, size_t profundidad, uint32_t& anterior, ResumenArbol& resumen) {
+    if (!nodo) return 0;
+
+    const Nodo& actual = nodoEn(nodo);
+    int alturaIzquierda = validarSubarbol(actual.izquierda, profundidad + 1, anterior, resumen);
+
+    auto anotarError = [&resumen, nodo](const string& error) {
+        if (resumen.errores++ == 0) resumen.primerError = error + " en el nodo " + to_string(nodo);
+    };
+
+    // Orden: cada palabra debe ser mayor que la anterior en inorden, y el prefijo debe ser el de la palabra.
+    if (actual.entrada >= tablaPalabras.palabras.size()) {
+        anotarError("posicion de la palabra fuera de la tabla");
+    }
+    else {
+        string_view clave = cadenaDe(palabraDe(nodo).espanol);
+        if (anterior && cadenaDe(palabraDe(anterior).espanol) >= clave) {
+            anotarError("orden incorrecto (\"" + string(clave) + "\")");
+        }
+        if (actual.prefijo != prefijoClave(clave)) {
+            anotarError("prefijo incorrecto (\"" + string(clave) + "\")");
+        }
+        anterior = nodo;
+    }
+
+    int alturaDerecha = validarSubarbol(actual.derecha, profundidad + 1, anterior, resumen);
+    int alturaReal = 1 + max(alturaIzquierda, alturaDerecha);
+
+    // Balance, altura y tamao guardados.
+    if (abs(alturaIzquierda - alturaDerecha) > 1) anotarError("desbalance de " + to_string(alturaIzquierda - alturaDerecha));
+    if (actual.altura != alturaReal) anotarError("altura guardada " + to_string(actual.altura) + " en lugar de " + to_string(alturaReal));
+    if (actual.tamano != 1 + tamano(actual.izquierda) + tamano(actual.derecha)) anotarError("tamano incorrecto");
+
+    ++resumen.nodos;
+    resumen.sumaProfundidades += profundidad;
+    return alturaReal;
+}
+
+
+
+// Funcin para verificar que un rbol cumple las invariantes del rbol AVL.
+//
+// Parmetros:
+// - raiz: ndice del nodo raz del rbol principal.
+// - resumen: Variable donde se guardan la cantidad de nodos, la altura, la profundidad y los errores.
+//
+// Retorno:
+// - true si el rbol cumple todas las invariantes, false en caso contrario.
+//
+// Proceso:
+// - Recorre el rbol completo (O(n)) y verifica en cada nodo:
+//   1. Orden de bsqueda: las palabras en inorden estn en orden alfabtico estricto (sin repetidas).
+//   2. El prefijo guardado es el de su palabra y la palabra est dentro de `tablaPalabras`.
+//   3. Balance AVL: las alturas reales de sus subrboles difieren como mximo en 1.
+//   4. La altura y el tamao guardados coinciden con los reales.
+//
+// Notas:
+// - Sirve para comprobar que las operaciones (tambin las masivas) dejan el rbol balanceado; se usa en el
+//   benchmark y en el men de medicin de rendimiento.
+
+bool validarArbol(uint32_t raiz, ResumenArbol& resumen) {
+    resumen = ResumenArbol();
+    uint32_t anterior = 0;
+    resumen.altura = validarSubarbol(raiz, 1, anterior, resumen);
+    return resumen.errores == 0;
+}
+
+
+
+
+//==========================FUNCIONES DE LOS NDICES INVERSOS==========================
+
+
+
+// Estructura con la clave de una palabra dentro de un ndice inverso.
+// Los ndices inversos se ordenan por la traduccin y, entre traducciones iguales, por la palabra
+// en espaol, que es nica; as dos palabras con la misma traduccin ("banco" y "orilla" en ingls
+// pueden compartir "bank") ocupan nodos distintos.
+//
+// Campos:
+// - traduccion: Traduccin de la palabra en el idioma del ndice.
+// - prefijo: Prefijo de la traduccin calculado con `prefijoClave`.
+// - espanol: Palabra en espaol, utilizada para desempatar.
+//
+// Notas:
+// - Las cadenas apuntan al pool de cadenas, por lo que la clave no debe conservarse despus de
+//   internar cadenas nuevas.
+
+struct ClaveInversa {
+    string_view traduccion;
+    uint64_t prefijo;
+    string_view espanol;
+};
+
+
+
+// Funcin para obtener la clave de una palabra en el ndice inverso de un idioma.
+//
+// Parmetros:
+// - entrada: Posicin de la palabra en `tablaPalabras`.
+// - idioma: Idioma del ndice inverso.
+//
+// Retorno:
+// - La clave (traduccin, prefijo y palabra en espaol) de la palabra.
+
+ClaveInversa claveInversa(uint32_t entrada, int idioma) {
+    const PalabraInterna& p = tablaPalabras.palabras[entrada];
+    string_view traduccion = cadenaDe(traduccionDe(p, idioma));
+    return { traduccion, prefijoClave(traduccion), cadenaDe(p.espanol) };
+}
+
+
+
+// Funcin para comparar una clave con la palabra almacenada en un nodo de un ndice inverso.
+//
+// Parmetros:
+// - clave: Clave que se desea comparar.
+// - idioma: Idioma del ndice inverso.
+// - nodo: ndice del nodo contra el que se compara.
+//
+// Retorno:
+// - Un nmero negativo si `clave` es menor que la del nodo, 0 si son iguales y un nmero positivo si es mayor.
+//
+// Notas:
+// - Igual que `compararClave`, solo lee las cadenas cuando los prefijos son iguales.
+
+inline int compararInversa(const ClaveInversa& clave, int idioma, uint32_t nodo) {
+    uint64_t prefijoNodo = nodoEn(nodo).prefijo;
+    if (clave.prefijo != prefijoNodo) return clave.prefijo < prefijoNodo ? -1 : 1;
+
+    const PalabraInterna& p = palabraDe(nodo);
+    int comparacion = clave.traduccion.compare(cadenaDe(traduccionDe(p, idioma)));
+    if (comparacion != 0) return comparacion;
+    return clave.espanol.compare(cadenaDe(p.espanol));
+}
+
+
+
+// Funcin para insertar una palabra en el ndice inverso de un idioma.
+//
+// Parmetros:
+// - nodo: ndice del nodo raz del ndice inverso.
+// - clave: Clave de la palabra (ver `claveInversa`).
+// - entrada: Posicin de la palabra en `tablaPalabras`.
+// - idioma: Idioma del ndice inverso.
+//
+// Retorno:
+// - El ndice del nodo raz actualizado despus de la insercin.
+//
+// Proceso:
+// 1. Desciende comparando la clave con `compararInversa` hasta llegar a un nodo nulo.
+// 2. Crea una hoja con `reservarNodo` que apunta a la misma entrada que el nodo del rbol principal.
+// 3. Al regresar de la recursin, corrige el balance de cada nodo con `rebalancear`.
+//
+// Notas:
+// - El ndice no copia la palabra: solo guarda su posicin en `tablaPalabras`.
+
+uint32_t insertarInversa(uint32_t nodo, const ClaveInversa& clave, uint32_t entrada, int idioma) {
+    // Caso base: si el nodo es nulo, crear la hoja.
+    if (!nodo) return reservarNodo(clave.prefijo, entrada);
+
+    int comparacion = compararInversa(clave, idioma, nodo);
+    if (comparacion < 0)
+        nodoEn(nodo).izquierda = insertarInversa(nodoEn(nodo).izquierda, clave, entrada, idioma);
+    else if (comparacion > 0)
+        nodoEn(nodo).derecha = insertarInversa(nodoEn(nodo).derecha, clave, entrada, idioma);
+    else
+        return nodo; // La palabra ya est en el ndice.
+
+    return rebalancear(nodo);
+}
+
+
+
+// Funcin para eliminar una palabra del ndice inverso de un idioma.
+//
+// Parmetros:
+// - nodo: ndice del nodo raz del ndice inverso.
+// - clave: Clave de la palabra que se desea eliminar.
+// - idioma: Idioma del ndice inverso.
+//
+// Retorno:
+// - El ndice del nodo raz actualizado despus de la eliminacin.
+//
+// Proceso:
+// - Sigue los mismos casos que `eliminarPalabra`; en el Caso 3 el nodo toma la entrada y el prefijo
+//   del sucesor y luego se elimina el sucesor con su propia clave.
+//
+// Notas:
+// - La palabra no se libera de `tablaPalabras`; de eso se encarga `eliminarPalabra`.
+
+uint32_t eliminarInversa(uint32_t nodo, const ClaveInversa& clave, int idioma) {
+    if (!nodo) return nodo; // Caso base: la palabra no est en el ndice.
+
+    int comparacion = compararInversa(clave, idioma, nodo);
+    if (comparacion < 0)
+        nodoEn(nodo).izquierda = eliminarInversa(nodoEn(nodo).izquierda, clave, idioma);
+    else if (comparacion > 0)
+        nodoEn(nodo).derecha = eliminarInversa(nodoEn(nodo).derecha, clave, idioma);
+    else {
+        Nodo& actual = nodoEn(nodo);
+        if (!actual.izquierda || !actual.derecha) {
+            // Caso 1 y Caso 2: El nodo tiene 0 o 1 hijo.
+            uint32_t temp = actual.izquierda ? actual.izquierda : actual.derecha;
+            if (!temp) {
+                temp = nodo;
+                nodo = 0;
+            }
+            else {
+                actual = nodoEn(temp);
+            }
+            destruirNodo(temp);
+        }
+        else {
+            // Caso 3: Tomar la palabra del sucesor y eliminar el sucesor.
+            uint32_t temp = minimo(actual.derecha);
+            actual.entrada = nodoEn(temp).entrada;
+            actual.prefijo = nodoEn(temp).prefijo;
+            actual.derecha = eliminarInversa(actual.derecha, claveInversa(actual.entrada, idioma), idioma);
+        }
+    }
+
+    if (!nodo) return nodo;
+    return rebalancear(nodo);
+}
+
+
+
+// Funcin para quitar una palabra de la cach de bsquedas (definida en la seccin de la cach).
+void olvidarEnCache(string_view palabra);
+
+
+
+// Funcin para agregar una palabra nueva a todos los ndices inversos.
+//
+// Parmetros:
+// - entrada: Posicin de la palabra en `tablaPalabras`.
+//
+// Notas:
+// - Se llama desde `insertar` cada vez que se crea un nodo en el rbol principal.
+// - Los idiomas cuyo ndice todava no se construy se omiten; al construirlo se incluye la palabra.
+// - Tambin marca como desactualizados el autmata de traduccin de textos (`automataFrases`), el
+//   ndice ponderado y el de claves normalizadas, y quita la palabra de la cach de bsquedas (poda
+//   estar guardada como inexistente).
+
+void indexarTraducciones(uint32_t entrada) {
+    automataFrases.vigente = false;
+    indicePonderado.vigente = false;
+    indiceNormalizado.vigente = false;
+    olvidarEnCache(cadenaDe(tablaPalabras.palabras[entrada].espanol));
+    for (int idioma = 0; idioma < CANTIDAD_IDIOMAS; ++idioma) {
+        if (!columnasIdiomas.indexada[idioma]) continue;
+        raicesInversas[idioma] = insertarInversa(raicesInversas[idioma], claveInversa(entrada, idioma), entrada, idioma);
+    }
+}
+
+
+
+// Funcin para quitar una palabra de todos los ndices inversos.
+//
+// Parmetros:
+// - entrada: Posicin de la palabra en `tablaPalabras`.
+//
+// Notas:
+// - Se llama desde `eliminarPalabra` antes de liberar la posicin de la palabra.
+// - Los idiomas cuyo ndice todava no se construy se omiten.
+// - Tambin marca como desactualizados el autmata de traduccin de textos (`automataFrases`), el
+//   ndice ponderado y el de claves normalizadas, y quita la palabra de la cach de bsquedas.
+
+void desindexarTraducciones(uint32_t entrada) {
+    automataFrases.vigente = false;
+    indicePonderado.vigente = false;
+    indiceNormalizado.vigente = false;
+    olvidarEnCache(cadenaDe(tablaPalabras.palabras[entrada].espanol));
+    for (int idioma = 0; idioma < CANTIDAD_IDIOMAS; ++idioma) {
+        if (!columnasIdiomas.indexada[idioma]) continue;
+        raicesInversas[idioma] = eliminarInversa(raicesInversas[idioma], claveInversa(entrada, idioma), idioma);
+    }
+}
+
+
+
+// Funcin para construir un ndice inverso perfectamente balanceado a partir de entradas ordenadas.
+//
+// Parmetros:
+// - entradas: Posiciones de las palabras en `tablaPalabras`, ordenadas por la clave del ndice.
+// - prefijos: Prefijo de la traduccin de cada entrada, indexado por la posicin en `tablaPalabras`.
+// - inicio: ndice de la primera entrada del rango a construir.
+// - fin: ndice siguiente a la ltima entrada del rango (rango semiabierto [inicio, fin)).
+//
+// Retorno:
+// - El ndice de la raz del subrbol construido, o 0 si el rango est vaco.
+//
+// Notas:
+// - Funciona igual que `construirBalanceado`, pero los nodos apuntan a palabras que ya existen.
+
+uint32_t construirInversaBalanceada(const vector<uint32_t>& entradas, const vector<uint64_t>& prefijos, size_t inicio, size_t fin) {
+    if (inicio >= fin) return 0; // Caso base: rango vaco.
+
+    size_t medio = inicio + (fin - inicio) / 2;
+    uint32_t entrada = entradas[medio];
+    uint32_t nodo = reservarNodo(prefijos[entrada], entrada);
+    uint32_t izquierda = construirInversaBalanceada(entradas, prefijos, inicio, medio);
+    uint32_t derecha = construirInversaBalanceada(entradas, prefijos, medio + 1, fin);
+    nodoEn(nodo).izquierda = izquierda;
+    nodoEn(nodo).derecha = derecha;
+
+    // Actualizar la altura del nodo a partir de sus hijos.
+    actualizarAltura(nodo);
+    return nodo;
+}
+
+
+
+// Funcin para saber si una entrada va antes que otra en el ndice inverso de un idioma.
+//
+// Parmetros:
+// - a, b: Posiciones de las palabras en `tablaPalabras`.
+// - idioma: Idioma del ndice inverso.
+//
+// Retorno:
+// - true si la clave de `a` es estrictamente menor que la de `b`.
+//
+// Notas:
+// - Quien la llama puede descartar antes los casos con prefijos distintos (ver `construirIndiceInverso`).
+
+bool precedeInversa(uint32_t a, uint32_t b, int idioma) {
+    const PalabraInterna& pa = tablaPalabras.palabras[a];
+    const PalabraInterna& pb = tablaPalabras.palabras[b];
+
+    // Las cadenas estn internadas: el mismo identificador significa la misma traduccin.
+    uint32_t ta = traduccionDe(pa, idioma), tb = traduccionDe(pb, idioma);
+    if (ta != tb) return cadenaDe(ta) < cadenaDe(tb);
+    return cadenaDe(pa.espanol) < cadenaDe(pb.espanol);
+}
+
+
+
+// Funcin para construir el ndice inverso de un idioma.
+//
+// Parmetros:
+// - raiz: ndice del nodo raz del rbol principal.
+// - idioma: Idioma del ndice; sus traducciones deben estar cargadas (ver `cargarColumna`).
+// - rutaArchivo: Ruta del archivo con el orden guardado por `guardarIndicesInversos`.
+//
+// Proceso:
+// 1. Obtiene las entradas en orden alfabtico del espaol recorriendo el rbol principal.
+// 2. Calcula de una sola pasada el prefijo de la traduccin de cada entrada.
+// 3. Si el archivo existe, fue guardado para la misma cantidad de palabras y tiene el orden del idioma,
+//    lee ese orden (como posiciones en el orden alfabtico del espaol) y verifica que realmente est ordenado.
+// 4. Si el orden guardado falta o no es vlido (por ejemplo, porque el diccionario se edit a mano),
+//    ordena las entradas.
+// 5. Construye el ndice balanceado en tiempo lineal con `construirInversaBalanceada`.
+//
+// Notas:
+// - Verificar el orden guardado es lineal, mientras que ordenar de nuevo es O(n log n); el archivo
+//   solo acelera la carga y nunca puede dejar un ndice incorrecto.
+// - Tanto la verificacin como el ordenamiento comparan primero los prefijos, por lo que casi nunca
+//   leen las traducciones del pool de cadenas.
+// - Cada idioma se construye la primera vez que se usa, por lo que los idiomas que no se consultan
+//   en una sesin no ocupan nodos.
+
+void construirIndiceInverso(uint32_t raiz, int idioma, const string& rutaArchivo) {
+    vector<uint32_t> porRango;
+    recorrerInorden(raiz, porRango);
+    for (uint32_t& nodo : porRango) {
+        nodo = nodoEn(nodo).entrada; // Convertir cada nodo en su posicin en la tabla.
+    }
+
+    uint32_t n = static_cast<uint32_t>(porRango.size());
+
+    // Leer el encabezado del archivo guardado y saltar las secciones de los idiomas anteriores.
+    ifstream archivo(rutaArchivo, ios::binary);
+    char firma[4] = {};
+    uint32_t cantidad = 0, idiomas = 0, guardadas = 0;
+    archivo.read(firma, 4);
+    archivo.read(reinterpret_cast<char*>(&cantidad), sizeof(cantidad));
+    archivo.read(reinterpret_cast<char*>(&idiomas), sizeof(idiomas));
+    bool usarArchivo = archivo && memcmp(firma, "INV2", 4) == 0 && cantidad == n && idiomas == CANTIDAD_IDIOMAS;
+    for (int anterior = 0; usarArchivo && anterior <= idioma; ++anterior) {
+        usarArchivo = static_cast<bool>(archivo.read(reinterpret_cast<char*>(&guardadas), sizeof(guardadas)));
+        if (anterior < idioma) archivo.seekg(static_cast<streamoff>(guardadas) * sizeof(uint32_t), ios::cur);
+    }
+    usarArchivo = usarArchivo && guardadas == n;
+
+    // Calcular el prefijo de la traduccin de cada entrada.
+    vector<uint64_t> prefijos(tablaPalabras.palabras.size());
+    for (uint32_t entrada : porRango) {
+        prefijos[entrada] = prefijoClave(cadenaDe(traduccionDe(tablaPalabras.palabras[entrada], idioma)));
+    }
+
+    auto precede = [&prefijos, idioma](uint32_t a, uint32_t b) {
+        if (prefijos[a] != prefijos[b]) return prefijos[a] < prefijos[b];
+        return precedeInversa(a, b, idioma);
+    };
+
+    vector<uint32_t> orden;
+    vector<uint32_t> rangos(n);
+    if (usarArchivo && archivo.read(reinterpret_cast<char*>(rangos.data()), static_cast<streamsize>(n) * sizeof(uint32_t))) {
+        // Convertir las posiciones guardadas en entradas y verificar el orden.
+        orden.reserve(n);
+        for (uint32_t rango : rangos) {
+            if (rango >= n) break;
+            uint32_t entrada = porRango[rango];
+            if (!orden.empty() && !precede(orden.back(), entrada)) break;
+            orden.push_back(entrada);
+        }
+    }
+
+    if (orden.size() != n) {
+        // Orden guardado ausente o invlido: calcularlo.
+        orden = porRango;
+        sort(orden.begin(), orden.end(), precede);
+    }
+
+    raicesInversas[idioma] = construirInversaBalanceada(orden, prefijos, 0, n);
+    columnasIdiomas.indexada[idioma] = true;
+}
+
+
+
+// Funcin auxiliar para devolver al pool todos los nodos de un ndice inverso.
+//
+// Parmetros:
+// - nodo: ndice del nodo raz del subrbol que se desea liberar.
+
+void liberarNodosInversos(uint32_t nodo) {
+    if (!nodo) return;
+
+    uint32_t izquierda = nodoEn(nodo).izquierda;
+    uint32_t derecha = nodoEn(nodo).derecha;
+    liberarNodosInversos(izquierda);
+    liberarNodosInversos(derecha);
+    destruirNodo(nodo);
+}
+
+
+
+// Funcin para liberar el ndice inverso de un idioma.
+//
+// Parmetros:
+// - idioma: Idioma cuyo ndice se desea liberar.
+//
+// Notas:
+// - Las palabras no se modifican; el ndice se vuelve a construir con `construirIndiceInverso`
+//   si el idioma se usa otra vez.
+
+void liberarIndiceInverso(int idioma) {
+    liberarNodosInversos(raicesInversas[idioma]);
+    raicesInversas[idioma] = 0;
+    columnasIdiomas.indexada[idioma] = false;
+}
+
+
+
+// Funcin para guardar el orden de los ndices inversos junto con el diccionario.
+//
+// Parmetros:
+// - raiz: ndice del nodo raz del rbol principal.
+// - rutaArchivo: Ruta del archivo donde se guardar el orden (normalmente `C:\\traductor\\indices.umg`).
+//
+// Proceso:
+// 1. Calcula la posicin de cada palabra en el orden alfabtico del espaol, que es el orden en que
+//    `cargarPalabras` construye el rbol principal.
+// 2. Escribe un encabezado con la firma "INV2", la cantidad de palabras y la cantidad de idiomas.
+// 3. Por cada idioma escribe la cantidad de posiciones guardadas y, si su ndice est construido,
+//    recorre el ndice en inorden y escribe la posicin de cada palabra (enteros de 32 bits).
+// 4. Si el ndice de un idioma no se construy en esta sesin, conserva la seccin del archivo anterior
+//    (si era de la misma cantidad de palabras); al leerla se verifica, por lo que nunca deja un ndice incorrecto.
+//
+// Notas:
+// - Se guardan posiciones y no cadenas, por lo que el archivo no depende del formato de `palabras.umg`
+//   ni duplica las traducciones.
+
+void guardarIndicesInversos(uint32_t raiz, const string& rutaArchivo) {
+    vector<uint32_t> porRango;
+    recorrerInorden(raiz, porRango);
+
+    // Calcular la posicin alfabtica de cada entrada.
+    vector<uint32_t> rangoDeEntrada(tablaPalabras.palabras.size(), 0);
+    for (size_t i = 0; i < porRango.size(); ++i) {
+        rangoDeEntrada[nodoEn(porRango[i]).entrada] = static_cast<uint32_t>(i);
+    }
+    uint32_t cantidad = static_cast<uint32_t>(porRango.size());
+
+    // Leer las secciones del archivo anterior para los idiomas que no se construyeron.
+    vector<uint32_t> anteriores[CANTIDAD_IDIOMAS];
+    {
+        ifstream anterior(rutaArchivo, ios::binary);
+        char firma[4] = {};
+        uint32_t cantidadAnterior = 0, idiomas = 0;
+        anterior.read(firma, 4);
+        anterior.read(reinterpret_cast<char*>(&cantidadAnterior), sizeof(cantidadAnterior));
+        anterior.read(reinterpret_cast<char*>(&idiomas), sizeof(idiomas));
+        bool valido = anterior && memcmp(firma, "INV2", 4) == 0 && cantidadAnterior == cantidad && idiomas == CANTIDAD_IDIOMAS;
+        for (int idioma = 0; valido && idioma < CANTIDAD_IDIOMAS; ++idioma) {
+            uint32_t guardadas = 0;
+            valido = static_cast<bool>(anterior.read(reinterpret_cast<char*>(&guardadas), sizeof(guardadas))) && guardadas <= cantidad;
+            if (!valido) break;
+            anteriores[idioma].resize(guardadas);
+            valido = static_cast<bool>(anterior.read(reinterpret_cast<char*>(anteriores[idioma].data()), static_cast<streamsize>(guardadas) * sizeof(uint32_t)));
+        }
+        if (!valido) {
+            for (vector<uint32_t>& secciones : anteriores) secciones.clear();
+        }
+    }
+
+    ofstream archivo(rutaArchivo, ios::binary);
+    if (!archivo.is_open()) {
+        cerr << "Error al abrir " << rutaArchivo << " para escritura.\n";
+        return;
+    }
+
+    uint32_t idiomas = CANTIDAD_IDIOMAS;
+    archivo.write("INV2", 4);
+    archivo.write(reinterpret_cast<const char*>(&cantidad), sizeof(cantidad));
+    archivo.write(reinterpret_cast<const char*>(&idiomas), sizeof(idiomas));
+
+    vector<uint32_t> nodos;
+    vector<uint32_t> rangos;
+    for (int idioma = 0; idioma < CANTIDAD_IDIOMAS; ++idioma) {
+        rangos.clear();
+        if (columnasIdiomas.indexada[idioma]) {
+            nodos.clear();
+            recorrerInorden(raicesInversas[idioma], nodos);
+            for (uint32_t nodo : nodos) {
+                rangos.push_back(rangoDeEntrada[nodoEn(nodo).entrada]);
+            }
+        }
+        else {
+            rangos.swap(anteriores[idioma]);
+        }
+
+        uint32_t guardadas = static_cast<uint32_t>(rangos.size());
+        archivo.write(reinterpret_cast<const char*>(&guardadas), sizeof(guardadas));
+        archivo.write(reinterpret_cast<const char*>(rangos.data()), static_cast<streamsize>(rangos.size()) * sizeof(uint32_t));
+    }
+
+    archivo.close();
+}
+
+
+
+// Funcin auxiliar para recolectar las palabras de un ndice inverso cuya traduccin coincide.
+//
+// Parmetros:
+// - nodo: ndice del nodo raz del subrbol donde se busca.
+// - idioma: Idioma del ndice inverso.
+// - traduccion: Palabra buscada y su prefijo (`prefijo`).
+// - entradas: Vector donde se agregan, en orden, las posiciones de las palabras encontradas.
+
+void recolectarTraducciones(uint32_t nodo, int idioma, string_view traduccion, uint64_t prefijo, vector<uint32_t>& entradas) {
+    while (nodo) {
+        int comparacion;
+        uint64_t prefijoNodo = nodoEn(nodo).prefijo;
+        if (prefijo != prefijoNodo)
+            comparacion = prefijo < prefijoNodo ? -1 : 1;
+        else
+            comparacion = traduccion.compare(cadenaDe(traduccionDe(palabraDe(nodo), idioma)));
+
+        if (comparacion < 0) {
+            nodo = nodoEn(nodo).izquierda;
+        }
+        else if (comparacion > 0) {
+            nodo = nodoEn(nodo).derecha;
+        }
+        else {
+            // Las coincidencias pueden continuar en ambos subrboles.
+            recolectarTraducciones(nodoEn(nodo).izquierda, idioma, traduccion, prefijo, entradas);
+            entradas.push_back(nodoEn(nodo).entrada);
+            nodo = nodoEn(nodo).derecha;
+        }
+    }
+}
+
+
+
+// Funcin para buscar todas las palabras cuya traduccin en un idioma coincide con la palabra dada.
+//
+// Parmetros:
+// - idioma: Idioma de la palabra buscada (ver `Idioma`).
+// - traduccion: Palabra buscada en ese idioma.
+//
+// Retorno:
+// - Las posiciones en `tablaPalabras` de las palabras encontradas, en orden alfabtico del espaol.
+//   Si ninguna coincide, el vector queda vaco.
+//
+// Proceso:
+// 1. Desciende por el ndice inverso comparando solo la traduccin (primero por el prefijo).
+// 2. Cuando encuentra una coincidencia, recolecta recursivamente las coincidencias del subrbol
+//    izquierdo, agrega la actual y contina por el subrbol derecho.
+//
+// Notas:
+// - Como las coincidencias son contiguas en inorden, la bsqueda es O(log n + k), donde `k` es la
+//   cantidad de palabras encontradas.
+// - Con el resultado se puede traducir entre dos idiomas cualesquiera (por ejemplo, de ingls a alemn)
+//   leyendo el otro campo de cada palabra.
+
+vector<uint32_t> buscarPorTraduccion(int idioma, string_view traduccion) {
+    vector<uint32_t> entradas;
+    recolectarTraducciones(raicesInversas[idioma], idioma, traduccion, prefijoClave(traduccion), entradas);
+    return entradas;
+}
+
+
+
+
+//==========================FUNCIONES DE OPERACIONES MASIVAS==========================
+
+
+
+// Cantidad mnima de palabras de la lista para repartir una operacin masiva en dos hilos; con menos,
+// crear un hilo cuesta ms que la operacin.
+const size_t MINIMO_PALABRAS_POR_HILO = 4096;
+
+
+
+// Funcin para unir dos rboles AVL y un nodo intermedio (join).
+//
+// Parmetros:
+// - izquierda: Raz del rbol con las claves menores que la de `medio` (puede ser 0).
+// - medio: Nodo suelto (sus hijos se ignoran) cuya clave est entre las de ambos rboles.
+// - derecha: Raz del rbol con las claves mayores que la de `medio` (puede ser 0).
+//
+// Retorno:
+// - La raz del rbol AVL con todos los nodos.
+//
+// Proceso:
+// 1. Si las alturas difieren en ms de 1, desciende por el borde del rbol ms alto (el derecho del izquierdo,
+//    o el izquierdo del derecho) hasta un subrbol cuya altura difiere como mximo en 1 de la del otro rbol.
+// 2. All cuelga `medio` con ese subrbol y el otro rbol como hijos.
+// 3. De regreso corrige el balance con `rebalancear`: cada subrbol crece como mximo en 1, igual que al insertar.
+//
+// Notas:
+// - Cuesta O(|altura(izquierda) - altura(derecha)| + 1), sin comparar claves.
+// - Junto con `dividir`, es la base de las operaciones masivas.
+
+uint32_t juntar(uint32_t izquierda, uint32_t medio, uint32_t derecha) {
+    if (altura(izquierda) > altura(derecha) + 1) {
+        nodoEn(izquierda).derecha = juntar(nodoEn(izquierda).derecha, medio, derecha);
+        return rebalancear(izquierda);
+    }
+    if (altura(derecha) > altura(izquierda) + 1) {
+        nodoEn(derecha).izquierda = juntar(izquierda, medio, nodoEn(derecha).izquierda);
+        return rebalancear(derecha);
+    }
+
+    // Las alturas son parecidas: `medio` puede ser la raz.
+    nodoEn(medio).izquierda = izquierda;
+    nodoEn(medio).derecha = derecha;
+    actualizarAltura(medio);
+    return medio;
+}
+
+
+
+// Funcin auxiliar para quitar el ltimo nodo (la clave mayor) de un rbol AVL.
+//
+// Parmetros:
+// - nodo: Raz del rbol (distinta de 0).
+// - ultimo: Variable donde se guarda el nodo quitado.
+//
+// Retorno:
+// - La raz del rbol sin el ltimo nodo.
+
+uint32_t separarUltimo(uint32_t nodo, uint32_t& ultimo) {
+    if (!nodoEn(nodo).derecha) {
+        ultimo = nodo;
+        return nodoEn(nodo).izquierda;
+    }
+    uint32_t resto = separarUltimo(nodoEn(nodo).derecha, ultimo);
+    return juntar(nodoEn(nodo).izquierda, nodo, resto);
+}
+
+
+
+// Funcin para unir dos rboles AVL sin nodo intermedio (todas las claves de `izquierda` son menores).
+//
+// Parmetros:
+// - izquierda: Raz del rbol con las claves menores (puede ser 0).
+// - derecha: Raz del rbol con las claves mayores (puede ser 0).
+//
+// Retorno:
+// - La raz del rbol AVL con todos los nodos.
+//
+// Notas:
+// - Quita la clave mayor de `izquierda` con `separarUltimo` y la usa como nodo intermedio de `juntar`.
+
+uint32_t juntarSinMedio(uint32_t izquierda, uint32_t derecha) {
+    if (!izquierda) return derecha;
+    if (!derecha) return izquierda;
+
+    uint32_t ultimo;
+    izquierda = separarUltimo(izquierda, ultimo);
+    return juntar(izquierda, ultimo, derecha);
+}
+
+
+
+// Funcin para dividir un rbol AVL segn una clave (split).
+//
+// Parmetros:
+// - nodo: Raz del rbol que se desea dividir.
+// - clave: Palabra en espaol que separa ambas partes.
+// - prefijo: Prefijo de `clave` (ver `prefijoClave`).
+// - izquierda: Variable donde se guarda la raz del rbol con las claves menores que `clave`.
+// - derecha: Variable donde se guarda la raz del rbol con las claves mayores que `clave`.
+//
+// Retorno:
+// - El nodo con la clave igual a `clave` (con sus hijos sin actualizar), o 0 si no est.
+//
+// Proceso:
+// 1. Desciende como en una bsqueda. Al volver, cada nodo del camino se une con `juntar` a la parte
+//    del lado contrario al descenso, junto con su otro subrbol.
+//
+// Notas:
+// - Cuesta O(log n): las alturas de los rboles que se juntan en el camino crecen de forma escalonada.
+// - No crea ni libera nodos, y solo modifica los nodos del rbol dividido.
+
+uint32_t dividir(uint32_t nodo, string_view clave, uint64_t prefijo, uint32_t& izquierda, uint32_t& derecha) {
+    if (!nodo) {
+        izquierda = 0;
+        derecha = 0;
+        return 0;
+    }
+
+    uint32_t hijoIzquierdo = nodoEn(nodo).izquierda;
+    uint32_t hijoDerecho = nodoEn(nodo).derecha;
+    int comparacion = compararClave(clave, prefijo, nodo);
+    if (comparacion == 0) {
+        izquierda = hijoIzquierdo;
+        derecha = hijoDerecho;
+        return nodo;
+    }
+
+    uint32_t encontrado;
+    if (comparacion < 0) {
+        encontrado = dividir(hijoIzquierdo, clave, prefijo, izquierda, derecha);
+        derecha = juntar(derecha, nodo, hijoDerecho);
+    }
+    else {
+        encontrado = dividir(hijoDerecho, clave, prefijo, izquierda, derecha);
+        izquierda = juntar(hijoIzquierdo, nodo, izquierda);
+    }
+    return encontrado;
+}
+
+
+
+// Funcin auxiliar para insertar un nodo suelto en un rbol, sin crear nodos (ver `unirLista`).
+//
+// Parmetros:
+// - nodo: Raz del rbol.
+// - suelto: Nodo que se desea insertar (sus hijos se ignoran).
+// - clave, prefijo: Palabra en espaol del nodo suelto y su prefijo.
+// - encontrado: Variable donde se guarda el nodo del rbol con la misma clave, o 0 si no estaba.
+//
+// Retorno:
+// - La raz del rbol; si la clave ya estaba, el rbol no cambia y `suelto` no se usa.
+//
+// Notas:
+// - Desciende y rebalancea igual que `insertar`; para una sola palabra es ms barato que dividir y juntar.
+
+uint32_t insertarSuelto(uint32_t nodo, uint32_t suelto, string_view clave, uint64_t prefijo, uint32_t& encontrado) {
+    if (!nodo) {
+        nodoEn(suelto).izquierda = 0;
+        nodoEn(suelto).derecha = 0;
+        actualizarAltura(suelto);
+        return suelto;
+    }
+
+    int comparacion = compararClave(clave, prefijo, nodo);
+    if (comparacion == 0) {
+        encontrado = nodo;
+        return nodo;
+    }
+    if (comparacion < 0)
+        nodoEn(nodo).izquierda = insertarSuelto(nodoEn(nodo).izquierda, suelto, clave, prefijo, encontrado);
+    else
+        nodoEn(nodo).derecha = insertarSuelto(nodoEn(nodo).derecha, suelto, clave, prefijo, encontrado);
+    return encontrado ? nodo : rebalancear(nodo);
+}
+
+
+
+// Funcin auxiliar para quitar de un rbol el nodo de una clave, sin liberarlo (ver `restarLista`).
+//
+// Parmetros:
+// - nodo: Raz del rbol.
+// - clave, prefijo: Palabra en espaol que se desea quitar y su prefijo.
+// - quitado: Variable donde se guarda el nodo quitado, o 0 si la clave no estaba.
+//
+// Retorno:
+// - La raz del rbol sin la clave.
+//
+// Notas:
+// - A diferencia de `eliminarPalabra`, el nodo quitado conserva su palabra (no la intercambia con el sucesor)
+//   y no se libera: sus hijos se unen con `juntarSinMedio` y el camino se rebalancea al volver.
+
+uint32_t quitarClave(uint32_t nodo, string_view clave, uint64_t prefijo, uint32_t& quitado) {
+    if (!nodo) return 0;
+
+    int comparacion = compararClave(clave, prefijo, nodo);
+    if (comparacion == 0) {
+        quitado = nodo;
+        return juntarSinMedio(nodoEn(nodo).izquierda, nodoEn(nodo).derecha);
+    }
+    if (comparacion < 0)
+        nodoEn(nodo).izquierda = quitarClave(nodoEn(nodo).izquierda, clave, prefijo, quitado);
+    else
+        nodoEn(nodo).derecha = quitarClave(nodoEn(nodo).derecha, clave, prefijo, quitado);
+    return quitado ? rebalancear(nodo) : nodo;
+}
+
+
+
+// Funcin para ejecutar las dos mitades de una operacin masiva, en paralelo si conviene.
+//
+// Parmetros:
+// - hilos: Hilos disponibles para ambas mitades.
+// - palabras: Cantidad de palabras de la lista que procesan ambas mitades.
+// - izquierda, derecha: Mitades de la operacin; reciben los hilos disponibles para cada una.
+//
+// Notas:
+// - Con al menos dos hilos y MINIMO_PALABRAS_POR_HILO palabras, la mitad izquierda se ejecuta en un hilo nuevo
+//   y la derecha en el hilo actual; los hilos se reparten entre ambas. Si no, se ejecutan una despus de otra.
+// - Las mitades trabajan sobre subrboles distintos, por lo que no necesitan sincronizarse.
+
+void ejecutarMitades(unsigned int hilos, size_t palabras, const function<void(unsigned int)>& izquierda,
+    const function<void(unsigned int)>& derecha) {
+    if (hilos < 2 || palabras < MINIMO_PALABRAS_POR_HILO) {
+        izquierda(1);
+        derecha(1);
+        return;
+    }
+
+    thread hilo(izquierda, hilos / 2);
+    derecha(hilos - hilos / 2);
+    hilo.join();
+}
+
+
+
+// Funcin auxiliar para enlazar nodos sueltos ya ordenados en un rbol balanceado.
+//
+// Parmetros:
+// - nodos: Nodos sueltos, ordenados por su clave.
+// - inicio, fin: Rango semiabierto [inicio, fin) de `nodos` que se desea enlazar.
+//
+// Retorno:
+// - La raz del rbol construido, o 0 si el rango est vaco.
+//
+// Notas:
+// - Funciona igual que `construirBalanceado`, pero con nodos que ya existen.
+
+uint32_t enlazarBalanceado(const vector<uint32_t>& nodos, size_t inicio, size_t fin) {
+    if (inicio >= fin) return 0;
+
+    size_t medio = inicio + (fin - inicio) / 2;
+    uint32_t nodo = nodos[medio];
+    nodoEn(nodo).izquierda = enlazarBalanceado(nodos, inicio, medio);
+    nodoEn(nodo).derecha = enlazarBalanceado(nodos, medio + 1, fin);
+    actualizarAltura(nodo);
+    return nodo;
+}
+
+
+
+// Funcin para unir un rbol con las palabras de una lista ordenada (unin).
+//
+// Parmetros:
+// - nodo: Raz del rbol.
+// - palabras: Lista ordenada y sin repetidas.
+// - nuevos: Nodo suelto ya creado para cada palabra de la lista.
+// - inicio, fin: Rango semiabierto [inicio, fin) de la lista que se desea unir.
+// - agregada: Se marca con 1 la posicin de cada palabra que se agreg al rbol.
+// - hilos: Hilos disponibles.
+//
+// Retorno:
+// - La raz del rbol unido.
+//
+// Proceso:
+// 1. Toma la palabra del medio de la lista y divide el rbol con ella (`dividir`).
+// 2. Une recursivamente (en paralelo) la parte menor con la mitad izquierda de la lista y la parte
+//    mayor con la mitad derecha.
+// 3. Junta ambos resultados usando como nodo intermedio el del rbol si la palabra ya estaba
+//    (se conserva la palabra existente, como en `insertar`) o el nodo nuevo si no estaba.
+// 4. Con una sola palabra en el rango, la inserta directamente con `insertarSuelto`.
+//
+// Notas:
+// - La lista hace de segundo rbol balanceado (su raz es la palabra del medio), por lo que el trabajo es
+//   O(m log(n / m + 1)) para un rbol de n palabras y una lista de m.
+// - Si el rbol se acaba, el resto de la lista se enlaza directamente con `enlazarBalanceado`.
+
+uint32_t unirLista(uint32_t nodo, const vector<VistaPalabra>& palabras, const vector<uint32_t>& nuevos,
+    size_t inicio, size_t fin, vector<char>& agregada, unsigned int hilos) {
+    if (inicio >= fin) return nodo;
+    if (!nodo) {
+        fill(agregada.begin() + inicio, agregada.begin() + fin, 1);
+        return enlazarBalanceado(nuevos, inicio, fin);
+    }
+    if (fin - inicio == 1) {
+        string_view clave = palabras[inicio].espanol;
+        uint32_t encontrado = 0;
+        nodo = insertarSuelto(nodo, nuevos[inicio], clave, prefijoClave(clave), encontrado);
+        if (!encontrado) agregada[inicio] = 1;
+        return nodo;
+    }
+
+    size_t medio = inicio + (fin - inicio) / 2;
+    string_view clave = palabras[medio].espanol;
+    uint32_t izquierda, derecha;
+    uint32_t encontrado = dividir(nodo, clave, prefijoClave(clave), izquierda, derecha);
+    if (!encontrado) {
+        encontrado = nuevos[medio];
+        agregada[medio] = 1;
+    }
+
+    ejecutarMitades(hilos, fin - inicio,
+        [&](unsigned int h) { izquierda = unirLista(izquierda, palabras, nuevos, inicio, medio, agregada, h); },
+        [&](unsigned int h) { derecha = unirLista(derecha, palabras, nuevos, medio + 1, fin, agregada, h); });
+    return juntar(izquierda, encontrado, derecha);
+}
+
+
+
+// Funcin para quitar de un rbol las palabras de una lista ordenada (diferencia).
+//
+// Parmetros:
+// - nodo: Raz del rbol.
+// - palabras: Lista ordenada y sin repetidas.
+// - inicio, fin: Rango semiabierto [inicio, fin) de la lista que se desea quitar.
+// - eliminados: Vector donde se agregan los nodos quitados (su palabra todava no se libera).
+// - hilos: Hilos disponibles.
+//
+// Retorno:
+// - La raz del rbol sin las palabras de la lista.
+//
+// Notas:
+// - Divide igual que `unirLista`; el nodo de la palabra del medio, si estaba, se deja fuera con `juntarSinMedio`.
+// - Con una sola palabra en el rango, la quita directamente con `quitarClave`.
+
+uint32_t restarLista(uint32_t nodo, const vector<VistaPalabra>& palabras, size_t inicio, size_t fin,
+    vector<uint32_t>& eliminados, unsigned int hilos) {
+    if (!nodo || inicio >= fin) return nodo;
+    if (fin - inicio == 1) {
+        string_view clave = palabras[inicio].espanol;
+        uint32_t quitado = 0;
+        nodo = quitarClave(nodo, clave, prefijoClave(clave), quitado);
+        if (quitado) eliminados.push_back(quitado);
+        return nodo;
+    }
+
+    size_t medio = inicio + (fin - inicio) / 2;
+    string_view clave = palabras[medio].espanol;
+    uint32_t izquierda, derecha;
+    uint32_t encontrado = dividir(nodo, clave, prefijoClave(clave), izquierda, derecha);
+    if (encontrado) eliminados.push_back(encontrado);
+
+    vector<uint32_t> eliminadosDerecha;
+    ejecutarMitades(hilos, fin - inicio,
+        [&](unsigned int h) { izquierda = restarLista(izquierda, palabras, inicio, medio, eliminados, h); },
+        [&](unsigned int h) { derecha = restarLista(derecha, palabras, medio + 1, fin, eliminadosDerecha, h); });
+    eliminados.insert(eliminados.end(), eliminadosDerecha.begin(), eliminadosDerecha.end());
+    return juntarSinMedio(izquierda, derecha);
+}
+
+
+
+// Funcin para conservar en un rbol solo las palabras de una lista ordenada (interseccin).
+//
+// Parmetros:
+// - nodo: Raz del rbol.
+// - palabras: Lista ordenada y sin repetidas.
+// - inicio, fin: Rango semiabierto [inicio, fin) de la lista.
+// - eliminados: Vector donde se agregan los nodos quitados (su palabra todava no se libera).
+// - hilos: Hilos disponibles.
+//
+// Retorno:
+// - La raz del rbol con las palabras que tambin estn en la lista.
+//
+// Notas:
+// - Divide igual que `unirLista`. Si la lista se acaba, todo el subrbol restante se quita.
+
+uint32_t intersectarLista(uint32_t nodo, const vector<VistaPalabra>& palabras, size_t inicio, size_t fin,
+    vector<uint32_t>& eliminados, unsigned int hilos) {
+    if (!nodo) return 0;
+    if (inicio >= fin) {
+        recorrerInorden(nodo, eliminados);
+        return 0;
+    }
+
+    size_t medio = inicio + (fin - inicio) / 2;
+    string_view clave = palabras[medio].espanol;
+    uint32_t izquierda, derecha;
+    uint32_t encontrado = dividir(nodo, clave, prefijoClave(clave), izquierda, derecha);
+
+    vector<uint32_t> eliminadosDerecha;
+    ejecutarMitades(hilos, fin - inicio,
+        [&](unsigned int h) { izquierda = intersectarLista(izquierda, palabras, inicio, medio, eliminados, h); },
+        [&](unsigned int h) { derecha = intersectarLista(derecha, palabras, medio + 1, fin, eliminadosDerecha, h); });
+    eliminados.insert(eliminados.end(), eliminadosDerecha.begin(), eliminadosDerecha.end());
+    return encontrado ? juntar(izquierda, encontrado, derecha) : juntarSinMedio(izquierda, derecha);
+}
+
+
+
+// Funcin para aplicar una operacin masiva entre el diccionario y una lista de palabras.
+//
+// Parmetros:
+// - raiz: ndice del nodo raz del rbol AVL.
+// - palabras: Lista ordenada y sin repetidas (como la deja `leerArchivoPalabras`).
+// - operacion: Unin, diferencia o interseccin (ver `OperacionMasiva`).
+// - agregadas: Variable donde se guarda la cantidad de palabras agregadas.
+// - eliminadas: Variable donde se guarda la cantidad de palabras eliminadas.
+//
+// Retorno:
+// - El ndice de la raz del rbol despus de la operacin.
+//
+// Proceso:
+// 1. En la unin, crea primero (en un solo hilo) un nodo suelto por palabra de la lista, porque el pool de
+//    nodos, la tabla de palabras y el filtro de Bloom no admiten varios hilos.
+// 2. Reestructura el rbol con `unirLista`, `restarLista` o `intersectarLista` usando todos los ncleos; en
+//    esta etapa solo se mueven enlaces entre nodos existentes.
+// 3. En un solo hilo: actualiza los ndices inversos y la cach de las palabras agregadas y eliminadas, libera
+//    las palabras eliminadas y los nodos de las palabras de la lista que ya estaban.
+// 4. Anota todos los cambios en `cambios.umg` con una sola llamada a `registrarCambio`.
+//
+// Notas:
+// - Si cambia ms de un octavo del diccionario, los ndices inversos se liberan y se reconstruyen la prxima vez
+//   que se usan (O(n)), en lugar de actualizarse palabra por palabra.
+// - El rbol debe estar cargado por completo y no debe haber lectores concurrentes (ver `activarLecturaConcurrente`).
+
+uint32_t aplicarOperacionMasiva(uint32_t raiz, const vector<VistaPalabra>& palabras, OperacionMasiva operacion,
+    size_t& agregadas, size_t& eliminadas) {
+    unsigned int nucleos = thread::hardware_concurrency();
+    if (nucleos == 0) nucleos = 1;
+    size_t antes = tamano(raiz);
+
+    // 1 y 2. Reestructurar el rbol; los nodos que salen del diccionario quedan en `eliminados`.
+    vector<uint32_t> nuevos;
+    vector<char> agregada;
+    vector<uint32_t> eliminados;
+    if (operacion == OPERACION_UNION) {
+        tablaPalabras.palabras.reserve(tablaPalabras.palabras.size() + palabras.size());
+        if (filtroBloom.claves + palabras.size() > filtroBloom.capacidad) {
+            reconstruirFiltro(palabras.size()); // Agrandar el filtro de Bloom una sola vez para toda la lista
+        }
+        nuevos.resize(palabras.size());
+        for (size_t i = 0; i < palabras.size(); ++i) {
+            nuevos[i] = crearNodo(palabras[i]);
+        }
+        agregada.assign(palabras.size(), 0);
+        raiz = unirLista(raiz, palabras, nuevos, 0, palabras.size(), agregada, nucleos);
+    }
+    else if (operacion == OPERACION_DIFERENCIA) {
+        raiz = restarLista(raiz, palabras, 0, palabras.size(), eliminados, nucleos);
+    }
+    else {
+        raiz = intersectarLista(raiz, palabras, 0, palabras.size(), eliminados, nucleos);
+    }
+
+    eliminadas = eliminados.size();
+    agregadas = tamano(raiz) + eliminadas - antes;
+
+    // 3. Con muchos cambios, reconstruir los ndices inversos despus es ms barato que actualizarlos.
+    if ((agregadas + eliminadas) * 8 > tamano(raiz)) {
+        for (int idioma = 0; idioma < CANTIDAD_IDIOMAS; ++idioma) {
+            if (columnasIdiomas.indexada[idioma]) liberarIndiceInverso(idioma);
+        }
+    }
+
+    string registro;
+    size_t cantidad = 0;
+    for (size_t i = 0; i < nuevos.size(); ++i) {
+        uint32_t entrada = nodoEn(nuevos[i]).entrada;
+        if (agregada[i]) {
+            indexarTraducciones(entrada);
+            if (cantidad++) registro += '\n';
+            agregarRegistroAgregada(registro, palabras[i]);
+        }
+        else {
+            // La palabra ya estaba en el diccionario: se descarta el nodo creado para ella.
+            liberarEntrada(entrada);
+            destruirNodo(nuevos[i]);
+        }
+    }
+    for (uint32_t nodo : eliminados) {
+        uint32_t entrada = nodoEn(nodo).entrada;
+        if (cantidad++) registro += '\n';
+        agregarRegistroEliminada(registro, cadenaDe(tablaPalabras.palabras[entrada].espanol));
+        desindexarTraducciones(entrada);
+        liberarEntrada(entrada);
+        destruirNodo(nodo);
+    }
+
+    // 4. Guardar todos los cambios de una sola vez.
+    if (cantidad) registrarCambio(registro, tamano(raiz), cantidad);
+    return raiz;
+}
+
+
+
+
+//==========================FUNCIONES DE POSICIN Y PREFIJO==========================
+
+
+
+// Funcin para obtener la posicin alfabtica de una palabra en el rbol AVL (rank).
+//
+// Parmetros:
+// - raiz: ndice del nodo raz del rbol AVL.
+// - palabra: Palabra en espaol (no es necesario que exista en el rbol).
+//
+// Retorno:
+// - La cantidad de palabras del rbol estrictamente menores que `palabra`. Si la palabra existe,
+//   es su posicin empezando desde 0; si no existe, es la posicin que ocupara.
+//
+// Proceso:
+// - Desciende desde la raz como en `buscar`; cada vez que avanza hacia la derecha suma el
+//   tamao del subrbol izquierdo ms el nodo actual.
+//
+// Notas:
+// - Es iterativa y O(log n) gracias al campo `tamano` de los nodos.
+
+size_t posicionDe(uint32_t raiz, string_view palabra) {
+    uint64_t prefijo = prefijoClave(palabra);
+    size_t posicion = 0;
+
+    while (raiz) {
+        if (compararClave(palabra, prefijo, raiz) <= 0) {
+            raiz = nodoEn(raiz).izquierda;
+        }
+        else {
+            posicion += tamano(nodoEn(raiz).izquierda) + 1;
+            raiz = nodoEn(raiz).derecha;
+        }
+    }
+
+    return posicion;
+}
+
+
+
+// Funcin para obtener la palabra que ocupa una posicin alfabtica en el rbol AVL (select).
+//
+// Parmetros:
+// - raiz: ndice del nodo raz del rbol AVL.
+// - posicion: Posicin buscada, empezando desde 0.
+//
+// Retorno:
+// - El ndice del nodo con la palabra en esa posicin, o 0 si la posicin no existe.
+//
+// Proceso:
+// - En cada nodo compara la posicin con el tamao del subrbol izquierdo para decidir si la
+//   palabra est a la izquierda, es el nodo actual o est a la derecha (restando lo que se salta).
+
+uint32_t palabraEnPosicion(uint32_t raiz, size_t posicion) {
+    while (raiz) {
+        size_t izquierda = tamano(nodoEn(raiz).izquierda);
+        if (posicion < izquierda) {
+            raiz = nodoEn(raiz).izquierda;
+        }
+        else if (posicion == izquierda) {
+            return raiz;
+        }
+        else {
+            posicion -= izquierda + 1;
+            raiz = nodoEn(raiz).derecha;
+        }
+    }
+
+    return 0; // La posicin es mayor o igual que la cantidad de palabras.
+}
+
+
+
+// Estructura para recorrer el rbol AVL en orden alfabtico sin recursin.
+//
+// Campos:
+// - pila: Nodos pendientes de visitar; el ltimo es la siguiente palabra que se entregar.
+//
+// Uso:
+// - Se coloca en una posicin con `posicionarCursor` y se avanza con `siguienteNodo`.
+// - Ocupa memoria proporcional a la altura del rbol (no a la cantidad de palabras), por lo que
+//   permite paginar diccionarios grandes sin copiarlos.
+//
+// Notas:
+// - El cursor guarda ndices de nodos: deja de ser vlido si el rbol se modifica (agregar o
+//   eliminar palabras). En ese caso se debe volver a posicionar.
+
+struct CursorPalabras {
+    vector<uint32_t> pila;
+};
+
+
+
+// Funcin para colocar un cursor en una posicin alfabtica del rbol AVL.
+//
+// Parmetros:
+// - cursor: Cursor que se desea posicionar (se descarta su estado anterior).
+// - raiz: ndice del nodo raz del rbol AVL.
+// - posicion: Posicin de la primera palabra que entregar el cursor, empezando desde 0.
+//
+// Proceso:
+// - Desciende como `palabraEnPosicion`, guardando en la pila cada nodo en el que baja hacia la
+//   izquierda (quedan pendientes de visitar) y el nodo encontrado.
+//
+// Notas:
+// - Si la posicin no existe, el cursor queda vaco y `siguienteNodo` retornar 0.
+
+void posicionarCursor(CursorPalabras& cursor, uint32_t raiz, size_t posicion) {
+    cursor.pila.clear();
+
+    while (raiz) {
+        size_t izquierda = tamano(nodoEn(raiz).izquierda);
+        if (posicion < izquierda) {
+            cursor.pila.push_back(raiz); // Pendiente de visitar despus de su subrbol izquierdo.
+            raiz = nodoEn(raiz).izquierda;
+        }
+        else if (posicion == izquierda) {
+            cursor.pila.push_back(raiz);
+            return;
+        }
+        else {
+            posicion -= izquierda + 1;
+            raiz = nodoEn(raiz).derecha;
+        }
+    }
+
+    cursor.pila.clear(); // La posicin no existe.
+}
+
+
+
+// Funcin para obtener la siguiente palabra de un cursor y avanzarlo.
+//
+// Parmetros:
+// - cursor: Cursor colocado con `posicionarCursor`.
+//
+// Retorno:
+// - El ndice del nodo con la siguiente palabra en orden alfabtico, o 0 si ya no quedan palabras.
+//
+// Proceso:
+// 1. Toma el ltimo nodo de la pila.
+// 2. Agrega a la pila su subrbol derecho bajando siempre por la izquierda, de modo que el
+//    mnimo de ese subrbol quede al final.
+//
+// Notas:
+// - Cada nodo entra y sale de la pila una sola vez, por lo que recorrer k palabras cuesta O(k)
+//   amortizado ms el O(log n) de posicionar el cursor.
+
+uint32_t siguienteNodo(CursorPalabras& cursor) {
+    if (cursor.pila.empty()) return 0;
+
+    uint32_t actual = cursor.pila.back();
+    cursor.pila.pop_back();
+
+    // Dejar preparado el sucesor: el mnimo del subrbol derecho.
+    for (uint32_t nodo = nodoEn(actual).derecha; nodo; nodo = nodoEn(nodo).izquierda) {
+        cursor.pila.push_back(nodo);
+    }
+
+    return actual;
+}
+
+
+
+// Funcin para obtener el intervalo de posiciones de las palabras que comienzan con un prefijo.
+//
+// Parmetros:
+// - raiz: ndice del nodo raz del rbol AVL.
+// - prefijo: Texto con el que deben comenzar las palabras.
+//
+// Retorno:
+// - Un par [inicio, fin) de posiciones alfabticas; la cantidad de palabras es `fin - inicio`.
+//
+// Proceso:
+// 1. `inicio` es la posicin del propio prefijo (la primera palabra mayor o igual a l).
+// 2. `fin` es la posicin del menor texto mayor que todas las palabras con ese prefijo: el prefijo
+//    con su ltimo carcter incrementado (descartando antes los caracteres que ya valen 0xFF).
+// 3. Si no existe ese texto (prefijo vaco o formado solo por 0xFF), `fin` es la cantidad de palabras.
+//
+// Notas:
+// - Son dos descensos por el rbol, as que cuesta O(log n) sin importar cuntas palabras coincidan.
+
+pair<size_t, size_t> intervaloPrefijo(uint32_t raiz, string_view prefijo) {
+    size_t inicio = posicionDe(raiz, prefijo);
+
+    string limite(prefijo);
+    while (!limite.empty() && static_cast<unsigned char>(limite.back()) == 0xFF) {
+        limite.pop_back();
+    }
+    if (limite.empty()) return { inicio, tamano(raiz) };
+
+    limite.back() = static_cast<char>(static_cast<unsigned char>(limite.back()) + 1);
+    return { inicio, posicionDe(raiz, limite) };
+}
+
+
+
+// Funcin para obtener las primeras palabras que comienzan con un prefijo (autocompletado).
+//
+// Parmetros:
+// - raiz: ndice del nodo raz del rbol AVL.
+// - prefijo: Texto con el que deben comenzar las palabras.
+// - limite: Cantidad mxima de palabras que se desean obtener.
+//
+// Retorno:
+// - Los ndices de los nodos encontrados, en orden alfabtico.
+//
+// Proceso:
+// 1. Calcula el intervalo de posiciones con `intervaloPrefijo`.
+// 2. Coloca un cursor al inicio del intervalo y entrega hasta `limite` palabras.
+//
+// Notas:
+// - El costo es O(log n + k), donde `k` es la cantidad de palabras entregadas.
+
+vector<uint32_t> autocompletar(uint32_t raiz, string_view prefijo, size_t limite) {
+    pair<size_t, size_t> intervalo = intervaloPrefijo(raiz, prefijo);
+    size_t cantidad = min(intervalo.second - intervalo.first, limite);
+
+    vector<uint32_t> nodos;
+    nodos.reserve(cantidad);
+
+    CursorPalabras cursor;
+    posicionarCursor(cursor, raiz, intervalo.first);
+    while (nodos.size() < cantidad) {
+        nodos.push_back(siguienteNodo(cursor));
+    }
+
+    return nodos;
+}
+
+
+
+
+//==========================FUNCIONES DEL NDICE CONGELADO==========================
+
+
+
+// Estructura para almacenar una copia de solo lectura del diccionario en arreglos contiguos,
+// ordenados segn la distribucin de Eytzinger (el recorrido por niveles de un rbol completo).
+//
+// Campos:
+// - prefijos: Primeros 8 bytes de cada palabra en espaol empaquetados en un entero (ver `prefijoClave`).
+// - inicioClave: Posicin de cada palabra dentro de `texto`.
+// - largoClave: Longitud de cada palabra.
+// - texto: Todas las palabras en espaol concatenadas en un solo bloque de memoria.
+// - cargas: Posicin de cada palabra (con sus traducciones) en `tablaPalabras`.
+// - inicioAlfabetico: Posicin dentro de `texto` de cada palabra en orden alfabtico, ms una posicin
+//   final igual a `texto.size()`. Como `texto` se llena en orden alfabtico, la palabra nmero r
+//   ocupa [inicioAlfabetico[r], inicioAlfabetico[r + 1]).
+// - comunConAnterior: Cantidad de caracteres iniciales que la palabra nmero r comparte con la palabra
+//   r - 1 (hasta MAXIMO_COMUN).
+// - minimoComunPorBloque: Menor valor de `comunConAnterior` en cada bloque de PALABRAS_POR_BLOQUE palabras.
+// - minimoComunPorGrupo: Menor valor de `comunConAnterior` en cada grupo de PALABRAS_POR_GRUPO palabras.
+//
+// Notas:
+// - La posicin 0 de cada arreglo no se utiliza; la raz est en la posicin 1 y los hijos
+//   de la posicin k estn en 2k y 2k + 1.
+// - El rbol AVL sigue siendo la estructura que se modifica; este ndice se reconstruye con
+//   `congelarIndice` despus de cargar, agregar o eliminar palabras.
+
+struct IndiceCongelado {
+    static constexpr size_t MAXIMO_COMUN = 255;
+    static constexpr size_t PALABRAS_POR_BLOQUE = 16;
+    static constexpr size_t PALABRAS_POR_GRUPO = 256;
+
+    vector<uint64_t> prefijos;
+    vector<uint32_t> inicioClave;
+    vector<uint32_t> largoClave;
+    string texto;
+    vector<uint32_t> cargas;
+    vector<uint32_t> inicioAlfabetico;
+    vector<uint8_t> comunConAnterior;
+    vector<uint8_t> minimoComunPorBloque;
+    vector<uint8_t> minimoComunPorGrupo;
+};
+
+
+
+// Funcin auxiliar para llenar el ndice congelado en orden de Eytzinger.
+//
+// Parmetros:
+// - ordenados: ndices de los nodos del rbol AVL en orden alfabtico.
+// - siguiente: Posicin del siguiente nodo de `ordenados` que se debe colocar.
+// - k: Posicin actual dentro del ndice.
+// - indice: ndice congelado que se est llenando.
+//
+// Proceso:
+// - Recorre en inorden el rbol implcito (2k, k, 2k + 1), asignando a cada posicin la
+//   siguiente palabra en orden alfabtico. Por eso las palabras quedan en `texto` en orden alfabtico.
+
+void llenarEytzinger(const vector<uint32_t>& ordenados, size_t& siguiente, size_t k, IndiceCongelado& indice) {
+    if (k >= indice.cargas.size()) return;
+
+    llenarEytzinger(ordenados, siguiente, 2 * k, indice);
+
+    const Nodo& nodo = nodoEn(ordenados[siguiente++]);
+    string_view clave = cadenaDe(tablaPalabras.palabras[nodo.entrada].espanol);
+    indice.prefijos[k] = nodo.prefijo;
+    // Contar los caracteres iniciales compartidos con la palabra anterior en orden alfabtico.
+    size_t comun = 0;
+    if (!indice.inicioAlfabetico.empty()) {
+        string_view anterior(indice.texto.data() + indice.inicioAlfabetico.back(), indice.texto.size() - indice.inicioAlfabetico.back());
+        size_t maximo = min(min(anterior.size(), clave.size()), IndiceCongelado::MAXIMO_COMUN);
+        while (comun < maximo && anterior[comun] == clave[comun]) ++comun;
+    }
+    indice.comunConAnterior.push_back(static_cast<uint8_t>(comun));
+
+    indice.inicioClave[k] = static_cast<uint32_t>(indice.texto.size());
+    indice.inicioAlfabetico.push_back(indice.inicioClave[k]);
+    indice.largoClave[k] = static_cast<uint32_t>(clave.size());
+    indice.texto.append(clave.data(), clave.size());
+    indice.cargas[k] = nodo.entrada;
+
+    llenarEytzinger(ordenados, siguiente, 2 * k + 1, indice);
+}
+
+
+
+// Funcin para construir (o reconstruir) el ndice congelado a partir del rbol AVL.
+//
+// Parmetros:
+// - raiz: ndice del nodo raz del rbol AVL.
+// - indice: ndice congelado que se reemplazar con el contenido actual del rbol.
+//
+// Proceso:
+// 1. Recorre el rbol en inorden con `recorrerInorden` para obtener los nodos ordenados.
+// 2. Reserva los arreglos del ndice (n + 1 posiciones, la posicin 0 no se usa).
+// 3. Coloca las palabras en orden de Eytzinger con `llenarEytzinger`, que adems registra la posicin
+//    de cada palabra en orden alfabtico y lo que comparte con la anterior (utilizados por la bsqueda
+//    aproximada).
+// 4. Calcula el mnimo de `comunConAnterior` de cada bloque y de cada grupo.
+//
+// Notas:
+// - Debe llamarse despus de cargar el diccionario y despus de cada `agregarPalabra` o
+//   `eliminarPalabra`, porque las posiciones de la tabla de palabras cambian al modificar el rbol.
+
+void congelarIndice(uint32_t raiz, IndiceCongelado& indice) {
+    vector<uint32_t> ordenados;
+    recorrerInorden(raiz, ordenados);
+
+    size_t n = ordenados.size();
+    indice.prefijos.assign(n + 1, 0);
+    indice.inicioClave.assign(n + 1, 0);
+    indice.largoClave.assign(n + 1, 0);
+    indice.cargas.assign(n + 1, 0);
+    indice.texto.clear();
+    indice.inicioAlfabetico.clear();
+    indice.inicioAlfabetico.reserve(n + 1);
+    indice.comunConAnterior.clear();
+    indice.comunConAnterior.reserve(n);
+
+    size_t siguiente = 0;
+    llenarEytzinger(ordenados, siguiente, 1, indice);
+    indice.inicioAlfabetico.push_back(static_cast<uint32_t>(indice.texto.size()));
+
+    // Resumir `comunConAnterior` por bloques y por grupos para poder saltar muchas palabras de una vez.
+    const size_t BLOQUE = IndiceCongelado::PALABRAS_POR_BLOQUE;
+    const size_t GRUPO = IndiceCongelado::PALABRAS_POR_GRUPO;
+    indice.minimoComunPorBloque.assign((n + BLOQUE - 1) / BLOQUE, 0);
+    indice.minimoComunPorGrupo.assign((n + GRUPO - 1) / GRUPO, 0);
+    for (size_t r = 0; r < n; ++r) {
+        uint8_t comun = indice.comunConAnterior[r];
+        uint8_t& minimoBloque = indice.minimoComunPorBloque[r / BLOQUE];
+        uint8_t& minimoGrupo = indice.minimoComunPorGrupo[r / GRUPO];
+        if (r % BLOQUE == 0 || comun < minimoBloque) minimoBloque = comun;
+        if (r % GRUPO == 0 || comun < minimoGrupo) minimoGrupo = comun;
+    }
+}
+
+
+
+// Funcin para buscar una palabra en el ndice congelado.
+//
+// Parmetros:
+// - indice: ndice congelado construido con `congelarIndice`.
+// - palabraBuscada: Cadena que contiene la palabra en espaol que se desea buscar.
+//
+// Retorno:
+// - Un puntero a la palabra interna (con sus traducciones) almacenada en `tablaPalabras`.
+// - Si la palabra no se encuentra, retorna nullptr.
+//
+// Proceso:
+// 1. Empaqueta el prefijo de la palabra buscada.
+// 2. Desciende por el rbol implcito: en cada posicin compara los prefijos como enteros y
+//    solo compara las palabras completas cuando los prefijos son iguales.
+//    La direccin se calcula sin ramificaciones (k = 2k + (clave < buscada)).
+// 3. En cada paso solicita al procesador las posiciones de tres niveles ms abajo (8k..8k+7),
+//    que ocupan una sola lnea de cach.
+// 4. Al salir del rbol, descarta los pasos hacia la derecha finales para obtener la
+//    primera clave mayor o igual a la buscada, y verifica si es igual.
+//
+// Notas:
+// - Los arreglos son contiguos, por lo que la bsqueda evita saltar entre nodos dispersos del heap.
+
+const PalabraInterna* buscarCongelado(const IndiceCongelado& indice, const string& palabraBuscada) {
+    size_t n = indice.cargas.empty() ? 0 : indice.cargas.size() - 1;
+    uint64_t prefijo = prefijoClave(palabraBuscada);
+    const uint64_t* prefijos = indice.prefijos.data();
+    size_t k = 1;
+
+    while (k <= n) {
+        // Adelantar la lectura de los descendientes de tres niveles ms abajo.
+        if (8 * k <= n) {
+            _mm_prefetch(reinterpret_cast<const char*>(prefijos + 8 * k), _MM_HINT_T0);
+        }
+
+        uint64_t clave = prefijos[k];
+        size_t derecha = clave < prefijo;
+        if (clave == prefijo) {
+            string_view completa(indice.texto.data() + indice.inicioClave[k], indice.largoClave[k]);
+            derecha = completa < palabraBuscada;
+        }
+        k = 2 * k + derecha;
+    }
+
+    // Deshacer los pasos hacia la derecha del final del recorrido.
+    while (k & 1) k >>= 1;
+    k >>= 1;
+
+    if (k == 0 || prefijos[k] != prefijo) return nullptr;
+    string_view encontrada(indice.texto.data() + indice.inicioClave[k], indice.largoClave[k]);
+    return encontrada == palabraBuscada ? &tablaPalabras.palabras[indice.cargas[k]] : nullptr;
+}
+
+
+
+
+//==========================FUNCIONES DEL NDICE PONDERADO==========================
+
+
+
+// Funcin auxiliar para colocar en preorden las palabras de un rango con la regla de biseccin de Mehlhorn.
+//
+// Parmetros:
+// - ordenados: ndices de los nodos del rbol AVL en orden alfabtico.
+// - acumulados: Peso acumulado antes de cada palabra; la palabra r pesa acumulados[r + 1] - acumulados[r].
+// - desde, hasta: Rango [desde, hasta) de palabras (en orden alfabtico) que forman el subrbol.
+// - indice: ndice ponderado que se est llenando.
+//
+// Retorno:
+// - La posicin de la raz del subrbol, o 0 si el rango est vaco.
+//
+// Proceso:
+// 1. Elige como raz la palabra cuyo tramo de peso contiene la mitad del peso del rango
+//    (bsqueda binaria sobre `acumulados`).
+// 2. Coloca la raz y luego, en forma recursiva, el subrbol izquierdo y el derecho.
+//
+// Notas:
+// - Cada paso deja a lo sumo la mitad del peso en cada lado, por lo que una palabra de peso w queda
+//   a profundidad de a lo sumo log2(W / w) + 1, siendo W el peso total. Como ninguna palabra pesa
+//   menos que la mitad del promedio, la recursin nunca supera unos log2(2n) + 1 niveles.
+
+uint32_t llenarPonderado(const vector<uint32_t>& ordenados, const vector<uint64_t>& acumulados, size_t desde, size_t hasta, IndicePonderado& indice) {
+    if (desde >= hasta) return 0;
+
+    // Primera palabra cuyo tramo [acumulados[r], acumulados[r + 1]) pasa la mitad del rango.
+    uint64_t suma = acumulados[desde] + acumulados[hasta];
+    size_t r = upper_bound(acumulados.begin() + desde + 1, acumulados.begin() + hasta, suma,
+        [](uint64_t suma, uint64_t acumulado) { return suma < 2 * acumulado; }) - acumulados.begin() - 1;
+
+    uint32_t posicion = static_cast<uint32_t>(indice.cargas.size());
+    const Nodo& nodo = nodoEn(ordenados[r]);
+    indice.prefijos.push_back(nodo.prefijo);
+    indice.cargas.push_back(nodo.entrada);
+    indice.izquierda.push_back(0);
+    indice.derecha.push_back(0);
+
+    uint32_t izquierda = llenarPonderado(ordenados, acumulados, desde, r, indice);
+    uint32_t derecha = llenarPonderado(ordenados, acumulados, r + 1, hasta, indice);
+    indice.izquierda[posicion] = izquierda;
+    indice.derecha[posicion] = derecha;
+    return posicion;
+}
+
+
+
+// Funcin para construir (o reconstruir) el ndice ponderado a partir del rbol AVL y del historial.
+//
+// Parmetros:
+// - raiz: ndice del nodo raz del rbol AVL.
+// - ranking: Palabras buscadas por el usuario y cuntas veces (ver `leerRanking`).
+// - indice: ndice ponderado que se reemplazar.
+//
+// Proceso:
+// 1. Recorre el rbol en inorden y cuenta las bsquedas de cada palabra del diccionario.
+// 2. Le da a cada palabra el peso 1 + f * n / B, siendo f sus bsquedas, n la cantidad de palabras y
+//    B el total de bsquedas: el historial reparte la mitad del peso y el resto se reparte igual entre
+//    todas las palabras, para que las que nunca se buscaron no queden demasiado hondo.
+// 3. Arma el rbol con `llenarPonderado` (regla de biseccin de Mehlhorn, O(n log n)), que da una
+//    profundidad promedio a menos de dos comparaciones de la del rbol ptimo para esos pesos.
+//
+// Notas:
+// - Si el usuario no tiene bsquedas de palabras existentes, el ndice queda vaco (pero vigente) y
+//   las bsquedas siguen en el ndice congelado.
+// - Los pesos se guardan multiplicados por B para trabajar con enteros.
+
+void construirIndicePonderado(uint32_t raiz, const vector<pair<string, int>>& ranking, IndicePonderado& indice) {
+    vector<uint32_t> ordenados;
+    recorrerInorden(raiz, ordenados);
+    size_t n = ordenados.size();
+
+    // Contar las bsquedas de cada palabra segn su posicin en orden alfabtico.
+    vector<uint64_t> frecuencias(n, 0);
+    uint64_t totalBusquedas = 0;
+    for (const auto& par : ranking) {
+        uint64_t prefijo = prefijoClave(par.first);
+        auto encontrada = lower_bound(ordenados.begin(), ordenados.end(), par.first,
+            [prefijo](uint32_t nodo, const string& palabra) { return compararClave(palabra, prefijo, nodo) > 0; });
+        if (encontrada == ordenados.end() || compararClave(par.first, prefijo, *encontrada) != 0) continue;
+        frecuencias[encontrada - ordenados.begin()] += par.second;
+        totalBusquedas += par.second;
+    }
+
+    indice.prefijos.assign(1, 0);
+    indice.cargas.assign(1, 0);
+    indice.izquierda.assign(1, 0);
+    indice.derecha.assign(1, 0);
+    indice.vigente = true;
+    indice.busquedas = 0;
+    if (totalBusquedas == 0) {
+        indice.cargas.clear();
+        return;
+    }
+
+    vector<uint64_t> acumulados(n + 1, 0);
+    for (size_t r = 0; r < n; ++r) {
+        acumulados[r + 1] = acumulados[r] + totalBusquedas + frecuencias[r] * n;
+    }
+
+    indice.prefijos.reserve(n + 1);
+    indice.cargas.reserve(n + 1);
+    indice.izquierda.reserve(n + 1);
+    indice.derecha.reserve(n + 1);
+    llenarPonderado(ordenados, acumulados, 0, n, indice);
+}
+
+
+
+// Funcin para buscar una palabra en el ndice ponderado.
+//
+// Parmetros:
+// - indice: ndice ponderado construido con `construirIndicePonderado`.
+// - palabraBuscada: Palabra en espaol que se desea buscar.
+// - comparaciones: Si no es nulo, recibe la cantidad de palabras comparadas.
+//
+// Retorno:
+// - Un puntero a la palabra en `tablaPalabras`, o nullptr si no existe (igual que `buscarCongelado`).
+//
+// Notas:
+// - A diferencia del ndice congelado, se detiene en cuanto encuentra la palabra: as aprovecha
+//   que las palabras frecuentes estn cerca de la raz.
+
+const PalabraInterna* buscarPonderado(const IndicePonderado& indice, const string& palabraBuscada, size_t* comparaciones = nullptr) {
+    uint64_t prefijo = prefijoClave(palabraBuscada);
+    uint32_t k = indice.cargas.size() > 1 ? 1 : 0;
+    size_t pasos = 0;
+
+    while (k) {
+        ++pasos;
+        uint64_t clave = indice.prefijos[k];
+        int comparacion = prefijo < clave ? -1 : 1;
+        if (clave == prefijo) {
+            comparacion = palabraBuscada.compare(cadenaDe(tablaPalabras.palabras[indice.cargas[k]].espanol));
+            if (comparacion == 0) break;
+        }
+        k = comparacion < 0 ? indice.izquierda[k] : indice.derecha[k];
+    }
+
+    if (comparaciones) *comparaciones = pasos;
+    return k ? &tablaPalabras.palabras[indice.cargas[k]] : nullptr;
+}
+
+
+
+
+//==========================FUNCIONES DE LA CACH DE BSQUEDAS==========================
+
+
+
+// Funcin para guardar el resultado de una bsqueda en la cach.
+//
+// Parmetros:
+// - palabra: Palabra buscada.
+// - entrada: Posicin de la palabra en `tablaPalabras`, o CacheBusquedas::SIN_ENTRADA si no existe.
+// - referenciada: Valor inicial del bit de referencia de la ranura.
+//
+// Proceso:
+// 1. Usa una ranura libre si la hay.
+// 2. Si la cach est llena, avanza la manecilla del algoritmo CLOCK: las ranuras referenciadas
+//    desde la ltima vuelta pierden su marca y se saltan; la primera sin marca se reemplaza.
+
+void guardarEnCache(const string& palabra, uint32_t entrada, bool referenciada) {
+    CacheBusquedas& cache = cacheBusquedas;
+    uint32_t ranura;
+    if (!cache.libres.empty()) {
+        ranura = cache.libres.back();
+        cache.libres.pop_back();
+    }
+    else if (cache.ranuras.size() < CacheBusquedas::CAPACIDAD) {
+        ranura = static_cast<uint32_t>(cache.ranuras.size());
+        cache.ranuras.emplace_back();
+    }
+    else {
+        while (cache.ranuras[cache.manecilla].referenciada) {
+            cache.ranuras[cache.manecilla].referenciada = false;
+            cache.manecilla = (cache.manecilla + 1) % cache.ranuras.size();
+        }
+        ranura = static_cast<uint32_t>(cache.manecilla);
+        cache.manecilla = (cache.manecilla + 1) % cache.ranuras.size();
+        cache.posiciones.erase(cache.ranuras[ranura].clave);
+        ++cache.desalojos;
+    }
+
+    cache.ranuras[ranura] = { palabra, entrada, referenciada };
+    cache.posiciones[palabra] = ranura;
+}
+
+
+
+// Funcin para buscar una palabra en el ndice congelado pasando primero por la cach.
+//
+// Parmetros:
+// - indice: ndice congelado del rbol AVL.
+// - palabraBuscada: Palabra en espaol que se desea buscar.
+//
+// Retorno:
+// - Un puntero a la palabra en `tablaPalabras`, o nullptr si no existe (igual que `buscarCongelado`).
+//
+// Proceso:
+// 1. Si la palabra est en la cach, marca su ranura como referenciada y devuelve el resultado guardado.
+// 2. Si no, y el filtro de Bloom no la descarta (`puedeExistir`), la busca en el ndice ponderado (`buscarPonderado`) cuando est vigente y tiene palabras,
+//    o en el ndice congelado (`buscarCongelado`), y guarda el resultado (tambin si no existe, para
+//    que los errores repetidos no recorran el ndice).
+// 3. Suma el acierto o el fallo y su duracin a los contadores de la cach.
+//
+// Notas:
+// - Los resultados se mantienen correctos porque `olvidarEnCache` quita cada palabra agregada o eliminada.
+// - No es segura para varios hilos; se usa solo desde el men.
+
+const PalabraInterna* buscarConCache(const IndiceCongelado& indice, const string& palabraBuscada) {
+    CacheBusquedas& cache = cacheBusquedas;
+    auto inicio = chrono::steady_clock::now();
+
+    const PalabraInterna* palabra;
+    auto encontrada = cache.posiciones.find(palabraBuscada);
+    if (encontrada != cache.posiciones.end()) {
+        RanuraCache& ranura = cache.ranuras[encontrada->second];
+        ranura.referenciada = true;
+        palabra = ranura.entrada == CacheBusquedas::SIN_ENTRADA ? nullptr : &tablaPalabras.palabras[ranura.entrada];
+        ++cache.aciertos;
+        cache.nanosAciertos += chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - inicio).count();
+        return palabra;
+    }
+
+    if (!puedeExistir(palabraBuscada)) {
+        palabra = nullptr;
+    }
+    else if (indicePonderado.vigente && !indicePonderado.cargas.empty()) {
+        palabra = buscarPonderado(indicePonderado, palabraBuscada);
+    }
+    else {
+        palabra = buscarCongelado(indice, palabraBuscada);
+    }
+    uint32_t entrada = palabra ? static_cast<uint32_t>(palabra - tablaPalabras.palabras.data()) : CacheBusquedas::SIN_ENTRADA;
+    guardarEnCache(palabraBuscada, entrada, false);
+    ++cache.fallos;
+    cache.nanosFallos += chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - inicio).count();
+    return palabra;
+}
+
+
+
+// Funcin para quitar una palabra de la cach de bsquedas.
+//
+// Parmetros:
+// - palabra: Palabra en espaol agregada o eliminada del diccionario.
+//
+// Notas:
+// - Se llama desde `indexarTraducciones` y `desindexarTraducciones`, es decir, cada vez que se agrega
+//   o elimina una palabra del rbol. Solo se quita esa palabra; el resto de la cach sigue siendo vlida
+//   porque la posicin de cada palabra en `tablaPalabras` no cambia mientras exista.
+
+void olvidarEnCache(string_view palabra) {
+    CacheBusquedas& cache = cacheBusquedas;
+    if (cache.posiciones.empty()) return;
+
+    auto encontrada = cache.posiciones.find(string(palabra));
+    if (encontrada == cache.posiciones.end()) return;
+
+    uint32_t ranura = encontrada->second;
+    cache.posiciones.erase(encontrada);
+    cache.ranuras[ranura].clave.clear();
+    cache.ranuras[ranura].referenciada = false; // La manecilla no la salta mientras espera en `libres`.
+    cache.libres.push_back(ranura);
+    ++cache.invalidaciones;
+}
+
+
+
+// Funcin para cargar en la cach las palabras ms buscadas por el usuario (ver `prepararCacheUsuario`).
+//
+// Parmetros:
+// - indice: ndice congelado del rbol AVL.
+//
+// Notas:
+// - Se llama desde el men cuando el ndice ya est completo; si no hay palabras pendientes, no hace nada.
+// - Estas bsquedas no cuentan en los aciertos ni en los fallos.
+
+void calentarCache(const IndiceCongelado& indice) {
+    CacheBusquedas& cache = cacheBusquedas;
+    for (const string& palabra : cache.porCalentar) {
+        if (cache.posiciones.count(palabra)) continue;
+        const PalabraInterna* encontrada = buscarCongelado(indice, palabra);
+        if (!encontrada) continue;
+        guardarEnCache(palabra, static_cast<uint32_t>(encontrada - tablaPalabras.palabras.data()), true);
+    }
+    cache.porCalentar.clear();
+}
+
+
+
+// Funcin para mostrar los contadores de la cach de bsquedas.
+//
+// Notas:
+// - La tasa de aciertos y la latencia media de aciertos y fallos permiten decidir si CAPACIDAD
+//   alcanza para las palabras frecuentes de los usuarios.
+
+void mostrarEstadisticasCache() {
+    const CacheBusquedas& cache = cacheBusquedas;
+    uint64_t consultas = cache.aciertos + cache.fallos;
+
+    cout << "\n--- CACHE DE BUSQUEDAS ---\n";
+    cout << "Ranuras ocupadas: " << cache.posiciones.size() << " de " << CacheBusquedas::CAPACIDAD << "\n";
+    cout << "Consultas: " << consultas << " | Aciertos: " << cache.aciertos << " | Fallos: " << cache.fallos << "\n";
+    if (consultas) {
+        cout << "Tasa de aciertos: " << 100.0 * cache.aciertos / consultas << " %\n";
+    }
+    if (cache.aciertos) {
+        cout << "Latencia media de un acierto: " << cache.nanosAciertos / cache.aciertos << " ns\n";
+    }
+    if (cache.fallos) {
+        cout << "Latencia media de un fallo: " << cache.nanosFallos / cache.fallos << " ns\n";
+    }
+    cout << "Desalojos: " << cache.desalojos << " | Invalidaciones: " << cache.invalidaciones << "\n";
+}
+
+
+
+
+//==========================FUNCIONES DE BSQUEDA APROXIMADA==========================
+
+
+
+// Estructura para almacenar una sugerencia de la bsqueda aproximada.
+//
+// Campos:
+// - palabra: Palabra en espaol sugerida (apunta al texto del ndice congelado).
+// - distancia: Cantidad de ediciones (insercin, eliminacin, sustitucin o intercambio de dos
+//   letras vecinas) que separan la palabra sugerida de la palabra buscada.
+
+struct Sugerencia {
+    string_view palabra;
+    int distancia;
+};
+
+
+
+// Funcin para obtener la palabra que ocupa una posicin alfabtica en el ndice congelado.
+//
+// Parmetros:
+// - indice: ndice congelado construido con `congelarIndice`.
+// - posicion: Posicin alfabtica de la palabra, empezando desde 0.
+//
+// Retorno:
+// - La palabra (sin copiarla) guardada en el texto del ndice.
+
+inline string_view claveAlfabetica(const IndiceCongelado& indice, size_t posicion) {
+    uint32_t inicio = indice.inicioAlfabetico[posicion];
+    return string_view(indice.texto.data() + inicio, indice.inicioAlfabetico[posicion + 1] - inicio);
+}
+
+
+
+// Funcin para saltar todas las palabras que comienzan con el mismo prefijo que una palabra.
+//
+// Parmetros:
+// - indice: ndice congelado construido con `congelarIndice`.
+// - desde: Posicin alfabtica de la palabra.
+// - largo: Largo del prefijo que se desea saltar (como mximo MAXIMO_COMUN).
+//
+// Retorno:
+// - La posicin de la primera palabra posterior a `desde` que no comparte esos `largo` caracteres
+//   (o la cantidad de palabras si no hay ninguna).
+//
+// Proceso:
+// 1. Como las palabras con un mismo prefijo son contiguas, el grupo termina en la primera posicin
+//    cuyo `comunConAnterior` es menor que `largo`.
+// 2. Revisa una por una las posiciones hasta el final del bloque actual y luego salta bloques completos
+//    hasta el final del grupo mientras su mnimo no sea menor que `largo`.
+// 3. Si lleg al inicio de un grupo, salta grupos completos y luego bloques de la misma forma.
+// 4. Termina revisando una por una las posiciones del ltimo bloque.
+//
+// Notas:
+// - Solo lee arreglos de bytes consecutivos, sin comparar cadenas.
+
+size_t saltarPrefijo(const IndiceCongelado& indice, size_t desde, size_t largo) {
+    const vector<uint8_t>& comun = indice.comunConAnterior;
+    const size_t BLOQUE = IndiceCongelado::PALABRAS_POR_BLOQUE;
+    const size_t GRUPO = IndiceCongelado::PALABRAS_POR_GRUPO;
+    size_t n = comun.size();
+    size_t r = desde + 1;
+
+    // Terminar el bloque actual.
+    while (r < n && r % BLOQUE != 0) {
+        if (comun[r] < largo) return r;
+        ++r;
+    }
+
+    // Terminar el grupo actual saltando bloques completos.
+    while (r % GRUPO != 0 && r + BLOQUE <= n && indice.minimoComunPorBloque[r / BLOQUE] >= largo) {
+        r += BLOQUE;
+    }
+
+    // Si se lleg al inicio de un grupo, saltar grupos completos y luego bloques completos.
+    if (r % GRUPO == 0) {
+        while (r + GRUPO <= n && indice.minimoComunPorGrupo[r / GRUPO] >= largo) {
+            r += GRUPO;
+        }
+        while (r + BLOQUE <= n && indice.minimoComunPorBloque[r / BLOQUE] >= largo) {
+            r += BLOQUE;
+        }
+    }
+
+    // Encontrar el final exacto dentro del ltimo bloque.
+    while (r < n && comun[r] >= largo) {
+        ++r;
+    }
+    return r;
+}
+
+
+
+// Funcin para buscar las palabras del diccionario ms parecidas a una palabra (bsqueda aproximada).
+//
+// Parmetros:
+// - indice: ndice congelado construido con `congelarIndice`.
+// - palabra: Palabra en espaol buscada (normalmente una que no existe en el diccionario).
+// - distanciaMaxima: Cantidad mxima de ediciones permitidas (1 o 2 en la prctica).
+// - limite: Cantidad mxima de sugerencias.
+//
+// Retorno:
+// - Las sugerencias ordenadas de menor a mayor distancia y, con la misma distancia, alfabticamente.
+//
+// Proceso:
+// 1. Recorre las palabras en orden alfabtico como si fueran las ramas de un rbol de prefijos (trie):
+//    para cada palabra calcula una fila de la matriz de distancia de edicin por cada letra,
+//    reutilizando las filas del prefijo que comparte con la palabra anterior.
+// 2. Si todos los valores de una fila superan la distancia permitida, ninguna palabra con ese prefijo
+//    puede servir, as que salta el grupo completo con `saltarPrefijo`. Lo que la nueva palabra comparte
+//    con la anterior se lee de `comunConAnterior`, sin comparar cadenas.
+// 3. Si la ltima fila deja a la palabra dentro de la distancia permitida, la agrega a las sugerencias.
+// 4. Cuando ya hay `limite` sugerencias, la distancia permitida baja a la de la peor sugerencia, lo que
+//    poda todava ms el recorrido.
+//
+// Notas:
+// - La distancia utilizada es la de Levenshtein ms el intercambio de dos letras vecinas
+//   ("cmaa" -> "cama"), que es uno de los errores de escritura ms comunes.
+// - Gracias a las podas solo se visitan los prefijos que pueden llevar a una sugerencia, en lugar de
+//   comparar la palabra con todo el diccionario.
+// - Las sugerencias apuntan al texto del ndice: dejan de ser vlidas si el ndice se reconstruye.
+
+vector<Sugerencia> buscarAproximadas(const IndiceCongelado& indice, string_view palabra, int distanciaMaxima, size_t limite) {
+    vector<Sugerencia> sugerencias;
+    if (indice.inicioAlfabetico.size() < 2 || limite == 0) return sugerencias;
+
+    size_t n = indice.inicioAlfabetico.size() - 1;
+    size_t m = palabra.size();
+    size_t ancho = m + 1;
+
+    // filas[i * ancho + j]: distancia entre los primeros i caracteres de la clave y los primeros j de la palabra.
+    vector<int> filas(ancho);
+    for (size_t j = 0; j <= m; ++j) filas[j] = static_cast<int>(j);
+
+    size_t calculadas = 0; // Filas vlidas para el prefijo de la clave anterior (sin contar la fila 0).
+    int permitida = distanciaMaxima;
+
+    size_t posicion = 0;
+    while (posicion < n) {
+        string_view clave = claveAlfabetica(indice, posicion);
+
+        // Reutilizar las filas del prefijo comn con la clave anterior. Despus de un salto, lo que
+        // comparten es justamente `comunConAnterior` de la nueva posicin.
+        size_t comun = min(calculadas, static_cast<size_t>(indice.comunConAnterior[posicion]));
+
+        if (filas.size() < (clave.size() + 1) * ancho) filas.resize((clave.size() + 1) * ancho);
+
+        // Calcular las filas restantes, detenindose si una fila ya supera la distancia permitida.
+        size_t i = comun + 1;
+        bool podado = false;
+        for (; i <= clave.size(); ++i) {
+            int* fila = &filas[i * ancho];
+            const int* arriba = fila - ancho;
+            fila[0] = static_cast<int>(i);
+            int minimoFila = fila[0];
+            for (size_t j = 1; j <= m; ++j) {
+                int costo = clave[i - 1] == palabra[j - 1] ? 0 : 1;
+                int valor = min(min(arriba[j] + 1, fila[j - 1] + 1), arriba[j - 1] + costo);
+                if (i > 1 && j > 1 && clave[i - 1] == palabra[j - 2] && clave[i - 2] == palabra[j - 1]) {
+                    valor = min(valor, filas[(i - 2) * ancho + j - 2] + 1); // Intercambio de letras vecinas.
+                }
+                fila[j] = valor;
+                minimoFila = min(minimoFila, valor);
+            }
+            if (minimoFila > permitida && i <= IndiceCongelado::MAXIMO_COMUN) {
+                podado = true;
+                break;
+            }
+        }
+
+        if (podado) {
+            // Ninguna palabra que comience con clave[0..i) puede estar dentro de la distancia.
+            calculadas = i - 1;
+            posicion = saltarPrefijo(indice, posicion, i);
+            continue;
+        }
+        calculadas = clave.size();
+
+        int distancia = filas[clave.size() * ancho + m];
+        if (distancia <= permitida) {
+            // Insertar manteniendo el orden (distancia, alfabtico); las claves llegan en orden alfabtico.
+            auto lugar = upper_bound(sugerencias.begin(), sugerencias.end(), distancia,
+                [](int d, const Sugerencia& s) { return d < s.distancia; });
+            sugerencias.insert(lugar, Sugerencia{ clave, distancia });
+            if (sugerencias.size() > limite) sugerencias.pop_back();
+
+            // Con la lista llena, solo sirven palabras mejores que la peor sugerencia.
+            if (sugerencias.size() == limite) permitida = sugerencias.back().distancia - 1;
+            if (permitida < 0) break; // Ya hay `limite` coincidencias exactas.
+        }
+        ++posicion;
+    }
+
+    return sugerencias;
+}
+
+
+
+
+//==========================FUNCIONES DE BSQUEDA SIN ACENTOS==========================
+
+
+
+// Funcin auxiliar para agregar a una clave normalizada un carcter en minsculas y sin acentos.
+//
+// Parmetros:
+// - punto: Cdigo Unicode del carcter (de 0x80 a 0x7FF).
+// - normalizada: Clave a la que se agrega el carcter, codificado en UTF-8.
+//
+// Notas:
+// - Convierte las letras latinas con diacrticos (de U+00C0 a U+017F) en su letra base: "" y ""
+//   pasan a "a" y "u", y las ligaduras se separan ("" -> "ae", "" -> "ss").
+// - La "" es una letra distinta de la "n" en espaol ("ao" y "ano"), as que solo se pasa a minscula.
+// - Los dems caracteres se copian sin cambios.
+
+void plegarCaracter(uint32_t punto, string& normalizada) {
+    // Letra base de cada carcter de U+00C0 a U+017F: '*' se copia, 'N' es la  y '1' a '4' son ligaduras.
+    static const char BASES[] =
+        "aaaaaa1ceeeeiiiidNooooo*ouuuuy*2"
+        "aaaaaa1ceeeeiiiidNooooo*ouuuuy*y"
+        "aaaaaaccccccccddddeeeeeeeeeegggg"
+        "gggghhhhiiiiiiiiii44jjkkklllllll"
+        "lllnnnnnnnnnoooooo33rrrrrrssssss"
+        "ssttttttuuuuuuuuuuuuwwyyyzzzzzzs";
+
+    char base = punto >= 0xC0 && punto <= 0x17F ? BASES[punto - 0xC0] : '*';
+    switch (base) {
+    case '*':
+        normalizada += static_cast<char>(0xC0 | (punto >> 6));
+        normalizada += static_cast<char>(0x80 | (punto & 0x3F));
+        break;
+    case 'N': normalizada += "\xC3\xB1"; break;
+    case '1': normalizada += "ae"; break;
+    case '2': normalizada += "ss"; break;
+    case '3': normalizada += "oe"; break;
+    case '4': normalizada += "ij"; break;
+    default: normalizada += base; break;
+    }
+}
+
+
+
+// Funcin para obtener la clave normalizada de una palabra: en minsculas y sin acentos, en UTF-8.
+//
+// Parmetros:
+// - palabra: Palabra original.
+// - memoria: Cadena donde se escribe la clave cuando es distinta de la palabra.
+//
+// Retorno:
+// - Una vista de la clave normalizada: la misma `palabra` si ya estaba normalizada o, si no, `memoria`.
+//
+// Proceso:
+// 1. Camino rpido: revisa la palabra de a 16 bytes con SSE2 y termina en cuanto encuentra un byte que
+//    no es ASCII o una mayscula. Si no hay ninguno, devuelve la palabra sin copiarla.
+// 2. Si no, copia lo revisado y sigue carcter por carcter: pasa las maysculas ASCII a minsculas y
+//    decodifica las secuencias UTF-8 de dos bytes para normalizarlas con `plegarCaracter`.
+//
+// Notas:
+// - Un byte que no forma una secuencia UTF-8 vlida se toma como un carcter Latin-1, que es lo que
+//   entrega la consola de Windows: "canci\xF3n" y "cancin" en UTF-8 dan la misma clave.
+// - Las secuencias de tres y cuatro bytes se copian sin cambios.
+
+string_view normalizarClave(string_view palabra, string& memoria) {
+    const unsigned char* datos = reinterpret_cast<const unsigned char*>(palabra.data());
+    size_t n = palabra.size();
+    size_t i = 0;
+
+    // 1. Camino rpido: los bytes no ASCII tienen el bit alto encendido y las maysculas marcan su byte.
+    const __m128i antesDeA = _mm_set1_epi8('A' - 1);
+    const __m128i despuesDeZ = _mm_set1_epi8('Z' + 1);
+    for (; i + 16 <= n; i += 16) {
+        __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(datos + i));
+        __m128i mayusculas = _mm_and_si128(_mm_cmpgt_epi8(bytes, antesDeA), _mm_cmplt_epi8(bytes, despuesDeZ));
+        if (_mm_movemask_epi8(_mm_or_si128(bytes, mayusculas)) != 0) break;
+    }
+    while (i < n && datos[i] < 0x80 && (datos[i] < 'A' || datos[i] > 'Z')) ++i;
+    if (i == n) return palabra;
+
+    // 2. Camino lento desde el primer carcter que cambia (o que no es ASCII).
+    memoria.assign(palabra.data(), i);
+    while (i < n) {
+        unsigned char c = datos[i];
+        if (c < 0x80) {
+            memoria += static_cast<char>(c >= 'A' && c <= 'Z' ? c - 'A' + 'a' : c);
+            ++i;
+        }
+        else if (c >= 0xC2 && c <= 0xDF && i + 1 < n && (datos[i + 1] & 0xC0) == 0x80) {
+            plegarCaracter(((c & 0x1Fu) << 6) | (datos[i + 1] & 0x3Fu), memoria);
+            i += 2;
+        }
+        else {
+            // Secuencias de tres o cuatro bytes completas: se copian. Cualquier otro byte es Latin-1.
+            size_t largo = c >= 0xE0 && c <= 0xEF ? 3 : (c >= 0xF0 && c <= 0xF4 ? 4 : 0);
+            bool valida = largo > 0 && i + largo <= n;
+            for (size_t k = 1; valida && k < largo; ++k) valida = (datos[i + k] & 0xC0) == 0x80;
+            if (valida) {
+                memoria.append(palabra.data() + i, largo);
+                i += largo;
+            }
+            else {
+                plegarCaracter(c, memoria);
+                ++i;
+            }
+        }
+    }
+    return memoria;
+}
+
+
+
+// Funcin auxiliar para obtener la clave normalizada guardada de una palabra del diccionario.
+//
+// Parmetros:
+// - entrada: Posicin de la palabra en `tablaPalabras`.
+//
+// Retorno:
+// - Una vista de la clave normalizada (la palabra misma si no cambia al normalizarla).
+
+string_view claveNormalizada(uint32_t entrada) {
+    uint32_t clave = indiceNormalizado.claves[entrada];
+    if (clave == IndiceNormalizado::IGUAL_A_ORIGINAL) return cadenaDe(tablaPalabras.palabras[entrada].espanol);
+    return cadenaEn(indiceNormalizado.texto.data(), clave);
+}
+
+
+
+// Funcin para construir (o reconstruir) el ndice de claves normalizadas.
+//
+// Parmetros:
+// - indice: ndice congelado con las palabras del diccionario.
+//
+// Proceso:
+// 1. Calcula la clave normalizada de cada palabra con `normalizarClave` y guarda en `texto` las que
+//    son distintas de la palabra.
+// 2. Ubica la clave en la tabla hash (sondeo lineal): si ya estaba, la palabra se agrega a la lista
+//    de esa clave; si no, ocupa la posicin vaca.
+//
+// Notas:
+// - La tabla tiene al menos el doble de posiciones que palabras, por lo que nunca se llena.
+// - Se construye recin en la primera bsqueda que lo necesita y cuesta O(n).
+
+void construirIndiceNormalizado(const IndiceCongelado& indice) {
+    IndiceNormalizado& normalizado = indiceNormalizado;
+    const uint32_t SIN_ENTRADA = IndiceNormalizado::SIN_ENTRADA;
+    size_t n = indice.cargas.empty() ? 0 : indice.cargas.size() - 1;
+
+    size_t tamano = 16;
+    while (tamano < 2 * n) tamano *= 2;
+    size_t mascara = tamano - 1;
+    normalizado.tabla.assign(tamano, SIN_ENTRADA);
+    normalizado.claves.assign(tablaPalabras.palabras.size(), IndiceNormalizado::IGUAL_A_ORIGINAL);
+    normalizado.siguientes.assign(tablaPalabras.palabras.size(), SIN_ENTRADA);
+    normalizado.texto.clear();
+
+    string memoria;
+    for (size_t k = 1; k <= n; ++k) {
+        uint32_t entrada = indice.cargas[k];
+        string_view original = cadenaDe(tablaPalabras.palabras[entrada].espanol);
+        string_view clave = normalizarClave(original, memoria);
+
+        // 1. Guardar la clave si es distinta de la palabra (con el formato del pool de cadenas).
+        if (clave != original) {
+            normalizado.claves[entrada] = static_cast<uint32_t>(normalizado.texto.size());
+            if (clave.size() < 0xFF) {
+                normalizado.texto += static_cast<char>(clave.size());
+            }
+            else {
+                uint32_t largo = static_cast<uint32_t>(clave.size());
+                normalizado.texto += static_cast<char>(0xFF);
+                normalizado.texto.append(reinterpret_cast<const char*>(&largo), sizeof(uint32_t));
+            }
+            normalizado.texto += clave;
+        }
+
+        // 2. Ubicar la clave en la tabla.
+        size_t pos = hashCadena(clave) & mascara;
+        while (normalizado.tabla[pos] != SIN_ENTRADA && claveNormalizada(normalizado.tabla[pos]) != clave) {
+            pos = (pos + 1) & mascara;
+        }
+        normalizado.siguientes[entrada] = normalizado.tabla[pos];
+        normalizado.tabla[pos] = entrada;
+    }
+
+    normalizado.vigente = true;
+}
+
+
+
+// Funcin para buscar las palabras del diccionario que coinciden con una palabra sin distinguir
+// maysculas ni acentos ("cancion" y "CANCION" encuentran "cancin").
+//
+// Parmetros:
+// - indice: ndice congelado construido con `congelarIndice`.
+// - palabra: Palabra buscada, en UTF-8 o Latin-1.
+//
+// Retorno:
+// - Las posiciones en `tablaPalabras` de las palabras que coinciden, ordenadas alfabticamente por su
+//   palabra original. Vaco si no hay ninguna.
+//
+// Notas:
+// - Si el ndice no est vigente, primero lo reconstruye con `construirIndiceNormalizado`.
+// - Las palabras se muestran y se registran con su escritura original; la clave normalizada solo se
+//   usa para encontrarlas.
+
+vector<uint32_t> buscarNormalizada(const IndiceCongelado& indice, string_view palabra) {
+    if (!indiceNormalizado.vigente) construirIndiceNormalizado(indice);
+
+    string memoria;
+    string_view clave = normalizarClave(palabra, memoria);
+    const IndiceNormalizado& normalizado = indiceNormalizado;
+    size_t mascara = normalizado.tabla.size() - 1;
+
+    vector<uint32_t> coincidencias;
+    size_t pos = hashCadena(clave) & mascara;
+    while (normalizado.tabla[pos] != IndiceNormalizado::SIN_ENTRADA) {
+        uint32_t entrada = normalizado.tabla[pos];
+        if (claveNormalizada(entrada) == clave) {
+            for (; entrada != IndiceNormalizado::SIN_ENTRADA; entrada = normalizado.siguientes[entrada]) {
+                coincidencias.push_back(entrada);
+            }
+            break;
+        }
+        pos = (pos + 1) & mascara;
+    }
+
+    sort(coincidencias.begin(), coincidencias.end(), [](uint32_t a, uint32_t b) {
+        return cadenaDe(tablaPalabras.palabras[a].espanol) < cadenaDe(tablaPalabras.palabras[b].espanol);
+    });
+    return coincidencias;
+}
+
+
+
+
+//==========================FUNCIONES DE LECTURA CONCURRENTE==========================
+
+
+
+// Estructura con una versin inmutable del diccionario que los lectores recorren sin bloqueos.
+//
+// Campos:
+// - raiz: ndice de la raz del rbol AVL en esta versin.
+// - bloques: Tabla de bloques del pool de nodos vigente al publicar la versin.
+// - palabras: Inicio de la tabla de palabras vigente al publicar la versin.
+// - texto: Inicio del bloque de texto del pool de cadenas vigente al publicar la versin.
+//
+// Notas:
+// - El escritor nunca modifica un nodo, una palabra ni un bloque alcanzable desde una instantnea
+//   publicada: copia el camino que cambia y publica una instantnea nueva (ver `agregarConcurrente`).
+// - Lo que deja de ser alcanzable se retira y se libera por pocas, cuando ningn lector puede
+//   estar usndolo todava (ver `intentarAvanzarEpoca`).
+
+struct Instantanea {
+    uint32_t raiz;
+    Nodo* const* bloques;
+    const PalabraInterna* palabras;
+    const char* texto;
+};
+
+
+
+// Estructura con el estado de un hilo lector registrado.
+//
+// Campos:
+// - epoca: poca en la que el lector entr a leer, o 0 si no est leyendo.
+// - ocupada: Indica si la ranura pertenece a un lector registrado.
+//
+// Notas:
+// - Cada ranura ocupa su propia lnea de cach para que los lectores no se estorben al
+//   marcar su entrada y salida.
+
+struct alignas(64) RanuraLector {
+    atomic<uint64_t> epoca{ 0 };
+    atomic<bool> ocupada{ false };
+};
+
+
+
+// Estructura para administrar el modo de lectura concurrente del diccionario.
+//
+// Campos:
+// - actual: Instantnea publicada; los lectores la obtienen con `entrarLectura`.
+// - epocaGlobal: poca actual de la reclamacin (comienza en 1; 0 significa "sin leer").
+// - lectores: Ranuras de los hilos lectores registrados.
+// - raiz: Raz de la versin ms reciente (solo la usa el escritor).
+// - activo: Indica si el modo concurrente est activo.
+// - nodosPendientes, entradasPendientes, bloquesPendientes: Lo que la operacin en curso dej de usar;
+//   se retira al publicar la instantnea nueva.
+// - nodosNuevos: Nodos creados por la operacin en curso, que todava puede modificar sin copiarlos.
+// - nodosRetirados, entradasRetiradas, bloquesRetirados: Lo retirado en cada poca (ndice `poca % 3`).
+//
+// Uso:
+// - Un solo hilo escritor llama a `activarLecturaConcurrente`, `agregarConcurrente`,
+//   `eliminarConcurrente` y `desactivarLecturaConcurrente`.
+// - Cualquier cantidad de hilos (hasta MAXIMO_LECTORES) llaman a `buscarConcurrente` al mismo tiempo.
+
+struct DiccionarioConcurrente {
+    static const int MAXIMO_LECTORES = 64;
+
+    atomic<const Instantanea*> actual{ nullptr };
+    atomic<uint64_t> epocaGlobal{ 1 };
+    RanuraLector lectores[MAXIMO_LECTORES];
+
+    uint32_t raiz = 0;
+    bool activo = false;
+
+    vector<uint32_t> nodosPendientes;
+    vector<uint32_t> entradasPendientes;
+    vector<function<void()>> bloquesPendientes;
+    vector<uint32_t> nodosNuevos;
+
+    vector<uint32_t> nodosRetirados[3];
+    vector<uint32_t> entradasRetiradas[3];
+    vector<function<void()>> bloquesRetirados[3];
+};
+
+
+// Estado global del modo de lectura concurrente.
+DiccionarioConcurrente diccionarioConcurrente;
+
+
+
+// Funcin para registrar el hilo actual como lector del diccionario.
+//
+// Retorno:
+// - El nmero de ranura del lector, o -1 si ya hay MAXIMO_LECTORES lectores registrados.
+
+int registrarLector() {
+    for (int i = 0; i < DiccionarioConcurrente::MAXIMO_LECTORES; ++i) {
+        bool libre = false;
+        if (diccionarioConcurrente.lectores[i].ocupada.compare_exchange_strong(libre, true)) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+
+
+// Funcin para liberar la ranura de un lector que ya no va a leer.
+//
+// Parmetros:
+// - lector: Ranura devuelta por `registrarLector`.
+
+void liberarLector(int lector) {
+    diccionarioConcurrente.lectores[lector].epoca.store(0);
+    diccionarioConcurrente.lectores[lector].ocupada.store(false);
+}
+
+
+
+// Funcin para comenzar una lectura y obtener la instantnea vigente.
+//
+// Parmetros:
+// - lector: Ranura devuelta por `registrarLector`.
+//
+// Retorno:
+// - La instantnea publicada, que puede recorrerse hasta llamar a `salirLectura`.
+//
+// Proceso:
+// 1. Anuncia en su ranura la poca global que observ.
+// 2. Vuelve a leer la poca global; si cambi mientras tanto, repite el anuncio.
+// 3. Lee la instantnea publicada.
+//
+// Notas:
+// - Mientras el lector anuncie una poca, el escritor no puede avanzar ms de una poca
+//   y, por lo tanto, no libera nada de lo que esta instantnea alcanza.
+
+const Instantanea* entrarLectura(int lector) {
+    RanuraLector& ranura = diccionarioConcurrente.lectores[lector];
+    uint64_t epoca = diccionarioConcurrente.epocaGlobal.load();
+    while (true) {
+        ranura.epoca.store(epoca);
+        uint64_t vigente = diccionarioConcurrente.epocaGlobal.load();
+        if (vigente == epoca) break;
+        epoca = vigente;
+    }
+    return diccionarioConcurrente.actual.load();
+}
+
+
+
+// Funcin para terminar una lectura comenzada con `entrarLectura`.
+//
+// Parmetros:
+// - lector: Ranura devuelta por `registrarLector`.
+//
+// Notas:
+// - Despus de llamarla no deben usarse la instantnea ni las vistas obtenidas de ella.
+
+void salirLectura(int lector) {
+    diccionarioConcurrente.lectores[lector].epoca.store(0);
+}
+
+
+
+// Funcin para buscar una palabra sin bloqueos mientras otro hilo modifica el diccionario.
+//
+// Parmetros:
+// - lector: Ranura devuelta por `registrarLector`.
+// - palabraBuscada: Palabra en espaol que se desea buscar.
+// - resultado: Objeto donde se copian la palabra y sus traducciones si se encuentra.
+//
+// Retorno:
+// - true si la palabra est en la instantnea vigente, false en caso contrario.
+//
+// Proceso:
+// 1. Entra a leer y obtiene la instantnea publicada.
+// 2. Desciende por el rbol igual que `buscar`, pero leyendo los nodos, las palabras y las cadenas
+//    a travs de la instantnea en lugar del pool global.
+// 3. Copia las traducciones antes de salir, porque despus pueden liberarse.
+
+bool buscarConcurrente(int lector, string_view palabraBuscada, Palabra& resultado) {
+    const Instantanea* instantanea = entrarLectura(lector);
+    uint64_t prefijo = prefijoClave(palabraBuscada);
+    uint32_t nodo = instantanea->raiz;
+    bool encontrada = false;
+
+    while (nodo) {
+        const Nodo& n = instantanea->bloques[nodo >> PoolNodos::BITS_POR_BLOQUE][nodo & (PoolNodos::NODOS_POR_BLOQUE - 1)];
+        const PalabraInterna* p = nullptr;
+        int comparacion;
+        if (prefijo != n.prefijo) {
+            comparacion = prefijo < n.prefijo ? -1 : 1;
+        }
+        else {
+            p = &instantanea->palabras[n.entrada];
+            comparacion = palabraBuscada.compare(cadenaEn(instantanea->texto, p->espanol));
+        }
+
+        if (comparacion == 0) {
+            resultado.espanol = cadenaEn(instantanea->texto, p->espanol);
+            resultado.ingles = cadenaEn(instantanea->texto, p->ingles);
+            resultado.aleman = cadenaEn(instantanea->texto, p->aleman);
+            resultado.frances = cadenaEn(instantanea->texto, p->frances);
+            resultado.italiano = cadenaEn(instantanea->texto, p->italiano);
+            encontrada = true;
+            break;
+        }
+        nodo = comparacion < 0 ? n.izquierda : n.derecha;
+    }
+
+    salirLectura(lector);
+    return encontrada;
+}
+
+
+
+// Funcin para liberar lo que se retir en una poca.
+//
+// Parmetros:
+// - indice: Posicin de la poca en las listas de retirados (`poca % 3`).
+//
+// Proceso:
+// 1. Devuelve los nodos al pool con `destruirNodo` y las palabras a la tabla con `liberarEntrada`.
+// 2. Libera los bloques de memoria reemplazados al agrandar el pool o la tabla.
+
+void reclamarRetirados(int indice) {
+    for (uint32_t nodo : diccionarioConcurrente.nodosRetirados[indice]) {
+        destruirNodo(nodo);
+    }
+    for (uint32_t entrada : diccionarioConcurrente.entradasRetiradas[indice]) {
+        liberarEntrada(entrada);
+    }
+    for (function<void()>& liberar : diccionarioConcurrente.bloquesRetirados[indice]) {
+        liberar();
+    }
+
+    diccionarioConcurrente.nodosRetirados[indice].clear();
+    diccionarioConcurrente.entradasRetiradas[indice].clear();
+    diccionarioConcurrente.bloquesRetirados[indice].clear();
+}
+
+
+
+// Funcin para avanzar la poca global si todos los lectores ya la observaron.
+//
+// Retorno:
+// - true si la poca avanz, false si algn lector sigue en una poca anterior.
+//
+// Proceso:
+// 1. Verifica que cada lector est fuera de una lectura o en la poca global `e`.
+// 2. Avanza la poca global a `e + 1`.
+// 3. Libera lo retirado en la poca `e - 2`: se retir despus de publicar una instantnea que ya
+//    no lo alcanza, y todo lector que pudo ver la instantnea anterior ya termin su lectura.
+
+bool intentarAvanzarEpoca() {
+    uint64_t epoca = diccionarioConcurrente.epocaGlobal.load();
+    for (const RanuraLector& ranura : diccionarioConcurrente.lectores) {
+        uint64_t observada = ranura.epoca.load();
+        if (observada != 0 && observada != epoca) return false;
+    }
+
+    diccionarioConcurrente.epocaGlobal.store(epoca + 1);
+    reclamarRetirados(static_cast<int>((epoca + 1) % 3)); // Misma posicin que la poca `e - 2`.
+    return true;
+}
+
+
+
+// Funcin para agrandar los bloques que comparten los lectores sin moverlos debajo de ellos.
+//
+// Parmetros:
+// - largoCadenas: Bytes que pueden agregarse al pool de cadenas en la operacin (0 si no agrega cadenas).
+//
+// Proceso:
+// 1. Si la tabla de bloques del pool de nodos, la tabla de palabras o el bloque de texto no tienen
+//    capacidad para la operacin, copia su contenido a un bloque nuevo con el doble de capacidad.
+// 2. El bloque anterior no se libera enseguida: queda pendiente y se retira al publicar, porque
+//    la instantnea vigente todava apunta a l.
+//
+// Notas:
+// - Con la capacidad asegurada, `reservarNodo`, `crearNodo` e `internarCadena` agregan al final
+//   sin mover la memoria que leen los lectores.
+
+void asegurarCapacidadConcurrente(size_t largoCadenas) {
+    if (poolNodos.bloques.size() == poolNodos.bloques.capacity()) {
+        vector<Nodo*> nuevos;
+        nuevos.reserve(poolNodos.bloques.capacity() * 2 + 16);
+        nuevos.assign(poolNodos.bloques.begin(), poolNodos.bloques.end());
+        nuevos.swap(poolNodos.bloques);
+        diccionarioConcurrente.bloquesPendientes.push_back([anteriores = move(nuevos)]() mutable {
+            vector<Nodo*>().swap(anteriores);
+        });
+    }
+
+    if (tablaPalabras.libres.empty() && tablaPalabras.palabras.size() == tablaPalabras.palabras.capacity()) {
+        vector<PalabraInterna> nuevas;
+        nuevas.reserve(tablaPalabras.palabras.capacity() * 2 + 1024);
+        nuevas.assign(tablaPalabras.palabras.begin(), tablaPalabras.palabras.end());
+        nuevas.swap(tablaPalabras.palabras);
+        diccionarioConcurrente.bloquesPendientes.push_back([anteriores = move(nuevas)]() mutable {
+            vector<PalabraInterna>().swap(anteriores);
+        });
+    }
+
+    if (poolCadenas.texto.size() + largoCadenas > poolCadenas.texto.capacity()) {
+        string nuevo;
+        nuevo.reserve(max(poolCadenas.texto.capacity() * 2, poolCadenas.texto.size() + largoCadenas));
+        nuevo.assign(poolCadenas.texto.begin(), poolCadenas.texto.end());
+        nuevo.swap(poolCadenas.texto);
+        diccionarioConcurrente.bloquesPendientes.push_back([anterior = move(nuevo)]() mutable {
+            string().swap(anterior);
+        });
+    }
+}
+
+
+
+// Funcin para publicar la versin ms reciente del diccionario para los lectores.
+//
+// Proceso:
+// 1. Crea una instantnea con la raz del escritor y los bloques vigentes, y la publica.
+// 2. Retira, en la poca actual, la instantnea anterior y todo lo que la operacin dej de usar.
+// 3. Intenta avanzar la poca para liberar lo retirado hace dos pocas.
+
+void publicarInstantanea() {
+    Instantanea* nueva = new Instantanea;
+    nueva->raiz = diccionarioConcurrente.raiz;
+    nueva->bloques = poolNodos.bloques.data();
+    nueva->palabras = tablaPalabras.palabras.data();
+    nueva->texto = poolCadenas.texto.data();
+    const Instantanea* anterior = diccionarioConcurrente.actual.exchange(nueva);
+
+    int indice = static_cast<int>(diccionarioConcurrente.epocaGlobal.load() % 3);
+    vector<uint32_t>& nodos = diccionarioConcurrente.nodosRetirados[indice];
+    nodos.insert(nodos.end(), diccionarioConcurrente.nodosPendientes.begin(), diccionarioConcurrente.nodosPendientes.end());
+    vector<uint32_t>& entradas = diccionarioConcurrente.entradasRetiradas[indice];
+    entradas.insert(entradas.end(), diccionarioConcurrente.entradasPendientes.begin(), diccionarioConcurrente.entradasPendientes.end());
+    vector<function<void()>>& bloques = diccionarioConcurrente.bloquesRetirados[indice];
+    for (function<void()>& liberar : diccionarioConcurrente.bloquesPendientes) {
+        bloques.push_back(move(liberar));
+    }
+    if (anterior) {
+        bloques.push_back([anterior]() { delete anterior; });
+    }
+
+    diccionarioConcurrente.nodosPendientes.clear();
+    diccionarioConcurrente.entradasPendientes.clear();
+    diccionarioConcurrente.bloquesPendientes.clear();
+    diccionarioConcurrente.nodosNuevos.clear();
+
+    intentarAvanzarEpoca();
+}
+
+
+
+// Funcin para copiar un nodo publicado antes de modificarlo (copia del camino).
+//
+// Parmetros:
+// - nodo: ndice del nodo que se desea modificar.
+//
+// Retorno:
+// - El ndice de una copia que la operacin puede modificar libremente. Si el nodo ya fue creado
+//   por la operacin en curso, se retorna el mismo nodo.
+//
+// Notas:
+// - El nodo original queda pendiente de retirar: los lectores pueden seguir recorrindolo
+//   hasta que se libere por pocas.
+
+uint32_t copiarNodo(uint32_t nodo) {
+    vector<uint32_t>& nuevos = diccionarioConcurrente.nodosNuevos;
+    if (find(nuevos.begin(), nuevos.end(), nodo) != nuevos.end()) return nodo;
+
+    Nodo original = nodoEn(nodo);
+    uint32_t copia = reservarNodo(original.prefijo, original.entrada);
+    Nodo& n = nodoEn(copia);
+    n.izquierda = original.izquierda;
+    n.derecha = original.derecha;
+    n.tamano = original.tamano;
+    n.altura = original.altura;
+
+    nuevos.push_back(copia);
+    diccionarioConcurrente.nodosPendientes.push_back(nodo);
+    return copia;
+}
+
+
+
+// Funcin para rebalancear un nodo copiado sin modificar nodos publicados.
+//
+// Parmetros:
+// - nodo: ndice de un nodo creado por la operacin en curso.
+//
+// Retorno:
+// - El ndice de la raz del subrbol despus de balancearlo.
+//
+// Proceso:
+// 1. Si el nodo est desbalanceado, copia el hijo ms alto y, en los casos dobles,
+//    tambin el nieto que participa en la rotacin.
+// 2. Aplica `rebalancear`, que ahora solo rota nodos propios de la operacin.
+
+uint32_t rebalancearCopiando(uint32_t nodo) {
+    actualizarAltura(nodo);
+    int balance = factorBalance(nodo);
+
+    if (balance > 1) {
+        uint32_t izquierda = copiarNodo(nodoEn(nodo).izquierda);
+        nodoEn(nodo).izquierda = izquierda;
+        if (factorBalance(izquierda) < 0) {
+            uint32_t nieto = copiarNodo(nodoEn(izquierda).derecha);
+            nodoEn(izquierda).derecha = nieto;
+        }
+    }
+    else if (balance < -1) {
+        uint32_t derecha = copiarNodo(nodoEn(nodo).derecha);
+        nodoEn(nodo).derecha = derecha;
+        if (factorBalance(derecha) > 0) {
+            uint32_t nieto = copiarNodo(nodoEn(derecha).izquierda);
+            nodoEn(derecha).izquierda = nieto;
+        }
+    }
+
+    return rebalancear(nodo);
+}
+
+
+
+// Funcin para insertar una palabra copiando el camino en lugar de modificarlo.
+//
+// Parmetros:
+// - nodo: ndice del nodo raz del subrbol donde se realizar la insercin.
+// - nuevaPalabra: Palabra con sus traducciones.
+// - prefijo: Prefijo de la palabra en espaol (ver `prefijoClave`).
+// - insertada: Se pone en true si la palabra se insert (no exista).
+//
+// Retorno:
+// - El ndice de la raz del subrbol resultante. Si la palabra ya exista, el mismo `nodo`.
+//
+// Notas:
+// - Solo se copian los nodos del camino desde la raz hasta la hoja nueva (y los que rotan);
+//   el resto del rbol se comparte con la versin anterior.
+
+uint32_t insertarCopiando(uint32_t nodo, const Palabra& nuevaPalabra, uint64_t prefijo, bool& insertada) {
+    if (!nodo) {
+        uint32_t nuevo = crearNodo(vistaDe(nuevaPalabra));
+        indexarTraducciones(nodoEn(nuevo).entrada);
+        diccionarioConcurrente.nodosNuevos.push_back(nuevo);
+        insertada = true;
+        return nuevo;
+    }
+
+    int comparacion = compararClave(nuevaPalabra.espanol, prefijo, nodo);
+    if (comparacion == 0) return nodo; // No se permiten duplicados.
+
+    uint32_t hijo = insertarCopiando(comparacion < 0 ? nodoEn(nodo).izquierda : nodoEn(nodo).derecha,
+        nuevaPalabra, prefijo, insertada);
+    if (!insertada) return nodo;
+
+    uint32_t copia = copiarNodo(nodo);
+    if (comparacion < 0) nodoEn(copia).izquierda = hijo;
+    else nodoEn(copia).derecha = hijo;
+    return rebalancearCopiando(copia);
+}
+
+
+
+// Funcin para eliminar una palabra copiando el camino en lugar de modificarlo.
+//
+// Parmetros:
+// - nodo: ndice del nodo raz del subrbol donde se realizar la eliminacin.
+// - palabra: Palabra en espaol que se desea eliminar.
+// - liberarPalabra: Igual que en `eliminarPalabra`; false solo al quitar el sucesor en el Caso 3.
+// - eliminada: Se pone en true si la palabra se encontr.
+//
+// Retorno:
+// - El ndice de la raz del subrbol resultante. Si la palabra no exista, el mismo `nodo`.
+//
+// Proceso:
+// 1. Desciende como `eliminarPalabra`; al volver, copia cada nodo del camino y le asigna el hijo nuevo.
+// 2. Caso 1 y Caso 2: retira el nodo y retorna su nico hijo (o 0), que se comparte sin copiarlo.
+// 3. Caso 3: copia el nodo, le da la palabra del sucesor y elimina el sucesor del subrbol derecho.
+//    A diferencia de `eliminarPalabra`, nunca sobrescribe un nodo publicado con su hijo.
+// 4. La palabra eliminada queda pendiente de retirar en lugar de liberarse enseguida.
+
+uint32_t eliminarCopiando(uint32_t nodo, string_view palabra, bool liberarPalabra, bool& eliminada) {
+    if (!nodo) return 0;
+
+    uint32_t copia;
+    int comparacion = compararClave(palabra, prefijoClave(palabra), nodo);
+    if (comparacion != 0) {
+        uint32_t hijo = eliminarCopiando(comparacion < 0 ? nodoEn(nodo).izquierda : nodoEn(nodo).derecha,
+            palabra, liberarPalabra, eliminada);
+        if (!eliminada) return nodo;
+
+        copia = copiarNodo(nodo);
+        if (comparacion < 0) nodoEn(copia).izquierda = hijo;
+        else nodoEn(copia).derecha = hijo;
+    }
+    else {
+        eliminada = true;
+        Nodo actual = nodoEn(nodo);
+        if (liberarPalabra) {
+            desindexarTraducciones(actual.entrada);
+            diccionarioConcurrente.entradasPendientes.push_back(actual.entrada);
+        }
+
+        if (!actual.izquierda || !actual.derecha) {
+            // Caso 1 y Caso 2: el hijo (si existe) ocupa el lugar del nodo.
+            diccionarioConcurrente.nodosPendientes.push_back(nodo);
+            return actual.izquierda ? actual.izquierda : actual.derecha;
+        }
+
+        // Caso 3: tomar la palabra del sucesor y eliminarlo del subrbol derecho.
+        uint32_t sucesor = minimo(actual.derecha);
+        copia = copiarNodo(nodo);
+        nodoEn(copia).entrada = nodoEn(sucesor).entrada;
+        nodoEn(copia).prefijo = nodoEn(sucesor).prefijo;
+        bool sucesorEliminado = false;
+        uint32_t derecha = eliminarCopiando(actual.derecha, cadenaDe(palabraDe(sucesor).espanol), false, sucesorEliminado);
+        nodoEn(copia).derecha = derecha;
+    }
+
+    return rebalancearCopiando(copia);
+}
+
+
+
+// Funcin para activar el modo de lectura concurrente sobre un rbol cargado.
+//
+// Parmetros:
+// - raiz: ndice de la raz del rbol AVL.
+//
+// Proceso:
+// 1. Reserva capacidad extra en la tabla de bloques, la tabla de palabras y el pool de cadenas,
+//    para que agregar palabras casi nunca tenga que moverlos.
+// 2. Publica la primera instantnea.
+//
+// Notas:
+// - Mientras el modo est activo, el rbol solo debe modificarse con `agregarConcurrente` y
+//   `eliminarConcurrente`, desde un nico hilo escritor.
+// - Las traducciones de todos los idiomas deben estar cargadas (ver `cargarColumnas`): los lectores
+//   no pueden cargarlas.
+
+void activarLecturaConcurrente(uint32_t raiz) {
+    poolNodos.bloques.reserve(poolNodos.bloques.size() * 2 + 16);
+    tablaPalabras.palabras.reserve(tablaPalabras.palabras.size() + tablaPalabras.palabras.size() / 4 + 1024);
+    poolCadenas.texto.reserve(poolCadenas.texto.size() + poolCadenas.texto.size() / 4 + 65536);
+
+    diccionarioConcurrente.raiz = raiz;
+    diccionarioConcurrente.activo = true;
+    publicarInstantanea();
+}
+
+
+
+// Funcin para agregar una palabra mientras otros hilos leen el diccionario.
+//
+// Parmetros:
+// - nuevaPalabra: Palabra con sus traducciones.
+//
+// Retorno:
+// - true si la palabra se agreg, false si ya exista.
+//
+// Proceso:
+// 1. Asegura capacidad para la palabra con `asegurarCapacidadConcurrente`.
+// 2. Inserta copiando el camino (`insertarCopiando`) y publica la nueva raz.
+
+bool agregarConcurrente(const Palabra& nuevaPalabra) {
+    size_t largoCadenas = nuevaPalabra.espanol.size() + nuevaPalabra.ingles.size() + nuevaPalabra.aleman.size()
+        + nuevaPalabra.frances.size() + nuevaPalabra.italiano.size() + 5 * 5;
+    asegurarCapacidadConcurrente(largoCadenas);
+
+    bool insertada = false;
+    diccionarioConcurrente.raiz = insertarCopiando(diccionarioConcurrente.raiz, nuevaPalabra,
+        prefijoClave(nuevaPalabra.espanol), insertada);
+    publicarInstantanea();
+    return insertada;
+}
+
+
+
+// Funcin para eliminar una palabra mientras otros hilos leen el diccionario.
+//
+// Parmetros:
+// - palabra: Palabra en espaol que se desea eliminar.
+//
+// Retorno:
+// - true si la palabra se elimin, false si no exista.
+
+bool eliminarConcurrente(string_view palabra) {
+    asegurarCapacidadConcurrente(0);
+
+    bool eliminada = false;
+    diccionarioConcurrente.raiz = eliminarCopiando(diccionarioConcurrente.raiz, palabra, true, eliminada);
+    publicarInstantanea();
+    return eliminada;
+}
+
+
+
+// Funcin para desactivar el modo de lectura concurrente.
+//
+// Retorno:
+// - El ndice de la raz de la versin ms reciente del rbol.
+//
+// Proceso:
+// 1. Espera a que ningn lector est dentro de una lectura.
+// 2. Libera todo lo retirado y la ltima instantnea.
+//
+// Notas:
+// - Se debe llamar despus de que los hilos lectores terminen; luego el rbol vuelve a
+//   modificarse con `insertar` y `eliminarPalabra`, y los ndices que dependen de l
+//   (como el ndice congelado) deben reconstruirse.
+
+uint32_t desactivarLecturaConcurrente() {
+    for (const RanuraLector& ranura : diccionarioConcurrente.lectores) {
+        while (ranura.epoca.load() != 0) {
+            this_thread::yield();
+        }
+    }
+
+    for (int i = 0; i < 3; ++i) {
+        reclamarRetirados(i);
+    }
+    delete diccionarioConcurrente.actual.exchange(nullptr);
+    diccionarioConcurrente.activo = false;
+    return diccionarioConcurrente.raiz;
+}
+
+
+
+
+//==========================FUNCIONES DEL DICCIONARIO BINARIO==========================
+
+
+
+// Estructura de la cabecera del diccionario binario (`diccionario.umg`).
+//
+// Campos:
+// - firma: Los caracteres "TRDB", para reconocer el archivo.
+// - version: Versin del formato (VERSION_DICCIONARIO_BINARIO); otra versin se descarta.
+// - cantidad: Cantidad de palabras.
+// - largoTexto: Bytes del bloque de texto.
+// - tamanoBase, tamanoCambios: Tamao de `palabras.umg` y `cambios.umg` al guardar el archivo binario.
+//   Si al abrirlo no coinciden, los archivos de texto cambiaron y el binario ya no es vlido.
+// - registrosBase, registrosCambios: Contadores del registro de cambios (ver `RegistroCambios`).
+// - bloquesFiltro, bitsPorClave, funcionesFiltro: Tamao y parmetros del filtro de Bloom (ver `FiltroBloom`).
+// - suma: Suma de verificacin de todo lo que sigue a la cabecera (ver `sumaVerificacion`).
+//
+// Notas:
+// - Despus de la cabecera vienen, sin separacin:
+//   0. El filtro de Bloom de las palabras en espaol: `bloquesFiltro` bloques de 64 bytes.
+//   1. `cantidad` prefijos de 64 bits de las palabras en espaol, en orden alfabtico (tabla de claves).
+//   2. `cantidad` posiciones de 32 bits de cada palabra en espaol dentro del texto, en el mismo orden.
+//   3. El bloque de texto con las palabras en espaol, con el mismo formato que `poolCadenas.texto`
+//      (longitud seguida de la cadena).
+// - Las traducciones se guardan aparte, una columna por idioma (ver `CabeceraColumna`).
+// - Los nmeros se guardan tal como estn en memoria (little-endian en Windows x86/x64).
+
+struct CabeceraBinaria {
+    char firma[4];
+    uint32_t version;
+    uint64_t cantidad;
+    uint64_t largoTexto;
+    uint64_t tamanoBase;
+    uint64_t tamanoCambios;
+    uint64_t registrosBase;
+    uint64_t registrosCambios;
+    uint64_t bloquesFiltro;
+    uint32_t bitsPorClave;
+    uint32_t funcionesFiltro;
+    uint64_t suma;
+};
+
+
+// Versin actual del formato del diccionario binario.
+const uint32_t VERSION_DICCIONARIO_BINARIO = 3;
+
+
+
+// Estructura de la cabecera de una columna de traducciones (`columna_<idioma>.umg`).
+//
+// Campos:
+// - firma: Los caracteres "TRDC", para reconocer el archivo.
+// - idioma: Idioma de las traducciones (ver `Idioma`).
+// - cantidad: Cantidad de filas; la fila i es la traduccin de la palabra i del diccionario binario.
+// - largoTexto: Bytes del bloque de texto.
+// - sumaDiccionario: Suma de verificacin del diccionario binario guardado junto con la columna.
+//   Si no coincide con la del diccionario abierto, la columna pertenece a otra versin y se descarta.
+// - suma: Suma de verificacin de todo lo que sigue a la cabecera.
+//
+// Notas:
+// - Despus de la cabecera vienen `cantidad` posiciones de 32 bits dentro del texto y el bloque de texto,
+//   con el mismo formato que el del diccionario binario. Las traducciones repetidas se guardan una sola vez.
+
+struct CabeceraColumna {
+    char firma[4];
+    uint32_t idioma;
+    uint64_t cantidad;
+    uint64_t largoTexto;
+    uint64_t sumaDiccionario;
+    uint64_t suma;
+};
+
+
+
+// Estructura con un diccionario binario abierto y mapeado en memoria.
+//
+// Campos:
+// - archivo, mapeo: Manejadores de Windows del archivo y de su mapeo.
+// - datos: Inicio del archivo mapeado (nullptr si no hay un diccionario abierto).
+// - cabecera, filtro, prefijos, claves, texto: Secciones del archivo, usadas directamente sin copiarlas.
+// - cantidad: Cantidad de palabras.
+// - cargador: Hilo que construye el rbol AVL a partir del archivo (ver `iniciarCargaBinaria`).
+//
+// Uso:
+// - Mientras `datos` no sea nulo, las bsquedas se resuelven en el archivo con `buscarBinario`.
+
+struct DiccionarioBinario {
+    HANDLE archivo = INVALID_HANDLE_VALUE;
+    HANDLE mapeo = nullptr;
+    const char* datos = nullptr;
+
+    const CabeceraBinaria* cabecera = nullptr;
+    const uint64_t* filtro = nullptr;
+    const uint64_t* prefijos = nullptr;
+    const uint32_t* claves = nullptr;
+    const char* texto = nullptr;
+    size_t cantidad = 0;
+
+    thread cargador;
+};
+
+
+
+// Funcin para calcular la suma de verificacin de un bloque de datos.
+//
+// Parmetros:
+// - datos: Inicio del bloque.
+// - largo: Cantidad de bytes del bloque.
+//
+// Retorno:
+// - Un entero de 64 bits que cambia si cambia cualquier byte del bloque.
+//
+// Notas:
+// - Procesa 32 bytes por vuelta en cuatro sumas independientes para que validar un diccionario
+//   de millones de palabras tome pocos milisegundos.
+
+uint64_t sumaVerificacion(const char* datos, size_t largo) {
+    const uint64_t MULTIPLICADOR = 0x9E3779B97F4A7C15ull;
+    uint64_t sumas[4] = { largo, 1, 2, 3 };
+    size_t i = 0;
+
+    for (; i + 32 <= largo; i += 32) {
+        for (int j = 0; j < 4; ++j) {
+            uint64_t valor;
+            memcpy(&valor, datos + i + 8 * j, sizeof(uint64_t));
+            sumas[j] = (sumas[j] ^ valor) * MULTIPLICADOR;
+            sumas[j] ^= sumas[j] >> 29;
+        }
+    }
+
+    uint64_t suma = sumas[0] ^ (sumas[1] * 3) ^ (sumas[2] * 5) ^ (sumas[3] * 7);
+    for (; i < largo; ++i) {
+        suma = (suma ^ static_cast<unsigned char>(datos[i])) * MULTIPLICADOR;
+    }
+    return suma ^ (suma >> 32);
+}
+
+
+
+// Funcin para obtener el tamao de un archivo, o 0 si no existe.
+//
+// Parmetros:
+// - ruta: Ruta del archivo.
+
+uint64_t tamanoArchivo(const string& ruta) {
+    error_code error;
+    uint64_t tamano = fs::file_size(ruta, error);
+    return error ? 0 : tamano;
+}
+
+
+
+// Funcin para mapear un archivo completo en memoria de solo lectura.
+//
+// Parmetros:
+// - ruta: Ruta del archivo.
+// - archivo, mapeo: Variables donde se guardan los manejadores de Windows del archivo y de su mapeo.
+// - tamano: Variable donde se guarda el tamao del archivo.
+//
+// Retorno:
+// - El inicio del archivo mapeado, o nullptr si no existe, est vaco o no se pudo mapear
+//   (en ese caso los manejadores quedan cerrados).
+//
+// Notas:
+// - El archivo no se lee ni se copia; el sistema trae cada pgina del disco la primera vez que se usa.
+
+const char* mapearArchivo(const string& ruta, HANDLE& archivo, HANDLE& mapeo, uint64_t& tamano) {
+    archivo = CreateFileA(ruta.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (archivo == INVALID_HANDLE_VALUE) return nullptr;
+
+    LARGE_INTEGER largo;
+    const char* datos = nullptr;
+    if (GetFileSizeEx(archivo, &largo) && largo.QuadPart > 0) {
+        tamano = static_cast<uint64_t>(largo.QuadPart);
+        mapeo = CreateFileMappingA(archivo, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapeo) {
+            datos = static_cast<const char*>(MapViewOfFile(mapeo, FILE_MAP_READ, 0, 0, 0));
+        }
+    }
+
+    if (!datos) {
+        if (mapeo) CloseHandle(mapeo);
+        CloseHandle(archivo);
+        archivo = INVALID_HANDLE_VALUE;
+        mapeo = nullptr;
+    }
+    return datos;
+}
+
+
+
+// Funcin para deshacer el mapeo de un archivo abierto con `mapearArchivo`.
+//
+// Parmetros:
+// - archivo, mapeo, datos: Manejadores e inicio del mapeo; quedan en su valor inicial.
+
+void desmapearArchivo(HANDLE& archivo, HANDLE& mapeo, const char*& datos) {
+    if (datos) UnmapViewOfFile(datos);
+    if (mapeo) CloseHandle(mapeo);
+    if (archivo != INVALID_HANDLE_VALUE) CloseHandle(archivo);
+
+    archivo = INVALID_HANDLE_VALUE;
+    mapeo = nullptr;
+    datos = nullptr;
+}
+
+
+
+// Funcin para escribir un archivo binario (cabecera y contenido) reemplazando al anterior de forma segura.
+//
+// Parmetros:
+// - ruta: Ruta del archivo.
+// - cabecera, largoCabecera: Cabecera del archivo y su tamao en bytes.
+// - contenido: Bytes que siguen a la cabecera.
+//
+// Retorno:
+// - true si el archivo se escribi y reemplaz al anterior, false en caso contrario.
+
+bool reemplazarArchivoBinario(const string& ruta, const void* cabecera, size_t largoCabecera, const vector<char>& contenido) {
+    const string rutaTemporal = ruta + ".tmp";
+    ofstream archivo(rutaTemporal, ios::binary | ios::trunc);
+    if (!archivo.is_open()) return false;
+
+    archivo.write(static_cast<const char*>(cabecera), largoCabecera);
+    archivo.write(contenido.data(), contenido.size());
+    archivo.close();
+    if (!archivo) return false;
+
+    error_code error;
+    fs::rename(rutaTemporal, ruta, error);
+    return !error;
+}
+
+
+
+// Funcin auxiliar para copiar cadenas del pool a un bloque de texto nuevo, una vez cada una.
+//
+// Parmetros:
+// - id: Identificador de la cadena en el pool.
+// - texto: Bloque de texto nuevo (mismo formato que `poolCadenas.texto`).
+// - nuevosIds: Identificador en el pool -> posicin en el texto nuevo, para no repetir cadenas.
+//
+// Retorno:
+// - La posicin de la cadena en el texto nuevo.
+
+uint32_t copiarCadenaBinaria(uint32_t id, string& texto, unordered_map<uint32_t, uint32_t>& nuevosIds) {
+    auto encontrado = nuevosIds.find(id);
+    if (encontrado != nuevosIds.end()) return encontrado->second;
+
+    string_view cadena = cadenaDe(id);
+    uint32_t nuevo = static_cast<uint32_t>(texto.size());
+    const char* inicio = cadena.data() - (cadena.size() < 0xFF ? 1 : 5);
+    texto.append(inicio, cadena.data() + cadena.size()); // Longitud y contenido, tal como estn en el pool.
+    nuevosIds.emplace(id, nuevo);
+    return nuevo;
+}
+
+
+
+// Funcin para unir una tabla de posiciones y un bloque de texto en el contenido de un archivo binario.
+//
+// Parmetros:
+// - ids: Posicin de cada cadena dentro de `texto`.
+// - texto: Bloque de texto.
+// - contenido: Vector donde se agregan ambas secciones, una a continuacin de la otra.
+
+void agregarSeccionesTexto(const vector<uint32_t>& ids, const string& texto, vector<char>& contenido) {
+    size_t inicio = contenido.size();
+    contenido.resize(inicio + ids.size() * sizeof(uint32_t) + texto.size());
+    if (!ids.empty()) memcpy(contenido.data() + inicio, ids.data(), ids.size() * sizeof(uint32_t));
+    if (!texto.empty()) memcpy(contenido.data() + inicio + ids.size() * sizeof(uint32_t), texto.data(), texto.size());
+}
+
+
+
+// Funcin para guardar el diccionario en formato binario: las claves en espaol y una columna por idioma.
+//
+// Parmetros:
+// - raiz: ndice del nodo raz del rbol AVL.
+// - ruta: Ruta del archivo binario (normalmente `C:\\traductorbinario\\diccionario.umg`).
+//
+// Retorno:
+// - true si los archivos se guardaron, false en caso contrario.
+//
+// Proceso:
+// 1. Recorre el rbol en orden alfabtico y arma un filtro de Bloom nuevo (sin las palabras eliminadas),
+//    la tabla de prefijos, la de claves y el texto en espaol.
+// 2. Arma la columna de cada idioma con la traduccin de cada palabra en el mismo orden, copiando cada
+//    traduccin una sola vez, y la guarda en `columnasIdiomas.rutas` junto con la suma del diccionario.
+// 3. Completa la cabecera del diccionario (tamaos de los archivos de texto, contadores y suma de verificacin).
+// 4. Escribe cada archivo en uno temporal y lo renombra sobre el anterior; el diccionario se renombra
+//    al final, por lo que una interrupcin deja a lo sumo columnas que no corresponden y se descartan.
+//
+// Notas:
+// - Se debe llamar al salir, despus de `esperarCompactacion`, para que los tamaos guardados
+//   correspondan a los archivos finales.
+// - Crea la carpeta del archivo binario y de las columnas si no existen.
+// - Todas las columnas deben estar cargadas (ver `cargarColumnas`) y ninguna debe estar mapeada, igual
+//   que el diccionario binario (en Windows no se puede reemplazar un archivo mapeado).
+
+bool guardarDiccionarioBinario(uint32_t raiz, const string& ruta) {
+    for (int idioma = 0; idioma < CANTIDAD_IDIOMAS; ++idioma) {
+        if (!columnasIdiomas.cargada[idioma]) {
+            cerr << "Error al guardar el diccionario binario: faltan traducciones.\n";
+            return false;
+        }
+    }
+
+    // Crear las carpetas de los archivos si no existen.
+    error_code error;
+    fs::create_directories(fs::path(ruta).parent_path(), error);
+    for (int idioma = 0; idioma < CANTIDAD_IDIOMAS; ++idioma) {
+        fs::create_directories(fs::path(columnasIdiomas.rutas[idioma]).parent_path(), error);
+    }
+
+    vector<uint32_t> nodos;
+    recorrerInorden(raiz, nodos);
+    size_t n = nodos.size();
+
+    // Claves en espaol.
+    vector<uint64_t> prefijos(n);
+    vector<uint32_t> ids(n);
+    string texto;
+    unordered_map<uint32_t, uint32_t> nuevosIds; // Identificador en el pool -> posicin en el texto nuevo.
+    nuevosIds.reserve(n * 2);
+    // Filtro de Bloom con el mismo margen que `reconstruirFiltro`.
+    uint32_t bitsPorClave = filtroBloom.bitsPorClave;
+    uint32_t funciones = funcionesFiltro(bitsPorClave);
+    size_t cantidadBloques = bloquesFiltro(n + n / 4 + 1024, bitsPorClave);
+    vector<uint64_t> filtro(cantidadBloques * FiltroBloom::PALABRAS_POR_BLOQUE, 0);
+    for (size_t i = 0; i < n; ++i) {
+        prefijos[i] = nodoEn(nodos[i]).prefijo;
+        ids[i] = copiarCadenaBinaria(palabraDe(nodos[i]).espanol, texto, nuevosIds);
+        marcarEnFiltro(filtro.data(), cantidadBloques, funciones, cadenaDe(palabraDe(nodos[i]).espanol));
+    }
+
+    vector<char> contenido((filtro.size() + n) * sizeof(uint64_t));
+    memcpy(contenido.data(), filtro.data(), filtro.size() * sizeof(uint64_t));
+    if (n) memcpy(contenido.data() + filtro.size() * sizeof(uint64_t), prefijos.data(), n * sizeof(uint64_t));
+    agregarSeccionesTexto(ids, texto, contenido);
+
+    CabeceraBinaria cabecera = {};
+    memcpy(cabecera.firma, "TRDB", 4);
+    cabecera.version = VERSION_DICCIONARIO_BINARIO;
+    cabecera.cantidad = n;
+    cabecera.largoTexto = texto.size();
+    cabecera.tamanoBase = tamanoArchivo(registroCambios.rutaBase);
+    cabecera.tamanoCambios = tamanoArchivo(registroCambios.rutaCambios);
+    cabecera.registrosBase = registroCambios.registrosBase;
+    cabecera.registrosCambios = registroCambios.registrosCambios;
+    cabecera.bloquesFiltro = cantidadBloques;
+    cabecera.bitsPorClave = bitsPorClave;
+    cabecera.funcionesFiltro = funciones;
+    cabecera.suma = sumaVerificacion(contenido.data(), contenido.size());
+
+    // Una columna por idioma.
+    for (int idioma = 0; idioma < CANTIDAD_IDIOMAS; ++idioma) {
+        string textoColumna;
+        nuevosIds.clear();
+        for (size_t i = 0; i < n; ++i) {
+            ids[i] = copiarCadenaBinaria(traduccionDe(palabraDe(nodos[i]), idioma), textoColumna, nuevosIds);
+        }
+
+        vector<char> contenidoColumna;
+        agregarSeccionesTexto(ids, textoColumna, contenidoColumna);
+
+        CabeceraColumna cabeceraColumna = {};
+        memcpy(cabeceraColumna.firma, "TRDC", 4);
+        cabeceraColumna.idioma = static_cast<uint32_t>(idioma);
+        cabeceraColumna.cantidad = n;
+        cabeceraColumna.largoTexto = textoColumna.size();
+        cabeceraColumna.sumaDiccionario = cabecera.suma;
+        cabeceraColumna.suma = sumaVerificacion(contenidoColumna.data(), contenidoColumna.size());
+
+        if (!reemplazarArchivoBinario(columnasIdiomas.rutas[idioma], &cabeceraColumna, sizeof(cabeceraColumna), contenidoColumna)) {
+            cerr << "Error al guardar " << columnasIdiomas.rutas[idioma] << ".\n";
+            return false;
+        }
+    }
+
+    if (!reemplazarArchivoBinario(ruta, &cabecera, sizeof(cabecera), contenido)) {
+        cerr << "Error al guardar el diccionario binario.\n";
+        return false;
+    }
+    return true;
+}
+
+
+
+// Funcin para saber si el diccionario binario guardado sigue correspondiendo al diccionario actual.
+//
+// Parmetros:
+// - ruta: Ruta del archivo binario.
+// - cantidad: Cantidad de palabras del diccionario actual.
+//
+// Retorno:
+// - true si el archivo y sus columnas existen, tienen el tamao esperado y fueron guardados con los mismos
+//   archivos de texto (mismos tamaos y contadores), la misma cantidad de palabras y los mismos bits por
+//   palabra del filtro de Bloom; false en caso contrario.
+//
+// Notas:
+// - Solo lee las cabeceras. Se usa al salir para no volver a guardar (ni cargar las columnas que no
+//   se usaron) cuando el diccionario no cambi durante la sesin.
+
+bool diccionarioBinarioVigente(const string& ruta, size_t cantidad) {
+    CabeceraBinaria cabecera = {};
+    ifstream archivo(ruta, ios::binary);
+    if (!archivo.read(reinterpret_cast<char*>(&cabecera), sizeof(cabecera))) return false;
+
+    const uint64_t porBloque = FiltroBloom::PALABRAS_POR_BLOQUE * sizeof(uint64_t);
+    const uint64_t porPalabra = sizeof(uint64_t) + sizeof(uint32_t);
+    error_code error;
+    bool vigente = memcmp(cabecera.firma, "TRDB", 4) == 0 &&
+        cabecera.version == VERSION_DICCIONARIO_BINARIO &&
+        cabecera.cantidad == cantidad &&
+        tamanoArchivo(ruta) == sizeof(CabeceraBinaria) + cabecera.bloquesFiltro * porBloque + cabecera.cantidad * porPalabra + cabecera.largoTexto &&
+        cabecera.tamanoBase == tamanoArchivo(registroCambios.rutaBase) &&
+        cabecera.tamanoCambios == tamanoArchivo(registroCambios.rutaCambios) &&
+        cabecera.registrosBase == registroCambios.registrosBase &&
+        cabecera.registrosCambios == registroCambios.registrosCambios &&
+        cabecera.bitsPorClave == filtroBloom.bitsPorClave &&
+        !fs::exists(registroCambios.rutaAnterior, error);
+
+    for (int idioma = 0; vigente && idioma < CANTIDAD_IDIOMAS; ++idioma) {
+        CabeceraColumna cabeceraColumna = {};
+        ifstream columna(columnasIdiomas.rutas[idioma], ios::binary);
+        vigente = columna.read(reinterpret_cast<char*>(&cabeceraColumna), sizeof(cabeceraColumna)) &&
+            memcmp(cabeceraColumna.firma, "TRDC", 4) == 0 &&
+            cabeceraColumna.cantidad == cantidad &&
+            cabeceraColumna.sumaDiccionario == cabecera.suma &&
+            tamanoArchivo(columnasIdiomas.rutas[idioma]) == sizeof(CabeceraColumna) + cantidad * sizeof(uint32_t) + cabeceraColumna.largoTexto;
+    }
+    return vigente;
+}
+
+
+
+// Funcin para cerrar un diccionario binario abierto con `abrirDiccionarioBinario`.
+//
+// Parmetros:
+// - binario: Diccionario que se desea cerrar.
+//
+// Notas:
+// - Despus de cerrarlo, los punteros y las cadenas obtenidas del archivo dejan de ser vlidos.
+
+void cerrarDiccionarioBinario(DiccionarioBinario& binario) {
+    desmapearArchivo(binario.archivo, binario.mapeo, binario.datos);
+    binario.cabecera = nullptr;
+    binario.filtro = nullptr;
+    binario.prefijos = nullptr;
+    binario.claves = nullptr;
+    binario.texto = nullptr;
+    binario.cantidad = 0;
+}
+
+
+
+// Funcin para abrir el diccionario binario y mapearlo en memoria.
+//
+// Parmetros:
+// - ruta: Ruta del archivo binario.
+// - binario: Estructura donde se guardan el mapeo y las secciones del archivo.
+//
+// Retorno:
+// - true si el archivo existe, es vlido y corresponde a los archivos de texto actuales; false en caso contrario.
+//
+// Proceso:
+// 1. Abre el archivo y lo mapea en memoria de solo lectura con `mapearArchivo`.
+// 2. Verifica la firma, la versin y que el tamao del archivo coincida con el de las secciones.
+// 3. Verifica que `palabras.umg` y `cambios.umg` tengan los tamaos guardados y que no haya una
+//    compactacin pendiente; si no, el binario qued desactualizado.
+// 4. Verifica la suma de verificacin.
+//
+// Notas:
+// - Si alguna verificacin falla, cierra el archivo; el diccionario se carga entonces desde el texto.
+// - Las columnas de traducciones no se abren aqu, sino la primera vez que se usa cada idioma.
+
+bool abrirDiccionarioBinario(const string& ruta, DiccionarioBinario& binario) {
+    uint64_t tamano = 0;
+    binario.datos = mapearArchivo(ruta, binario.archivo, binario.mapeo, tamano);
+    if (!binario.datos) return false;
+    if (tamano < sizeof(CabeceraBinaria)) {
+        cerrarDiccionarioBinario(binario);
+        return false;
+    }
+
+    // Verificar la cabecera y el tamao de las secciones.
+    const CabeceraBinaria* cabecera = reinterpret_cast<const CabeceraBinaria*>(binario.datos);
+    uint64_t disponible = tamano - sizeof(CabeceraBinaria);
+    const uint64_t porBloque = FiltroBloom::PALABRAS_POR_BLOQUE * sizeof(uint64_t);
+    const uint64_t porPalabra = sizeof(uint64_t) + sizeof(uint32_t);
+    bool valido = memcmp(cabecera->firma, "TRDB", 4) == 0 &&
+        cabecera->version == VERSION_DICCIONARIO_BINARIO &&
+        cabecera->bloquesFiltro <= disponible / porBloque &&
+        cabecera->funcionesFiltro <= 16 &&
+        cabecera->cantidad <= (disponible - cabecera->bloquesFiltro * porBloque) / porPalabra &&
+        cabecera->largoTexto == disponible - cabecera->bloquesFiltro * porBloque - cabecera->cantidad * porPalabra;
+
+    // Verificar que los archivos de texto no cambiaron despus de guardar el binario.
+    error_code error;
+    valido = valido &&
+        cabecera->tamanoBase == tamanoArchivo(registroCambios.rutaBase) &&
+        cabecera->tamanoCambios == tamanoArchivo(registroCambios.rutaCambios) &&
+        !fs::exists(registroCambios.rutaAnterior, error);
+
+    // Verificar el contenido.
+    valido = valido && cabecera->suma == sumaVerificacion(binario.datos + sizeof(CabeceraBinaria), static_cast<size_t>(disponible));
+    if (!valido) {
+        cerrarDiccionarioBinario(binario);
+        return false;
+    }
+
+    binario.cabecera = cabecera;
+    binario.cantidad = static_cast<size_t>(cabecera->cantidad);
+    binario.filtro = reinterpret_cast<const uint64_t*>(binario.datos + sizeof(CabeceraBinaria));
+    binario.prefijos = binario.filtro + cabecera->bloquesFiltro * FiltroBloom::PALABRAS_POR_BLOQUE;
+    binario.claves = reinterpret_cast<const uint32_t*>(binario.prefijos + binario.cantidad);
+    binario.texto = reinterpret_cast<const char*>(binario.claves + binario.cantidad);
+    return true;
+}
+
+
+
+// Funcin para buscar una palabra directamente en el diccionario binario mapeado.
+//
+// Parmetros:
+// - binario: Diccionario binario abierto.
+// - palabraBuscada: Palabra en espaol que se desea buscar.
+// - fila: Variable donde se guarda la posicin de la palabra en el archivo (su fila en cada columna).
+//
+// Retorno:
+// - true si la palabra se encuentra, false en caso contrario.
+//
+// Notas:
+// - Antes consulta el filtro de Bloom guardado en el archivo; las palabras que no existen casi nunca
+//   llegan a la bsqueda binaria.
+// - Es una bsqueda binaria sobre la tabla de prefijos; la palabra completa solo se lee cuando
+//   los prefijos coinciden. No hace falta leer ni convertir el archivo antes de buscar.
+// - Las traducciones de la fila se leen con `traduccionBinaria`.
+
+bool buscarBinario(const DiccionarioBinario& binario, string_view palabraBuscada, size_t& fila) {
+    if (!filtroPuedeContener(binario.filtro, static_cast<size_t>(binario.cabecera->bloquesFiltro), binario.cabecera->funcionesFiltro, palabraBuscada)) {
+        return false;
+    }
+    uint64_t prefijo = prefijoClave(palabraBuscada);
+    size_t inicio = 0;
+    size_t fin = binario.cantidad;
+
+    while (inicio < fin) {
+        size_t medio = inicio + (fin - inicio) / 2;
+        int comparacion;
+        if (prefijo != binario.prefijos[medio]) {
+            comparacion = prefijo < binario.prefijos[medio] ? -1 : 1;
+        }
+        else {
+            comparacion = palabraBuscada.compare(cadenaEn(binario.texto, binario.claves[medio]));
+        }
+
+        if (comparacion == 0) {
+            fila = medio;
+            return true;
+        }
+        if (comparacion < 0) fin = medio;
+        else inicio = medio + 1;
+    }
+    return false;
+}
+
+
+
+// Funcin para construir el rbol AVL a partir del diccionario binario, sin leer texto.
+//
+// Parmetros:
+// - binario: Diccionario binario abierto.
+//
+// Retorno:
+// - El ndice del nodo raz del rbol construido.
+//
+// Proceso:
+// 1. Copia el bloque de texto al pool de cadenas y reconstruye su tabla hash (`reconstruirTablaCadenas`).
+//    Como el formato es el mismo, los identificadores de las cadenas no cambian.
+// 2. Llena `tablaPalabras` con las claves del archivo; la palabra i del archivo queda en la posicin i,
+//    con sus traducciones pendientes (`PoolCadenas::SIN_CADENA`) hasta que se cargue cada columna.
+// 3. Construye el rbol balanceado con `construirInversaBalanceada`, usando los prefijos del archivo.
+// 4. Copia el filtro de Bloom guardado, que ya contiene exactamente estas palabras.
+// 5. Restaura los contadores del registro de cambios y anota en `columnasIdiomas` que ningn idioma
+//    est cargado ni indexado.
+
+uint32_t cargarDesdeBinario(const DiccionarioBinario& binario) {
+    size_t n = binario.cantidad;
+
+    poolCadenas.texto.assign(binario.texto, static_cast<size_t>(binario.cabecera->largoTexto));
+    reconstruirTablaCadenas();
+
+    const uint32_t PENDIENTE = PoolCadenas::SIN_CADENA;
+    tablaPalabras.palabras.resize(n);
+    for (size_t i = 0; i < n; ++i) {
+        tablaPalabras.palabras[i] = { binario.claves[i], PENDIENTE, PENDIENTE, PENDIENTE, PENDIENTE };
+    }
+    tablaPalabras.libres.clear();
+
+    vector<uint32_t> entradas(n);
+    for (size_t i = 0; i < n; ++i) entradas[i] = static_cast<uint32_t>(i);
+    vector<uint64_t> prefijos(binario.prefijos, binario.prefijos + n);
+    uint32_t raiz = construirInversaBalanceada(entradas, prefijos, 0, n);
+
+    const CabeceraBinaria* cabecera = binario.cabecera;
+    size_t cantidadBloques = static_cast<size_t>(cabecera->bloquesFiltro);
+    filtroBloom.bitsPorClave = cabecera->bitsPorClave;
+    filtroBloom.funciones = cabecera->funcionesFiltro;
+    filtroBloom.bloques.assign(binario.filtro, binario.filtro + cantidadBloques * FiltroBloom::PALABRAS_POR_BLOQUE);
+    filtroBloom.capacidad = cantidadBloques * 512 / max(1u, cabecera->bitsPorClave);
+    filtroBloom.claves = n;
+    filtroBloom.eliminadas = 0;
+
+    registroCambios.registrosBase = static_cast<size_t>(binario.cabecera->registrosBase);
+    registroCambios.registrosAnterior = 0;
+    registroCambios.registrosCambios = static_cast<size_t>(binario.cabecera->registrosCambios);
+
+    for (int idioma = 0; idioma < CANTIDAD_IDIOMAS; ++idioma) {
+        columnasIdiomas.cargada[idioma] = false;
+        columnasIdiomas.indexada[idioma] = false;
+    }
+    columnasIdiomas.pendientes = n;
+    columnasIdiomas.sumaDiccionario = binario.cabecera->suma;
+    return raiz;
+}
+
+
+
+// Funcin para construir el rbol AVL y el ndice congelado en segundo plano.
+//
+// Parmetros:
+// - binario: Diccionario binario abierto.
+// - raiz: Variable donde se guardar la raz del rbol construido.
+// - indice: ndice congelado que se construir a partir del rbol.
+//
+// Notas:
+// - Mientras el hilo trabaja, el programa ya puede buscar palabras en el archivo mapeado.
+// - `raiz` e `indice` no deben usarse hasta llamar a `esperarCargaBinaria`.
+
+void iniciarCargaBinaria(DiccionarioBinario& binario, uint32_t& raiz, IndiceCongelado& indice) {
+    binario.cargador = thread([&binario, &raiz, &indice]() {
+        raiz = cargarDesdeBinario(binario);
+        congelarIndice(raiz, indice);
+    });
+}
+
+
+
+// Funcin para esperar a que termine la carga en segundo plano y cerrar el diccionario binario.
+//
+// Parmetros:
+// - binario: Diccionario binario abierto con `abrirDiccionarioBinario`.
+//
+// Notas:
+// - Despus de llamarla, el rbol AVL y el ndice congelado estn completos y las bsquedas
+//   vuelven a hacerse en memoria. Si no haba una carga en curso, no hace nada.
+// - Las columnas que se mapearon mientras tanto siguen abiertas; se cierran al cargarlas en memoria.
+
+void esperarCargaBinaria(DiccionarioBinario& binario) {
+    if (binario.cargador.joinable()) {
+        binario.cargador.join();
+    }
+    cerrarDiccionarioBinario(binario);
+}
+
+
+
+
+//==========================FUNCIONES DEL TRIE COMPACTO==========================
+
+
+
+// Estructura con un trie de solo lectura de las palabras en espaol, codificado con LOUDS (la secuencia de
+// grados de los nodos recorridos por niveles) para ocupar pocos bits por nodo.
+//
+// Campos:
+// - CEROS_POR_MUESTRA: Cada cuntos ceros de `louds` se guarda la posicin en `muestrasCeros`.
+// - PALABRAS_POR_RANGO: Cada cuntas palabras de 64 bits de `terminales` se guarda la cantidad de unos anteriores.
+// - louds: "10" (una raz ficticia) seguido, por cada nodo en orden de niveles, de un 1 por hijo y un 0.
+//   El nodo nmero v (la raz es el 0) es el hijo que corresponde al uno nmero v.
+// - bitsLouds: Cantidad de bits vlidos de `louds`.
+// - muestrasCeros: Posicin en `louds` de los ceros nmero 0, CEROS_POR_MUESTRA, 2 * CEROS_POR_MUESTRA, ...
+// - etiquetas: Carcter con el que se llega a cada nodo (el del nodo v est en la posicin v - 1).
+//   Los hijos de un nodo son consecutivos y estn ordenados por carcter.
+// - terminales: Un bit por nodo, encendido si una palabra termina en ese nodo.
+// - rangosTerminales: Cantidad de unos de `terminales` antes de cada grupo de PALABRAS_POR_RANGO palabras.
+// - filas: Posicin alfabtica de la palabra de cada nodo terminal, en el orden de los nodos.
+// - entradas: Posicin en `tablaPalabras` de la palabra de cada posicin alfabtica.
+// - cantidad: Cantidad de palabras.
+// - nodos: Cantidad de nodos, incluida la raz.
+//
+// Notas:
+// - Los hijos del nodo v ocupan en `louds` las posiciones desde el cero nmero v (ms uno) hasta el cero
+//   nmero v + 1. Como antes de esa posicin hay v + 1 ceros, el primer hijo es el nodo (posicin - v - 1),
+//   as que solo hace falta ubicar ceros y no contar unos.
+// - La fila de cada palabra es la misma que en el diccionario binario guardado con el mismo rbol, por lo
+//   que el trie tambin sirve como ndice de `diccionario.umg` y de sus columnas.
+// - No se puede modificar: se vuelve a construir con `construirTrie` cuando el diccionario cambia.
+// - Por ahora solo lo usa la medicin de rendimiento (`medirTrieCompacto`), que lo compara con el rbol AVL
+//   y con el ndice congelado; no se guarda en disco.
+
+struct TrieCompacto {
+    static const size_t CEROS_POR_MUESTRA = 64;
+    static const size_t PALABRAS_POR_RANGO = 8;
+
+    vector<uint64_t> louds;
+    size_t bitsLouds = 0;
+    vector<uint32_t> muestrasCeros;
+    string etiquetas;
+    vector<uint64_t> terminales;
+    vector<uint32_t> rangosTerminales;
+    vector<uint32_t> filas;
+    vector<uint32_t> entradas;
+    size_t cantidad = 0;
+    size_t nodos = 0;
+};
+
+
+
+// Funcin auxiliar para contar los bits encendidos de una palabra de 64 bits.
+//
+// Parmetros:
+// - bits: Palabra de 64 bits.
+//
+// Retorno:
+// - La cantidad de bits en 1.
+
+inline uint32_t contarUnos(uint64_t bits) {
+    return static_cast<uint32_t>(bitset<64>(bits).count());
+}
+
+
+
+// Funcin auxiliar para obtener la posicin del bit encendido ms bajo.
+//
+// Parmetros:
+// - bits: Palabra de 64 bits (distinta de 0).
+//
+// Retorno:
+// - La posicin (0 a 63) del bit en 1 menos significativo.
+
+inline uint32_t bitMasBajo(uint64_t bits) {
+    unsigned long posicion = 0;
+    _BitScanForward64(&posicion, bits);
+    return static_cast<uint32_t>(posicion);
+}
+
+
+
+// Funcin para calcular las muestras de ceros y los rangos de terminales de un trie compacto.
+//
+// Parmetros:
+// - trie: Trie con `louds`, `bitsLouds` y `terminales` ya llenos.
+//
+// Notas:
+// - Se usa al terminar de construir el trie.
+
+void indexarTrie(TrieCompacto& trie) {
+    trie.muestrasCeros.clear();
+    size_t ceros = 0;
+    for (size_t posicion = 0; posicion < trie.bitsLouds; ++posicion) {
+        if ((trie.louds[posicion / 64] >> (posicion % 64)) & 1) continue;
+        if (ceros % TrieCompacto::CEROS_POR_MUESTRA == 0) {
+            trie.muestrasCeros.push_back(static_cast<uint32_t>(posicion));
+        }
+        ++ceros;
+    }
+
+    trie.rangosTerminales.assign(trie.terminales.size() / TrieCompacto::PALABRAS_POR_RANGO + 1, 0);
+    uint32_t unos = 0;
+    for (size_t i = 0; i < trie.terminales.size(); ++i) {
+        if (i % TrieCompacto::PALABRAS_POR_RANGO == 0) trie.rangosTerminales[i / TrieCompacto::PALABRAS_POR_RANGO] = unos;
+        unos += contarUnos(trie.terminales[i]);
+    }
+}
+
+
+
+// Funcin para construir el trie compacto a partir del rbol AVL.
+//
+// Parmetros:
+// - raiz: ndice del nodo raz del rbol AVL.
+// - trie: Trie que se reemplazar con las palabras actuales.
+//
+// Proceso:
+// 1. Obtiene las palabras en orden alfabtico con `recorrerInorden`; las palabras con un mismo prefijo
+//    forman un intervalo, y cada nodo del trie es uno de esos intervalos.
+// 2. Recorre el trie por niveles: para cada intervalo anota si una palabra termina ah (solo puede ser
+//    la primera), lo divide segn el carcter siguiente y agrega un hijo por parte al nivel siguiente.
+// 3. Calcula las muestras y los rangos con `indexarTrie`.
+//
+// Notas:
+// - El costo es proporcional a la cantidad total de caracteres de las palabras.
+
+void construirTrie(uint32_t raiz, TrieCompacto& trie) {
+    vector<uint32_t> nodos;
+    recorrerInorden(raiz, nodos);
+    size_t n = nodos.size();
+
+    trie = TrieCompacto();
+    trie.cantidad = n;
+    vector<string_view> claves(n);
+    trie.entradas.resize(n);
+    for (size_t i = 0; i < n; ++i) {
+        claves[i] = cadenaDe(palabraDe(nodos[i]).espanol);
+        trie.entradas[i] = nodoEn(nodos[i]).entrada;
+    }
+
+    size_t bitsTerminales = 0;
+    auto agregarBit = [](vector<uint64_t>& bits, size_t& cantidadBits, bool uno) {
+        if (cantidadBits % 64 == 0) bits.push_back(0);
+        if (uno) bits.back() |= uint64_t(1) << (cantidadBits % 64);
+        ++cantidadBits;
+        };
+    agregarBit(trie.louds, trie.bitsLouds, true);
+    agregarBit(trie.louds, trie.bitsLouds, false);
+
+    // Recorrer por niveles: cada intervalo [first, second) de `claves` comparte sus primeros `profundidad` caracteres.
+    vector<pair<uint32_t, uint32_t>> nivel = { { 0, static_cast<uint32_t>(n) } }, siguiente;
+    for (size_t profundidad = 0; !nivel.empty(); ++profundidad) {
+        siguiente.clear();
+        for (const pair<uint32_t, uint32_t>& intervalo : nivel) {
+            uint32_t desde = intervalo.first, hasta = intervalo.second;
+            bool terminal = desde < hasta && claves[desde].size() == profundidad;
+            agregarBit(trie.terminales, bitsTerminales, terminal);
+            if (terminal) trie.filas.push_back(desde++);
+
+            while (desde < hasta) {
+                char caracter = claves[desde][profundidad];
+                uint32_t fin = desde + 1;
+                while (fin < hasta && claves[fin][profundidad] == caracter) ++fin;
+                agregarBit(trie.louds, trie.bitsLouds, true);
+                trie.etiquetas += caracter;
+                siguiente.emplace_back(desde, fin);
+                desde = fin;
+            }
+            agregarBit(trie.louds, trie.bitsLouds, false);
+            ++trie.nodos;
+        }
+        nivel.swap(siguiente);
+    }
+
+    indexarTrie(trie);
+}
+
+
+
+// Funcin auxiliar para ubicar un cero de la secuencia LOUDS.
+//
+// Parmetros:
+// - trie: Trie compacto.
+// - numero: Nmero del cero buscado (el primero es el 0).
+//
+// Retorno:
+// - La posicin del cero en `louds`.
+//
+// Proceso:
+// - Parte de la muestra anterior y avanza de a 64 bits contando ceros; dentro de la ltima palabra
+//   apaga los ceros sobrantes y toma el ms bajo.
+
+size_t seleccionarCero(const TrieCompacto& trie, size_t numero) {
+    size_t posicion = trie.muestrasCeros[numero / TrieCompacto::CEROS_POR_MUESTRA];
+    size_t restantes = numero % TrieCompacto::CEROS_POR_MUESTRA;
+    if (!restantes) return posicion;
+
+    size_t palabra = posicion / 64;
+    uint64_t ceros = posicion % 64 == 63 ? 0 : ~trie.louds[palabra] & (~uint64_t(0) << (posicion % 64 + 1));
+    while (true) {
+        size_t cuenta = contarUnos(ceros);
+        if (cuenta >= restantes) {
+            for (size_t i = 1; i < restantes; ++i) ceros &= ceros - 1;
+            return palabra * 64 + bitMasBajo(ceros);
+        }
+        restantes -= cuenta;
+        ceros = ~trie.louds[++palabra];
+    }
+}
+
+
+
+// Funcin auxiliar para obtener los hijos de un nodo del trie compacto.
+//
+// Parmetros:
+// - trie: Trie compacto.
+// - nodo: Nmero del nodo.
+// - primero: Variable donde se guarda el nmero del primer hijo.
+// - cantidad: Variable donde se guarda la cantidad de hijos (los hijos son primero, primero + 1, ...).
+
+void hijosTrie(const TrieCompacto& trie, size_t nodo, size_t& primero, size_t& cantidad) {
+    size_t inicio = seleccionarCero(trie, nodo) + 1;
+    primero = inicio - nodo - 1;
+
+    // El siguiente cero cierra la lista de hijos.
+    size_t palabra = inicio / 64;
+    uint64_t ceros = ~trie.louds[palabra] & (~uint64_t(0) << (inicio % 64));
+    while (!ceros) ceros = ~trie.louds[++palabra];
+    cantidad = palabra * 64 + bitMasBajo(ceros) - inicio;
+}
+
+
+
+// Funcin auxiliar para descender por el trie compacto siguiendo un texto.
+//
+// Parmetros:
+// - trie: Trie compacto.
+// - texto: Caracteres que se siguen desde la raz.
+// - nodo: Variable donde se guarda el nodo al que se llega.
+//
+// Retorno:
+// - true si existe el camino completo, false si algn carcter no tiene hijo.
+
+bool descenderTrie(const TrieCompacto& trie, string_view texto, size_t& nodo) {
+    nodo = 0;
+    if (!trie.nodos) return false;
+    for (char caracter : texto) {
+        size_t primero, cantidad;
+        hijosTrie(trie, nodo, primero, cantidad);
+        const char* etiquetas = trie.etiquetas.data() + primero - 1;
+        const void* encontrado = memchr(etiquetas, caracter, cantidad);
+        if (!encontrado) return false;
+        nodo = primero + (static_cast<const char*>(encontrado) - etiquetas);
+    }
+    return true;
+}
+
+
+
+// Funcin auxiliar para obtener la fila de la palabra que termina en un nodo terminal.
+//
+// Parmetros:
+// - trie: Trie compacto.
+// - nodo: Nodo terminal.
+//
+// Retorno:
+// - La posicin alfabtica de la palabra.
+
+size_t filaDeNodo(const TrieCompacto& trie, size_t nodo) {
+    size_t palabra = nodo / 64;
+    size_t grupo = palabra / TrieCompacto::PALABRAS_POR_RANGO;
+    size_t anteriores = trie.rangosTerminales[grupo];
+    for (size_t i = grupo * TrieCompacto::PALABRAS_POR_RANGO; i < palabra; ++i) {
+        anteriores += contarUnos(trie.terminales[i]);
+    }
+    anteriores += contarUnos(trie.terminales[palabra] & ((uint64_t(1) << (nodo % 64)) - 1));
+    return trie.filas[anteriores];
+}
+
+
+
+// Funcin para buscar la fila de una palabra en el trie compacto.
+//
+// Parmetros:
+// - trie: Trie compacto.
+// - palabraBuscada: Palabra en espaol.
+// - fila: Variable donde se guarda la posicin alfabtica de la palabra si se encuentra.
+//
+// Retorno:
+// - true si la palabra est en el trie, false en caso contrario.
+//
+// Notas:
+// - Cada carcter cuesta ubicar un cero (`seleccionarCero`) y buscar el carcter entre las etiquetas
+//   de los hijos; la palabra nunca se compara completa.
+
+bool filaEnTrie(const TrieCompacto& trie, string_view palabraBuscada, size_t& fila) {
+    size_t nodo;
+    if (!descenderTrie(trie, palabraBuscada, nodo)) return false;
+    if (!((trie.terminales[nodo / 64] >> (nodo % 64)) & 1)) return false;
+    fila = filaDeNodo(trie, nodo);
+    return true;
+}
+
+
+
+// Funcin para buscar una palabra en el trie compacto (misma forma que `buscarCongelado`).
+//
+// Parmetros:
+// - trie: Trie compacto construido o enlazado con el rbol actual.
+// - palabraBuscada: Cadena que contiene la palabra en espaol que se desea buscar.
+//
+// Retorno:
+// - Un puntero a la palabra interna (con sus traducciones) almacenada en `tablaPalabras`.
+// - Si la palabra no se encuentra (o el trie no est enlazado), retorna nullptr.
+
+const PalabraInterna* buscarEnTrie(const TrieCompacto& trie, const string& palabraBuscada) {
+    size_t fila;
+    if (!filaEnTrie(trie, palabraBuscada, fila) || fila >= trie.entradas.size()) return nullptr;
+    return &tablaPalabras.palabras[trie.entradas[fila]];
+}
+
+
+
+// Funcin para obtener el intervalo de posiciones alfabticas de las palabras que comienzan con un prefijo.
+//
+// Parmetros:
+// - trie: Trie compacto.
+// - prefijo: Texto con el que deben comenzar las palabras.
+//
+// Retorno:
+// - El par [inicio, fin) de posiciones alfabticas (igual que `intervaloPrefijo`), o un intervalo vaco
+//   si ninguna palabra comienza con el prefijo.
+//
+// Proceso:
+// 1. Desciende por los caracteres del prefijo.
+// 2. La primera palabra es la del primer nodo terminal bajando siempre por el primer hijo; la ltima es
+//    la de la hoja a la que se llega bajando siempre por el ltimo hijo.
+
+pair<size_t, size_t> intervaloPrefijoTrie(const TrieCompacto& trie, string_view prefijo) {
+    size_t nodo;
+    if (!descenderTrie(trie, prefijo, nodo) || !trie.cantidad) return { 0, 0 };
+
+    size_t primero, cantidad;
+    size_t menor = nodo;
+    while (!((trie.terminales[menor / 64] >> (menor % 64)) & 1)) {
+        hijosTrie(trie, menor, primero, cantidad);
+        menor = primero;
+    }
+    size_t mayor = nodo;
+    while (true) {
+        hijosTrie(trie, mayor, primero, cantidad);
+        if (!cantidad) break;
+        mayor = primero + cantidad - 1;
+    }
+    return { filaDeNodo(trie, menor), filaDeNodo(trie, mayor) + 1 };
+}
+
+
+
+// Funcin para calcular la memoria que ocupa un trie compacto.
+//
+// Parmetros:
+// - trie: Trie compacto.
+//
+// Retorno:
+// - Los bytes de sus arreglos, sin contar `entradas` (que solo une las filas con `tablaPalabras`).
+
+size_t memoriaTrie(const TrieCompacto& trie) {
+    return (trie.louds.capacity() + trie.terminales.capacity()) * sizeof(uint64_t) + trie.etiquetas.capacity()
+        + (trie.muestrasCeros.capacity() + trie.rangosTerminales.capacity() + trie.filas.capacity()) * sizeof(uint32_t);
+}
+
+
+
+
+//==========================FUNCIONES DE LA TABLA HASH DE PALABRAS==========================
+
+
+
+// Estructura para buscar palabras exactas con una tabla hash de direccionamiento abierto, con la
+// organizacin de una "Swiss table": un byte de control por posicin, revisado de a 16 con SSE2.
+//
+// Campos:
+// - POSICIONES_POR_GRUPO: Posiciones que se revisan juntas (un registro SSE2).
+// - VACIA, BORRADA: Valores de control de una posicin sin palabra y de una posicin cuya palabra se elimin.
+//   Una posicin ocupada guarda 7 bits del hash de su palabra (0 a 127), por lo que tiene el bit alto apagado.
+// - NINGUNA: Posicin invlida (la palabra no est).
+// - control: Byte de control de cada posicin.
+// - entradas: Posicin en `tablaPalabras` de la palabra de cada posicin ocupada.
+// - ocupadas, borradas: Cantidad de posiciones con palabra y de posiciones borradas.
+//
+// Notas:
+// - La capacidad es 0 o una potencia de 2 mayor o igual a 16. El grupo inicial sale de los bits altos de
+//   `hashFiltro` y los grupos siguientes se recorren con saltos de 1, 2, 3, ... (pasa por todos los grupos).
+// - Una bsqueda termina en el primer grupo que tiene una posicin vaca.
+// - Solo sirve para bsquedas exactas: no tiene orden, as que no reemplaza al rbol en el autocompletado,
+//   la exploracin ni los ndices que dependen del orden alfabtico.
+
+struct TablaHashPalabras {
+    static constexpr size_t POSICIONES_POR_GRUPO = 16;
+    static constexpr int8_t VACIA = -128;
+    static constexpr int8_t BORRADA = -2;
+    static constexpr size_t NINGUNA = SIZE_MAX;
+
+    vector<int8_t> control;
+    vector<uint32_t> entradas;
+    size_t ocupadas = 0;
+    size_t borradas = 0;
+};
+
+
+
+// Funcin auxiliar para buscar la posicin de una palabra en la tabla hash.
+//
+// Parmetros:
+// - tabla: Tabla hash de palabras.
+// - clave: Palabra en espaol.
+// - hash: `hashFiltro(clave)`.
+//
+// Retorno:
+// - La posicin de la palabra, o `TablaHashPalabras::NINGUNA` si no est.
+//
+// Proceso:
+// 1. Compara los 16 bytes de control del grupo con los 7 bits del hash (`_mm_cmpeq_epi8`) y obtiene una
+//    mscara con las posiciones candidatas (`_mm_movemask_epi8`).
+// 2. Compara la palabra completa solo en las candidatas (en promedio, una de cada 128 posiciones ocupadas
+//    que no son la buscada).
+// 3. Si el grupo tiene una posicin vaca, la palabra no est; si no, pasa al grupo siguiente.
+
+size_t posicionHash(const TablaHashPalabras& tabla, string_view clave, uint64_t hash) {
+    if (tabla.control.empty()) return TablaHashPalabras::NINGUNA;
+
+    const size_t GRUPO = TablaHashPalabras::POSICIONES_POR_GRUPO;
+    size_t mascara = tabla.control.size() / GRUPO - 1;
+    size_t grupo = (hash >> 7) & mascara;
+    const __m128i buscado = _mm_set1_epi8(static_cast<char>(hash & 0x7F));
+    const __m128i vacia = _mm_set1_epi8(TablaHashPalabras::VACIA);
+
+    for (size_t salto = 1; ; ++salto) {
+        __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(tabla.control.data() + grupo * GRUPO));
+        unsigned long candidatas = static_cast<unsigned long>(_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, buscado)));
+        while (candidatas) {
+            unsigned long posicion;
+            _BitScanForward(&posicion, candidatas);
+            size_t encontrada = grupo * GRUPO + posicion;
+            if (cadenaDe(tablaPalabras.palabras[tabla.entradas[encontrada]].espanol) == clave) return encontrada;
+            candidatas &= candidatas - 1;
+        }
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, vacia))) return TablaHashPalabras::NINGUNA;
+        grupo = (grupo + salto) & mascara;
+    }
+}
+
+
+
+// Funcin auxiliar para obtener la primera posicin vaca o borrada en el recorrido de un hash.
+//
+// Parmetros:
+// - tabla: Tabla hash de palabras (con al menos una posicin vaca).
+// - hash: `hashFiltro` de la palabra que se desea guardar.
+//
+// Retorno:
+// - La posicin donde se puede guardar la palabra.
+//
+// Notas:
+// - Las posiciones vacas y borradas son las que tienen el bit alto encendido, as que `_mm_movemask_epi8`
+//   las encuentra sin comparar.
+
+size_t posicionLibreHash(const TablaHashPalabras& tabla, uint64_t hash) {
+    const size_t GRUPO = TablaHashPalabras::POSICIONES_POR_GRUPO;
+    size_t mascara = tabla.control.size() / GRUPO - 1;
+    size_t grupo = (hash >> 7) & mascara;
+
+    for (size_t salto = 1; ; ++salto) {
+        __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(tabla.control.data() + grupo * GRUPO));
+        unsigned long libres = static_cast<unsigned long>(_mm_movemask_epi8(bytes));
+        if (libres) {
+            unsigned long posicion;
+            _BitScanForward(&posicion, libres);
+            return grupo * GRUPO + posicion;
+        }
+        grupo = (grupo + salto) & mascara;
+    }
+}
+
+
+
+// Funcin auxiliar para cambiar la capacidad de la tabla hash y descartar las posiciones borradas.
+//
+// Parmetros:
+// - tabla: Tabla hash de palabras.
+// - capacidad: Nueva cantidad de posiciones (potencia de 2, al menos 16 y mayor que las palabras guardadas).
+
+void redimensionarHash(TablaHashPalabras& tabla, size_t capacidad) {
+    vector<int8_t> control(capacidad, TablaHashPalabras::VACIA);
+    vector<uint32_t> entradas(capacidad, 0);
+    control.swap(tabla.control);
+    entradas.swap(tabla.entradas);
+    tabla.borradas = 0;
+
+    for (size_t i = 0; i < control.size(); ++i) {
+        if (control[i] < 0) continue;
+        uint64_t hash = hashFiltro(cadenaDe(tablaPalabras.palabras[entradas[i]].espanol));
+        size_t posicion = posicionLibreHash(tabla, hash);
+        tabla.control[posicion] = static_cast<int8_t>(hash & 0x7F);
+        tabla.entradas[posicion] = entradas[i];
+    }
+}
+
+
+
+// Funcin para agregar una palabra a la tabla hash.
+//
+// Parmetros:
+// - tabla: Tabla hash de palabras.
+// - nuevaPalabra: Palabra en espaol con sus traducciones.
+//
+// Retorno:
+// - true si se agreg, false si ya estaba (igual que `insertar`, no se reemplazan sus traducciones).
+//
+// Proceso:
+// 1. Si la palabra ya est, termina.
+// 2. Si las posiciones ocupadas y borradas pasaran de 7/8 de la capacidad, redimensiona: duplica la
+//    capacidad si la mitad est ocupada, o la mantiene para limpiar las posiciones borradas.
+// 3. Guarda la palabra en `tablaPalabras` (`crearEntrada`) y su posicin en la primera posicin libre.
+
+bool agregarHash(TablaHashPalabras& tabla, const Palabra& nuevaPalabra) {
+    uint64_t hash = hashFiltro(nuevaPalabra.espanol);
+    if (posicionHash(tabla, nuevaPalabra.espanol, hash) != TablaHashPalabras::NINGUNA) return false;
+
+    size_t capacidad = tabla.control.size();
+    if ((tabla.ocupadas + tabla.borradas + 1) * 8 > capacidad * 7) {
+        size_t nueva = max<size_t>(capacidad, TablaHashPalabras::POSICIONES_POR_GRUPO);
+        if ((tabla.ocupadas + 1) * 2 > nueva) nueva *= 2;
+        redimensionarHash(tabla, nueva);
+    }
+
+    size_t posicion = posicionLibreHash(tabla, hash);
+    if (tabla.control[posicion] == TablaHashPalabras::BORRADA) tabla.borradas--;
+    tabla.control[posicion] = static_cast<int8_t>(hash & 0x7F);
+    tabla.entradas[posicion] = crearEntrada(vistaDe(nuevaPalabra));
+    tabla.ocupadas++;
+    return true;
+}
+
+
+
+// Funcin para buscar una palabra en la tabla hash (misma forma que `buscarCongelado`).
+//
+// Parmetros:
+// - tabla: Tabla hash de palabras.
+// - palabraBuscada: Palabra en espaol.
+//
+// Retorno:
+// - Un puntero a la palabra interna almacenada en `tablaPalabras`, o nullptr si no est.
+
+const PalabraInterna* buscarHash(const TablaHashPalabras& tabla, string_view palabraBuscada) {
+    size_t posicion = posicionHash(tabla, palabraBuscada, hashFiltro(palabraBuscada));
+    return posicion == TablaHashPalabras::NINGUNA ? nullptr : &tablaPalabras.palabras[tabla.entradas[posicion]];
+}
+
+
+
+// Funcin para eliminar una palabra de la tabla hash.
+//
+// Parmetros:
+// - tabla: Tabla hash de palabras.
+// - palabra: Palabra en espaol.
+//
+// Retorno:
+// - true si se elimin, false si no estaba.
+//
+// Notas:
+// - Si el grupo de la posicin tiene alguna posicin vaca, ninguna bsqueda pasa de ese grupo, as que
+//   la posicin puede volver a quedar vaca; si no, queda borrada para no cortar otros recorridos.
+
+bool eliminarHash(TablaHashPalabras& tabla, string_view palabra) {
+    size_t posicion = posicionHash(tabla, palabra, hashFiltro(palabra));
+    if (posicion == TablaHashPalabras::NINGUNA) return false;
+
+    const size_t GRUPO = TablaHashPalabras::POSICIONES_POR_GRUPO;
+    const int8_t* grupo = tabla.control.data() + posicion / GRUPO * GRUPO;
+    bool hayVacia = false;
+    for (size_t i = 0; i < GRUPO; ++i) {
+        if (grupo[i] == TablaHashPalabras::VACIA) hayVacia = true;
+    }
+    tabla.control[posicion] = hayVacia ? TablaHashPalabras::VACIA : TablaHashPalabras::BORRADA;
+    if (!hayVacia) tabla.borradas++;
+    tabla.ocupadas--;
+    liberarEntrada(tabla.entradas[posicion]);
+    return true;
+}
+
+
+
+// Funcin para eliminar todas las palabras de la tabla hash.
+//
+// Parmetros:
+// - tabla: Tabla hash de palabras; queda vaca y sin memoria reservada.
+
+void vaciarHash(TablaHashPalabras& tabla) {
+    for (size_t i = 0; i < tabla.control.size(); ++i) {
+        if (tabla.control[i] >= 0) liberarEntrada(tabla.entradas[i]);
+    }
+    tabla = TablaHashPalabras();
+}
+
+
+
+// Funcin para verificar la tabla hash (equivalente a `validarArbol`).
+//
+// Parmetros:
+// - tabla: Tabla hash de palabras.
+//
+// Retorno:
+// - true si la capacidad es vlida, los contadores coinciden con los bytes de control, cada palabra tiene
+//   en su control los 7 bits de su hash y se encuentra en su posicin, y queda al menos 1/8 de posiciones vacas.
+
+bool validarHash(const TablaHashPalabras& tabla) {
+    size_t capacidad = tabla.control.size();
+    if (capacidad && (capacidad < TablaHashPalabras::POSICIONES_POR_GRUPO || (capacidad & (capacidad - 1)))) return false;
+
+    size_t ocupadas = 0, borradas = 0;
+    for (size_t i = 0; i < capacidad; ++i) {
+        int8_t control = tabla.control[i];
+        if (control == TablaHashPalabras::BORRADA) ++borradas;
+        if (control < 0) continue;
+        ++ocupadas;
+        string_view clave = cadenaDe(tablaPalabras.palabras[tabla.entradas[i]].espanol);
+        uint64_t hash = hashFiltro(clave);
+        if (control != static_cast<int8_t>(hash & 0x7F) || posicionHash(tabla, clave, hash) != i) return false;
+    }
+    return ocupadas == tabla.ocupadas && borradas == tabla.borradas && (ocupadas + borradas) * 8 <= capacidad * 7;
+}
+
+
+
+
+//==========================FUNCIONES DE LOS MOTORES DEL DICCIONARIO==========================
+
+
+
+// Estructura con las operaciones de un motor del diccionario (la estructura que guarda las palabras
+// en espaol y permite agregarlas, buscarlas y eliminarlas).
+//
+// Campos:
+// - nombre: Nombre del motor ("avl" o "hash"), el mismo que se usa para elegirlo (ver `crearMotor`).
+// - agregar: Agrega una palabra; retorna false si ya estaba (sin cambiar sus traducciones).
+// - buscar: Retorna la palabra interna de una palabra en espaol, o nullptr si no est.
+// - eliminar: Elimina una palabra; retorna false si no estaba.
+// - cantidad: Cantidad de palabras guardadas.
+// - validar: Verifica las invariantes de la estructura (`validarArbol`, `validarHash`).
+// - vaciar: Elimina todas las palabras.
+//
+// Notas:
+// - Las dos implementaciones guardan las palabras en `tablaPalabras` y el pool de cadenas, as que las
+//   traducciones se leen igual con cualquiera. Las operaciones capturan la estructura del motor
+//   (la raz del rbol o la tabla hash), que debe existir mientras se use el motor.
+// - El rbol AVL sigue siendo el motor del programa interactivo, porque el autocompletado, la exploracin,
+//   los ndices inversos y el diccionario binario dependen del orden alfabtico. La tabla hash sirve
+//   para cargas que solo buscan palabras exactas.
+
+struct MotorDiccionario {
+    string nombre;
+    function<bool(const Palabra&)> agregar;
+    function<const PalabraInterna* (const string&)> buscar;
+    function<bool(const string&)> eliminar;
+    function<size_t()> cantidad;
+    function<bool()> validar;
+    function<void()> vaciar;
+};
+
+
+
+// Funcin para crear el motor del rbol AVL.
+//
+// Parmetros:
+// - raiz: Raz del rbol que usar el motor (se actualiza en cada operacin).
+//
+// Retorno:
+// - El motor "avl", construido sobre `insertar`, `buscar` y `eliminarPalabra`.
+
+MotorDiccionario motorArbol(uint32_t& raiz) {
+    MotorDiccionario motor;
+    motor.nombre = "avl";
+    motor.agregar = [&raiz](const Palabra& p) {
+        uint32_t antes = tamano(raiz);
+        raiz = insertar(raiz, p);
+        return tamano(raiz) != antes;
+        };
+    motor.buscar = [&raiz](const string& palabra) -> const PalabraInterna* {
+        uint32_t nodo = buscar(raiz, palabra);
+        return nodo ? &palabraDe(nodo) : nullptr;
+        };
+    motor.eliminar = [&raiz](const string& palabra) {
+        uint32_t antes = tamano(raiz);
+        raiz = eliminarPalabra(raiz, palabra);
+        return tamano(raiz) != antes;
+        };
+    motor.cantidad = [&raiz]() { return static_cast<size_t>(tamano(raiz)); };
+    motor.validar = [&raiz]() {
+        ResumenArbol resumen;
+        return validarArbol(raiz, resumen);
+        };
+    motor.vaciar = [&raiz]() {
+        vector<uint32_t> nodos;
+        recorrerInorden(raiz, nodos);
+        for (uint32_t nodo : nodos) {
+            desindexarTraducciones(nodoEn(nodo).entrada);
+            liberarEntrada(nodoEn(nodo).entrada);
+            destruirNodo(nodo);
+        }
+        raiz = 0;
+        };
+    return motor;
+}
+
+
+
+// Funcin para crear el motor de la tabla hash.
+//
+// Parmetros:
+// - tabla: Tabla hash que usar el motor.
+//
+// Retorno:
+// - El motor "hash", construido sobre `agregarHash`, `buscarHash` y `eliminarHash`.
+
+MotorDiccionario motorHash(TablaHashPalabras& tabla) {
+    MotorDiccionario motor;
+    motor.nombre = "hash";
+    motor.agregar = [&tabla](const Palabra& p) { return agregarHash(tabla, p); };
+    motor.buscar = [&tabla](const string& palabra) { return buscarHash(tabla, palabra); };
+    motor.eliminar = [&tabla](const string& palabra) { return eliminarHash(tabla, palabra); };
+    motor.cantidad = [&tabla]() { return tabla.ocupadas; };
+    motor.validar = [&tabla]() { return validarHash(tabla); };
+    motor.vaciar = [&tabla]() { vaciarHash(tabla); };
+    return motor;
+}
+
+
+
+// Funcin para elegir un motor por su nombre (por ejemplo, desde la lnea de comandos).
+//
+// Parmetros:
+// - nombre: "avl" o "hash".
+// - raiz: Raz del rbol para el motor "avl".
+// - tabla: Tabla hash para el motor "hash".
+// - motor: Variable donde se guarda el motor elegido.
+//
+// Retorno:
+// - true si el nombre corresponde a un motor, false en caso contrario.
+
+bool crearMotor(const string& nombre, uint32_t& raiz, TablaHashPalabras& tabla, MotorDiccionario& motor) {
+    if (nombre == "avl") {
+        motor = motorArbol(raiz);
+        return true;
+    }
+    if (nombre == "hash") {
+        motor = motorHash(tabla);
+        return true;
+    }
+    return false;
+}
+
+
+
+
+//==========================FUNCIONES DE COLUMNAS POR IDIOMA==========================
+
+
+
+// Funcin para cerrar la columna mapeada de un idioma (si est abierta).
+//
+// Parmetros:
+// - idioma: Idioma de la columna.
+
+void cerrarColumna(int idioma) {
+    ColumnaMapeada& columna = columnasIdiomas.mapeadas[idioma];
+    desmapearArchivo(columna.archivo, columna.mapeo, columna.datos);
+    columna.ids = nullptr;
+    columna.texto = nullptr;
+    columna.cantidad = 0;
+}
+
+
+
+// Funcin para cerrar todas las columnas mapeadas.
+//
+// Notas:
+// - Se debe llamar antes de guardar el diccionario binario o de comprimir la carpeta al salir.
+
+void cerrarColumnas() {
+    for (int idioma = 0; idioma < CANTIDAD_IDIOMAS; ++idioma) {
+        cerrarColumna(idioma);
+    }
+}
+
+
+
+// Funcin para abrir y mapear en memoria la columna de un idioma.
+//
+// Parmetros:
+// - idioma: Idioma de la columna.
+// - sumaDiccionario: Suma de verificacin del diccionario binario al que debe pertenecer.
+// - cantidad: Cantidad de filas que debe tener (las palabras del diccionario binario).
+//
+// Retorno:
+// - true si la columna est mapeada y es vlida, false en caso contrario.
+//
+// Proceso:
+// 1. Si la columna ya est mapeada, no hace nada.
+// 2. Mapea el archivo con `mapearArchivo` y verifica la firma, el idioma, la cantidad de filas, la suma
+//    del diccionario, el tamao de las secciones y la suma de verificacin.
+//
+// Notas:
+// - Solo se verifica la columna que se usa, por lo que abrir el diccionario no depende de cuntos
+//   idiomas haya.
+
+bool abrirColumna(int idioma, uint64_t sumaDiccionario, size_t cantidad) {
+    ColumnaMapeada& columna = columnasIdiomas.mapeadas[idioma];
+    if (columna.datos) return true;
+
+    uint64_t tamano = 0;
+    columna.datos = mapearArchivo(columnasIdiomas.rutas[idioma], columna.archivo, columna.mapeo, tamano);
+    if (!columna.datos) return false;
+
+    const CabeceraColumna* cabecera = reinterpret_cast<const CabeceraColumna*>(columna.datos);
+    uint64_t disponible = tamano >= sizeof(CabeceraColumna) ? tamano - sizeof(CabeceraColumna) : 0;
+    bool valido = tamano >= sizeof(CabeceraColumna) &&
+        memcmp(cabecera->firma, "TRDC", 4) == 0 &&
+        cabecera->idioma == static_cast<uint32_t>(idioma) &&
+        cabecera->cantidad == cantidad &&
+        cabecera->sumaDiccionario == sumaDiccionario &&
+        cabecera->cantidad <= disponible / sizeof(uint32_t) &&
+        cabecera->largoTexto == disponible - cabecera->cantidad * sizeof(uint32_t) &&
+        cabecera->suma == sumaVerificacion(columna.datos + sizeof(CabeceraColumna), static_cast<size_t>(disponible));
+    if (!valido) {
+        cerrarColumna(idioma);
+        return false;
+    }
+
+    columna.cantidad = cantidad;
+    columna.ids = reinterpret_cast<const uint32_t*>(columna.datos + sizeof(CabeceraColumna));
+    columna.texto = reinterpret_cast<const char*>(columna.ids + cantidad);
+    return true;
+}
+
+
+
+// Funcin para leer una traduccin directamente de la columna mapeada, sin cargarla en memoria.
+//
+// Parmetros:
+// - binario: Diccionario binario abierto.
+// - fila: Fila de la palabra (ver `buscarBinario`).
+// - idioma: Idioma de la traduccin.
+// - traduccion: Variable donde se guarda la traduccin (apunta al archivo mapeado).
+//
+// Retorno:
+// - true si la columna es vlida, false en caso contrario (la traduccin se debe obtener con `cargarColumna`).
+//
+// Notas:
+// - La primera vez que se usa un idioma mapea su columna; del archivo solo se leen las pginas que se consultan.
+
+bool traduccionBinaria(const DiccionarioBinario& binario, size_t fila, int idioma, string_view& traduccion) {
+    if (!abrirColumna(idioma, binario.cabecera->suma, binario.cantidad)) return false;
+
+    const ColumnaMapeada& columna = columnasIdiomas.mapeadas[idioma];
+    traduccion = cadenaEn(columna.texto, columna.ids[fila]);
+    columnasIdiomas.ultimoUso[idioma] = chrono::steady_clock::now();
+    return true;
+}
+
+
+
+// Funcin para devolver al pool de cadenas las traducciones comprimidas de un idioma
+// (definida en la seccin de traducciones comprimidas).
+void descomprimirColumna(int idioma);
+
+
+
+// Funcin para cargar en memoria las traducciones de un idioma.
+//
+// Parmetros:
+// - idioma: Idioma que se desea cargar.
+//
+// Proceso:
+// 1. Si el idioma ya est cargado, solo actualiza su ltimo uso. Si est comprimido en memoria, lo descomprime
+//    con `descomprimirColumna`.
+// 2. Si su columna es vlida, copia al pool de cadenas la traduccin de cada fila pendiente y cierra la columna.
+// 3. Si la columna falta o est daada, lee `palabras.umg` y los registros de cambios (despus de esperar
+//    la compactacin en curso) y busca cada palabra pendiente por su palabra en espaol.
+//
+// Notas:
+// - Solo se completan las posiciones pendientes (`PoolCadenas::SIN_CADENA`); las palabras agregadas durante
+//   la sesin ya tienen sus traducciones.
+// - Internar cadenas puede mover el pool de cadenas: las cadenas obtenidas antes con `cadenaDe` dejan de ser vlidas.
+// - No se debe llamar mientras el rbol se carga en segundo plano (ver `esperarCargaBinaria`).
+
+void cargarColumna(int idioma) {
+    columnasIdiomas.ultimoUso[idioma] = chrono::steady_clock::now();
+    if (columnasIdiomas.cargada[idioma]) return;
+    if (columnasIdiomas.comprimidas[idioma].cantidad) {
+        descomprimirColumna(idioma);
+        columnasIdiomas.cargada[idioma] = true;
+        return;
+    }
+
+    size_t pendientes = min(columnasIdiomas.pendientes, tablaPalabras.palabras.size());
+    if (abrirColumna(idioma, columnasIdiomas.sumaDiccionario, columnasIdiomas.pendientes)) {
+        const ColumnaMapeada& columna = columnasIdiomas.mapeadas[idioma];
+        for (size_t i = 0; i < pendientes; ++i) {
+            uint32_t& traduccion = traduccionDe(tablaPalabras.palabras[i], idioma);
+            if (traduccion == PoolCadenas::SIN_CADENA) {
+                traduccion = internarCadena(cadenaEn(columna.texto, columna.ids[i]));
+            }
+        }
+        cerrarColumna(idioma); // Las traducciones ya estn en el pool.
+    }
+    else {
+        // Columna ausente o daada: tomar las traducciones de los archivos de texto.
+        cerr << "La columna " << columnasIdiomas.rutas[idioma] << " no es valida; se lee el archivo de palabras.\n";
+        esperarCompactacion();
+        ArchivoPalabras archivo;
+        size_t registros = 0;
+        leerArchivoPalabras(registroCambios.rutaBase, archivo, registros);
+        aplicarCambios(registroCambios.rutaAnterior, archivo);
+        aplicarCambios(registroCambios.rutaCambios, archivo);
+
+        auto menor = [](const VistaPalabra& a, string_view espanol) {
+            return a.espanol < espanol;
+            };
+        for (size_t i = 0; i < pendientes; ++i) {
+            PalabraInterna& palabra = tablaPalabras.palabras[i];
+            uint32_t& traduccion = traduccionDe(palabra, idioma);
+            if (traduccion != PoolCadenas::SIN_CADENA) continue;
+
+            // Las posiciones liberadas no estn en el archivo; quedan con una traduccin vaca.
+            string_view espanol = cadenaDe(palabra.espanol);
+            auto encontrada = lower_bound(archivo.palabras.begin(), archivo.palabras.end(), espanol, menor);
+            string_view texto;
+            if (encontrada != archivo.palabras.end() && encontrada->espanol == espanol) {
+                const VistaPalabra& vista = *encontrada;
+                const string_view traducciones[CANTIDAD_IDIOMAS] = { vista.ingles, vista.aleman, vista.frances, vista.italiano };
+                texto = traducciones[idioma];
+            }
+            traduccion = internarCadena(texto);
+        }
+    }
+
+    columnasIdiomas.cargada[idioma] = true;
+}
+
+
+
+// Funcin para cargar en memoria las traducciones de todos los idiomas.
+//
+// Notas:
+// - La necesitan las funciones que leen las cuatro traducciones de cada palabra (explorar el diccionario,
+//   la lectura concurrente y guardar el diccionario binario).
+
+void cargarColumnas() {
+    for (int idioma = 0; idioma < CANTIDAD_IDIOMAS; ++idioma) {
+        cargarColumna(idioma);
+    }
+}
+
+
+
+// Funcin para asegurar que el ndice inverso de un idioma est construido.
+//
+// Parmetros:
+// - raiz: ndice del nodo raz del rbol principal.
+// - idioma: Idioma del ndice.
+//
+// Proceso:
+// 1. Carga las traducciones del idioma con `cargarColumna`.
+// 2. Si el ndice no est construido, lo construye con `construirIndiceInverso`.
+
+void asegurarIndiceInverso(uint32_t raiz, int idioma) {
+    cargarColumna(idioma);
+    if (!columnasIdiomas.indexada[idioma]) {
+        construirIndiceInverso(raiz, idioma, "C:\\traductor\\indices.umg");
+    }
+}
+
+
+
+// Funcin auxiliar para devolver a pendientes las traducciones de un idioma que se pueden volver a leer
+// de su columna.
+//
+// Parmetros:
+// - idioma: Idioma cargado que se desea descargar.
+//
+// Retorno:
+// - true si alguna traduccin qued pendiente (su cadena ya no se usa en `tablaPalabras`), false si no.
+//
+// Proceso:
+// 1. Abre la columna del idioma; si no es vlida (o el diccionario se carg desde `palabras.umg` y no hay
+//    filas del diccionario binario), no hace nada.
+// 2. Cambia por `SIN_CADENA` la traduccin de cada fila del diccionario binario que sigue siendo igual a la
+//    de la columna, marca el idioma como no cargado y cierra la columna.
+//
+// Notas:
+// - Comparar el texto evita perder las traducciones de las palabras agregadas durante la sesin, incluidas
+//   las que ocupan una posicin liberada dentro de las filas del diccionario binario.
+// - `cargarColumna` vuelve a completar las traducciones pendientes la prxima vez que se use el idioma.
+
+bool descargarColumna(int idioma) {
+    if (!columnasIdiomas.cargada[idioma] || columnasIdiomas.pendientes == 0) return false;
+    if (!abrirColumna(idioma, columnasIdiomas.sumaDiccionario, columnasIdiomas.pendientes)) return false;
+
+    vector<PalabraInterna>& palabras = tablaPalabras.palabras;
+    vector<bool> libre(palabras.size(), false);
+    for (uint32_t entrada : tablaPalabras.libres) libre[entrada] = true;
+
+    const ColumnaMapeada& columna = columnasIdiomas.mapeadas[idioma];
+    size_t pendientes = min(columnasIdiomas.pendientes, palabras.size());
+    size_t descargadas = 0;
+    for (size_t i = 0; i < pendientes; ++i) {
+        uint32_t& traduccion = traduccionDe(palabras[i], idioma);
+        if (libre[i] || traduccion == PoolCadenas::SIN_CADENA) continue;
+        if (cadenaDe(traduccion) == cadenaEn(columna.texto, columna.ids[i])) {
+            traduccion = PoolCadenas::SIN_CADENA;
+            ++descargadas;
+        }
+    }
+
+    cerrarColumna(idioma);
+    columnasIdiomas.cargada[idioma] = false;
+    return descargadas > 0;
+}
+
+
+
+// Funcin para liberar los idiomas que no se usan cuando falta memoria.
+//
+// Proceso:
+// 1. Consulta la memoria fsica en uso con `GlobalMemoryStatusEx`; si est por debajo de
+//    CARGA_MEMORIA_ALTA, no hace nada.
+// 2. Para cada idioma que no se us en los ltimos MINUTOS_FRIO minutos, cierra su columna mapeada, libera
+//    su ndice inverso y devuelve a pendientes sus traducciones con `descargarColumna`.
+// 3. Si algn idioma se descarg, reconstruye el pool de cadenas (`compactarPoolCadenas`) para liberar el
+//    texto de esas traducciones.
+//
+// Notas:
+// - Solo se descargan las traducciones que se pueden volver a leer de la columna del idioma; las de las
+//   palabras agregadas durante la sesin y las de un diccionario cargado desde `palabras.umg` quedan en el
+//   pool. Los idiomas comprimidos en memoria no se tocan.
+// - El ndice inverso y las traducciones se recuperan la prxima vez que se usa el idioma.
+// - No se debe llamar mientras el rbol se carga en segundo plano.
+
+void liberarColumnasFrias() {
+    MEMORYSTATUSEX estado;
+    estado.dwLength = sizeof(estado);
+    if (!GlobalMemoryStatusEx(&estado) || estado.dwMemoryLoad < ColumnasIdiomas::CARGA_MEMORIA_ALTA) return;
+
+    auto limite = chrono::steady_clock::now() - chrono::minutes(ColumnasIdiomas::MINUTOS_FRIO);
+    bool descargadas = false;
+    for (int idioma = 0; idioma < CANTIDAD_IDIOMAS; ++idioma) {
+        if (columnasIdiomas.ultimoUso[idioma] > limite) continue;
+        cerrarColumna(idioma);
+        if (columnasIdiomas.indexada[idioma]) liberarIndiceInverso(idioma);
+        if (descargarColumna(idioma)) descargadas = true;
+    }
+    if (descargadas) compactarPoolCadenas();
+}
+
+
+
+
+//==========================FUNCIONES DE TRADUCCIN DE TEXTO==========================
+
+
+
+// Estructura para almacenar una palabra (o frase) del diccionario encontrada dentro de un texto.
+//
+// Campos:
+// - inicio: Posicin del primer carcter dentro del texto.
+// - largo: Cantidad de caracteres.
+// - entrada: Posicin de la palabra en `tablaPalabras`.
+
+struct CoincidenciaTexto {
+    size_t inicio;
+    size_t largo;
+    uint32_t entrada;
+};
+
+
+
+// Funcin para pasar una letra a minscula al buscar palabras dentro de un texto.
+//
+// Notas:
+// - Solo cambia las letras A-Z; los dems caracteres (incluidos los acentuados) quedan igual.
+
+inline unsigned char minusculaTexto(unsigned char c) {
+    return (c >= 'A' && c <= 'Z') ? static_cast<unsigned char>(c - 'A' + 'a') : c;
+}
+
+
+
+// Funcin para saber si un carcter forma parte de una palabra al traducir un texto.
+//
+// Notas:
+// - Los caracteres mayores a 127 cuentan como letras para no partir las palabras acentuadas.
+// - No usa `isalnum` porque se llama para cada carcter del texto y no depende de la configuracin regional.
+
+inline bool esLetraTexto(unsigned char c) {
+    return static_cast<unsigned char>((c | 0x20) - 'a') < 26 || static_cast<unsigned char>(c - '0') < 10 || c >= 0x80;
+}
+
+
+
+// Funcin para saber si una coincidencia puede comenzar en el carcter `actual`, dado el anterior.
+//
+// Notas:
+// - Solo se puede comenzar al inicio de una palabra (el anterior no es una letra) o en un carcter
+//   que no es una letra (por ejemplo, un signo que forme parte de una frase del diccionario).
+
+inline bool inicioTexto(unsigned char anterior, unsigned char actual) {
+    return !esLetraTexto(anterior) || !esLetraTexto(actual);
+}
+
+
+
+// Funcin para obtener el hijo de un estado del autmata con una letra.
+//
+// Parmetros:
+// - automata: Autmata construido con `construirAutomata`.
+// - estado: Estado actual.
+// - letra: Letra (ya en minscula) que se desea seguir.
+//
+// Retorno:
+// - El estado hijo, o 0 si no existe (la raz nunca es hija de otro estado).
+//
+// Notas:
+// - Las aristas de cada estado son consecutivas y estn ordenadas por letra, por lo que se buscan
+//   con una bsqueda binaria (o lineal si son pocas, como en casi todos los estados profundos).
+
+inline uint32_t hijoAutomata(const AutomataFrases& automata, uint32_t estado, unsigned char letra) {
+    const unsigned char* primera = automata.letras.data() + automata.inicioHijos[estado];
+    const unsigned char* ultima = automata.letras.data() + automata.inicioHijos[estado + 1];
+    const unsigned char* encontrada = primera;
+    if (ultima - primera <= 8) {
+        while (encontrada != ultima && *encontrada < letra) ++encontrada; // Pocos hijos: bsqueda lineal.
+    }
+    else {
+        encontrada = lower_bound(primera, ultima, letra);
+    }
+    if (encontrada == ultima || *encontrada != letra) return 0;
+    return automata.destinos[encontrada - automata.letras.data()];
+}
+
+
+
+// Funcin para construir el autmata de Aho-Corasick con todas las palabras en espaol del diccionario.
+//
+// Parmetros:
+// - raiz: ndice del nodo raz del rbol AVL.
+// - automata: Autmata que se construye (se reemplaza su contenido anterior).
+//
+// Proceso:
+// 1. Toma las palabras en espaol (incluidas las de varias palabras, como "buenos dias") en minsculas
+//    y las ordena; si dos quedan iguales, se conserva la primera.
+// 2. Arma el trie: como las palabras estn ordenadas, cada estado recibe sus hijos en orden de letra
+//    y basta con mirar el ltimo hijo creado. Los estados quedan numerados en preorden, por lo que
+//    los estados profundos de una misma rama quedan juntos en memoria.
+// 3. Copia las aristas de cada estado a posiciones consecutivas (`inicioHijos`, `letras`, `destinos`).
+// 4. Recorriendo por niveles, calcula el enlace de falla de cada estado y el enlace de salida (el
+//    estado ms cercano en la cadena de fallas donde termina una palabra).
+//
+// Notas:
+// - Solo necesita las palabras en espaol; las traducciones se leen al traducir.
+// - Como las coincidencias solo pueden comenzar al inicio de una palabra, el enlace de falla de un
+//   estado en medio de una palabra (por ejemplo, "palabr") va directo a la raz en lugar de recorrer
+//   "alabr", "labr", ...; las cadenas de fallas solo pasan por los espacios de las frases.
+// - Costo O(n log n) por el orden ms O(largo total de las palabras) para el trie y los enlaces.
+
+void construirAutomata(uint32_t raiz, AutomataFrases& automata) {
+    const uint32_t SIN_ENTRADA = AutomataFrases::SIN_ENTRADA;
+
+    // 1. Palabras en minsculas, ordenadas.
+    vector<uint32_t> nodos;
+    recorrerInorden(raiz, nodos);
+    vector<pair<string, uint32_t>> claves;
+    claves.reserve(nodos.size());
+    for (uint32_t nodo : nodos) {
+        string clave(cadenaDe(palabraDe(nodo).espanol));
+        for (char& c : clave) c = static_cast<char>(minusculaTexto(static_cast<unsigned char>(c)));
+        claves.emplace_back(move(clave), nodoEn(nodo).entrada);
+    }
+    stable_sort(claves.begin(), claves.end(), [](const pair<string, uint32_t>& a, const pair<string, uint32_t>& b) {
+        return a.first < b.first;
+        });
+
+    // 2. Trie con hijos enlazados (primer hijo, siguiente hermano). Los estados se crean en preorden.
+    vector<uint32_t> primerHijo(1, 0), siguienteHermano(1, 0), ultimoHijo(1, 0);
+    vector<unsigned char> letraDe(1, 0); // Letra con la que se llega a cada estado.
+    automata.entradas.assign(1, SIN_ENTRADA);
+    for (const auto& [clave, entrada] : claves) {
+        uint32_t estado = 0;
+        for (unsigned char letra : clave) {
+            uint32_t hijo = ultimoHijo[estado];
+            if (!hijo || letraDe[hijo] != letra) {
+                hijo = static_cast<uint32_t>(letraDe.size());
+                letraDe.push_back(letra);
+                primerHijo.push_back(0);
+                siguienteHermano.push_back(0);
+                ultimoHijo.push_back(0);
+                automata.entradas.push_back(SIN_ENTRADA);
+                if (ultimoHijo[estado]) siguienteHermano[ultimoHijo[estado]] = hijo;
+                else primerHijo[estado] = hijo;
+                ultimoHijo[estado] = hijo;
+            }
+            estado = hijo;
+        }
+        if (estado && automata.entradas[estado] == SIN_ENTRADA) automata.entradas[estado] = entrada;
+    }
+    ultimoHijo = vector<uint32_t>();
+
+    // 3. Aristas contiguas por estado, en el mismo orden de los estados.
+    size_t cantidad = letraDe.size();
+    automata.inicioHijos.assign(cantidad + 1, 0);
+    automata.letras.clear();
+    automata.letras.reserve(cantidad - 1);
+    automata.destinos.clear();
+    automata.destinos.reserve(cantidad - 1);
+    automata.largos.assign(cantidad, 0);
+    for (uint32_t estado = 0; estado < cantidad; ++estado) {
+        automata.inicioHijos[estado] = static_cast<uint32_t>(automata.destinos.size());
+        for (uint32_t hijo = primerHijo[estado]; hijo; hijo = siguienteHermano[hijo]) {
+            automata.letras.push_back(letraDe[hijo]);
+            automata.destinos.push_back(hijo);
+            automata.largos[hijo] = automata.largos[estado] + 1;
+        }
+    }
+    automata.inicioHijos[cantidad] = static_cast<uint32_t>(automata.destinos.size());
+    primerHijo = vector<uint32_t>();
+    siguienteHermano = vector<uint32_t>();
+
+    // 4. Enlaces de falla y de salida, por niveles: los estados menos profundos se calculan primero.
+    automata.falla.assign(cantidad, 0);
+    automata.salida.assign(cantidad, 0);
+    vector<uint32_t> cola(1, 0);
+    cola.reserve(cantidad);
+    for (size_t posicion = 0; posicion < cola.size(); ++posicion) {
+        uint32_t estado = cola[posicion];
+        for (uint32_t arista = automata.inicioHijos[estado]; arista < automata.inicioHijos[estado + 1]; ++arista) {
+            uint32_t hijo = automata.destinos[arista];
+            unsigned char letra = automata.letras[arista];
+            uint32_t falla = 0;
+            if (estado) {
+                // Sufijos del estado que comienzan al inicio de una palabra; la raz solo sirve si la
+                // letra nueva puede comenzar una coincidencia.
+                uint32_t candidato = automata.falla[estado];
+                while (candidato && !(falla = hijoAutomata(automata, candidato, letra))) {
+                    candidato = automata.falla[candidato];
+                }
+                if (!candidato && inicioTexto(letraDe[estado], letra)) {
+                    falla = hijoAutomata(automata, 0, letra);
+                }
+            }
+            automata.falla[hijo] = falla;
+            automata.salida[hijo] = automata.entradas[falla] != SIN_ENTRADA ? falla : automata.salida[falla];
+            cola.push_back(hijo);
+        }
+    }
+
+    automata.vigente = true;
+}
+
+
+
+// Funcin para encontrar las palabras del diccionario que aparecen en un texto.
+//
+// Parmetros:
+// - automata: Autmata construido con `construirAutomata`.
+// - texto: Texto en espaol.
+//
+// Retorno:
+// - Las coincidencias en orden, sin solaparse: en cada posicin se toma la palabra (o frase) ms
+//   larga que comienza ah, y la bsqueda contina despus de ella.
+//
+// Proceso:
+// 1. Recorre el texto una sola vez avanzando en el autmata (siguiendo los enlaces de falla cuando
+//    no hay hijo) sin distinguir maysculas de minsculas. Desde la raz solo se avanza al inicio
+//    de una palabra del texto.
+// 2. Al final de cada palabra del texto, recorre los enlaces de salida y anota cada palabra del
+//    diccionario que termina ah.
+// 3. Ordena las coincidencias por inicio y las recorre de izquierda a derecha tomando la ms larga
+//    de cada inicio y saltando las que se solapan con la anterior.
+//
+// Notas:
+// - Solo se aceptan coincidencias completas: "casa" no se encuentra dentro de "casamiento".
+
+vector<CoincidenciaTexto> buscarEnTexto(const AutomataFrases& automata, string_view texto) {
+    const uint32_t SIN_ENTRADA = AutomataFrases::SIN_ENTRADA;
+    size_t n = texto.size();
+    vector<CoincidenciaTexto> encontradas;
+
+    uint32_t estado = 0;
+    unsigned char anterior = ' ';
+    for (size_t i = 0; i < n; ++i) {
+        unsigned char letra = minusculaTexto(static_cast<unsigned char>(texto[i]));
+        uint32_t hijo = 0;
+        while (estado && !(hijo = hijoAutomata(automata, estado, letra))) {
+            estado = automata.falla[estado];
+        }
+        if (!estado && inicioTexto(anterior, letra)) {
+            hijo = hijoAutomata(automata, 0, letra);
+        }
+        estado = hijo;
+        anterior = letra;
+
+        // Solo interesan las coincidencias que terminan al final de una palabra del texto.
+        if (i + 1 < n && esLetraTexto(static_cast<unsigned char>(texto[i + 1])) && esLetraTexto(letra)) continue;
+
+        uint32_t salida = automata.entradas[estado] != SIN_ENTRADA ? estado : automata.salida[estado];
+        for (; salida; salida = automata.salida[salida]) {
+            uint32_t largo = automata.largos[salida];
+            encontradas.push_back({ i + 1 - largo, largo, automata.entradas[salida] });
+        }
+    }
+
+    // Ordenar por inicio; solo las frases de varias palabras pueden dejar el vector desordenado.
+    auto antes = [](const CoincidenciaTexto& a, const CoincidenciaTexto& b) {
+        return a.inicio < b.inicio;
+        };
+    if (!is_sorted(encontradas.begin(), encontradas.end(), antes)) {
+        stable_sort(encontradas.begin(), encontradas.end(), antes);
+    }
+
+    vector<CoincidenciaTexto> coincidencias;
+    size_t fin = 0;
+    for (const CoincidenciaTexto& coincidencia : encontradas) {
+        if (!coincidencias.empty() && coincidencia.inicio == coincidencias.back().inicio) {
+            // Mismo inicio que la elegida: quedarse con la ms larga.
+            if (coincidencia.largo > coincidencias.back().largo) {
+                coincidencias.back() = coincidencia;
+                fin = coincidencia.inicio + coincidencia.largo;
+            }
+        }
+        else if (coincidencia.inicio >= fin) {
+            coincidencias.push_back(coincidencia);
+            fin = coincidencia.inicio + coincidencia.largo;
+        }
+    }
+    return coincidencias;
+}
+
+
+
+// Funcin para traducir un texto completo (una oracin o un documento) a otro idioma.
+//
+// Parmetros:
+// - raiz: ndice del nodo raz del rbol AVL.
+// - texto: Texto en espaol.
+// - idioma: Idioma de destino (ver `Idioma`).
+// - traducidas: Variable donde se guarda la cantidad de palabras (o frases) traducidas.
+//
+// Retorno:
+// - El texto con cada palabra o frase del diccionario reemplazada por su traduccin; el resto
+//   (palabras desconocidas, espacios y signos) se copia igual.
+//
+// Proceso:
+// 1. Si el diccionario cambi desde la ltima vez (ver `indexarTraducciones`), reconstruye el autmata.
+// 2. Carga las traducciones del idioma con `cargarColumna`.
+// 3. Busca las coincidencias con `buscarEnTexto` y arma el texto traducido. Si la palabra del texto
+//    empieza con mayscula, la traduccin tambin.
+//
+// Notas:
+// - Las palabras sin traduccin (vacas) se dejan en espaol.
+
+string traducirTexto(uint32_t raiz, string_view texto, int idioma, size_t& traducidas) {
+    if (!automataFrases.vigente) {
+        construirAutomata(raiz, automataFrases);
+    }
+    cargarColumna(idioma);
+
+    string resultado;
+    resultado.reserve(texto.size() + texto.size() / 4);
+    size_t copiado = 0;
+    traducidas = 0;
+    for (const CoincidenciaTexto& coincidencia : buscarEnTexto(automataFrases, texto)) {
+        string_view traduccion = cadenaDe(traduccionDe(tablaPalabras.palabras[coincidencia.entrada], idioma));
+        if (traduccion.empty()) continue;
+
+        resultado.append(texto.data() + copiado, coincidencia.inicio - copiado);
+        size_t inicio = resultado.size();
+        resultado.append(traduccion);
+        char primera = texto[coincidencia.inicio];
+        if (primera >= 'A' && primera <= 'Z' && resultado[inicio] >= 'a' && resultado[inicio] <= 'z') {
+            resultado[inicio] = static_cast<char>(resultado[inicio] - 'a' + 'A');
+        }
+        copiado = coincidencia.inicio + coincidencia.largo;
+        ++traducidas;
+    }
+    resultado.append(texto.data() + copiado, texto.size() - copiado);
+    return resultado;
+}
+
+
+
+
+//==========================FUNCIONES DE MEDICION DE RENDIMIENTO==========================
+
+
+
+// Funcin para medir cuntas bsquedas por segundo logran varios hilos lectores a la vez.
+//
+// Parmetros:
+// - raiz: ndice de la raz del rbol AVL; se actualiza con la versin final del rbol.
+//
+// Proceso:
+// 1. Toma una muestra de hasta 4096 palabras del diccionario.
+// 2. Para 1, 2, 4, ... hilos (hasta los ncleos disponibles), mide durante un segundo las bsquedas
+//    con `buscarConcurrente`, primero sin escritor y luego con un escritor que elimina y vuelve
+//    a agregar palabras de la muestra sin pausa.
+// 3. Muestra las bsquedas por segundo en total y por hilo, y las escrituras por segundo.
+//
+// Notas:
+// - Al terminar, el diccionario contiene las mismas palabras que al comenzar.
+// - Los lectores leen las cuatro traducciones, por lo que antes se cargan todas (`cargarColumnas`).
+
+void medirLecturaConcurrente(uint32_t& raiz) {
+    if (!raiz) {
+        cout << "El diccionario esta vacio.\n";
+        return;
+    }
+    cargarColumnas();
+
+    // Tomar una muestra repartida por todo el diccionario.
+    vector<uint32_t> nodos;
+    recorrerInorden(raiz, nodos);
+    size_t paso = nodos.size() / 4096 + 1;
+    vector<Palabra> muestra;
+    for (size_t i = 0; i < nodos.size(); i += paso) {
+        const PalabraInterna& p = palabraDe(nodos[i]);
+        muestra.push_back({ string(cadenaDe(p.espanol)), string(cadenaDe(p.ingles)), string(cadenaDe(p.aleman)),
+            string(cadenaDe(p.frances)), string(cadenaDe(p.italiano)) });
+    }
+
+    unsigned int nucleos = thread::hardware_concurrency();
+    if (nucleos == 0) nucleos = 1;
+    if (nucleos > DiccionarioConcurrente::MAXIMO_LECTORES) nucleos = DiccionarioConcurrente::MAXIMO_LECTORES;
+
+    activarLecturaConcurrente(raiz);
+    cout << "\n--- LECTURA CONCURRENTE (" << nodos.size() << " palabras) ---\n";
+    cout << "Hilos | Escritor | Busquedas/s | Por hilo | Escrituras/s\n";
+
+    unsigned int hilos = 1;
+    while (true) {
+        for (int conEscritor = 0; conEscritor < 2; ++conEscritor) {
+            atomic<bool> detener{ false };
+            vector<uint64_t> busquedas(hilos, 0);
+            uint64_t escrituras = 0;
+
+            vector<thread> lectores;
+            for (unsigned int h = 0; h < hilos; ++h) {
+                lectores.emplace_back([&, h]() {
+                    int lector = registrarLector();
+                    uint32_t estado = 2463534242u + h * 7919u;
+                    Palabra resultado;
+                    uint64_t cuenta = 0;
+                    while (!detener.load(memory_order_relaxed)) {
+                        // Elegir una palabra de la muestra (xorshift).
+                        estado ^= estado << 13;
+                        estado ^= estado >> 17;
+                        estado ^= estado << 5;
+                        buscarConcurrente(lector, muestra[estado % muestra.size()].espanol, resultado);
+                        ++cuenta;
+                    }
+                    busquedas[h] = cuenta;
+                    liberarLector(lector);
+                });
+            }
+
+            thread escritor;
+            if (conEscritor) {
+                escritor = thread([&]() {
+                    size_t siguiente = 0;
+                    while (!detener.load(memory_order_relaxed)) {
+                        const Palabra& p = muestra[siguiente];
+                        siguiente = (siguiente + 1) % muestra.size();
+                        eliminarConcurrente(p.espanol);
+                        agregarConcurrente(p);
+                        escrituras += 2;
+                    }
+                });
+            }
+
+            auto inicio = chrono::steady_clock::now();
+            this_thread::sleep_for(chrono::seconds(1));
+            detener.store(true);
+            for (thread& lector : lectores) lector.join();
+            if (escritor.joinable()) escritor.join();
+            double segundos = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+
+            uint64_t total = 0;
+            for (uint64_t cuenta : busquedas) total += cuenta;
+            cout << hilos << " | " << (conEscritor ? "si" : "no") << " | "
+                << static_cast<uint64_t>(total / segundos) << " | "
+                << static_cast<uint64_t>(total / segundos / hilos) << " | "
+                << static_cast<uint64_t>(escrituras / segundos) << "\n";
+        }
+        if (hilos >= nucleos) break;
+        hilos = min(hilos * 2, nucleos);
+    }
+
+    raiz = desactivarLecturaConcurrente();
+}
+
+
+
+// Funcin para comparar el rendimiento de `buscarLote` con el de `buscar`.
+//
+// Parmetros:
+// - raiz: ndice del nodo raz del rbol.
+//
+// Proceso:
+// 1. Arma hasta un milln de consultas con palabras del diccionario en orden aleatorio;
+//    una de cada cuatro se modifica para que no se encuentre.
+// 2. Mide el tiempo de resolverlas una por una con `buscar`.
+// 3. Mide el tiempo de resolverlas con `buscarLote` en lotes de 16, 256, 4096 y 65536 palabras,
+//    y verifica que los resultados coincidan con los de `buscar`.
+// 4. Muestra los nanosegundos por palabra, las bsquedas por segundo y la mejora de cada lote.
+
+void medirBusquedaPorLotes(uint32_t raiz) {
+    if (!raiz) {
+        cout << "El diccionario esta vacio.\n";
+        return;
+    }
+
+    // Armar las consultas en orden aleatorio (xorshift).
+    vector<uint32_t> nodos;
+    recorrerInorden(raiz, nodos);
+    size_t paso = nodos.size() / 1000000 + 1;
+    vector<string> consultas;
+    for (size_t i = 0; i < nodos.size(); i += paso) {
+        consultas.emplace_back(cadenaDe(palabraDe(nodos[i]).espanol));
+        if (consultas.size() % 4 == 0) consultas.back() += '#';
+    }
+    uint32_t estado = 2463534242u;
+    for (size_t i = consultas.size() - 1; i > 0; --i) {
+        estado ^= estado << 13;
+        estado ^= estado >> 17;
+        estado ^= estado << 5;
+        swap(consultas[i], consultas[estado % (i + 1)]);
+    }
+
+    // Bsqueda una por una.
+    vector<uint32_t> esperados(consultas.size());
+    auto inicio = chrono::steady_clock::now();
+    for (size_t i = 0; i < consultas.size(); ++i) {
+        esperados[i] = buscar(raiz, consultas[i]);
+    }
+    double base = chrono::duration<double, nano>(chrono::steady_clock::now() - inicio).count() / consultas.size();
+
+    cout << "\n--- BUSQUEDA POR LOTES (" << nodos.size() << " palabras, " << consultas.size() << " consultas) ---\n";
+    cout << "Metodo | ns/palabra | Busquedas/s | Mejora\n";
+    cout << "buscar | " << base << " | " << static_cast<uint64_t>(1e9 / base) << " | 1x\n";
+
+    // Bsqueda por lotes de distintos tamaos.
+    const size_t tamanosLote[] = { 16, 256, 4096, 65536 };
+    vector<uint32_t> resultados(consultas.size());
+    for (size_t tamanoLote : tamanosLote) {
+        inicio = chrono::steady_clock::now();
+        for (size_t desde = 0; desde < consultas.size(); desde += tamanoLote) {
+            size_t cantidad = min(tamanoLote, consultas.size() - desde);
+            buscarLote(raiz, consultas.data() + desde, cantidad, resultados.data() + desde);
+        }
+        double porPalabra = chrono::duration<double, nano>(chrono::steady_clock::now() - inicio).count() / consultas.size();
+
+        cout << "buscarLote(" << tamanoLote << ") | " << porPalabra << " | " << static_cast<uint64_t>(1e9 / porPalabra)
+            << " | " << base / porPalabra << "x" << (resultados == esperados ? "" : " (RESULTADOS DISTINTOS)") << "\n";
+    }
+}
+
+
+
+
+// Funcin para comparar la lectura del archivo de palabras por bloques con la lectura lnea por lnea.
+//
+// Proceso:
+// 1. Lee `palabras.umg` como se haca antes: `getline` por lnea, un `stringstream` por lnea y una
+//    copia de cada campo en un objeto `Palabra`.
+// 2. Lee el mismo archivo con `separarArchivoPalabras` (bloques grandes, bsqueda con SSE2 y vistas
+//    sin copias).
+// 3. Repite cada lectura tres veces y muestra la mejor en megabytes por segundo, junto con la mejora.
+//
+// Notas:
+// - Ambas mediciones incluyen la lectura del disco; despus de la primera vuelta el archivo suele
+//   estar en la cach del sistema, por lo que se compara sobre todo el costo de separar los campos.
+
+void medirLecturaArchivo() {
+    const string& ruta = registroCambios.rutaBase;
+    error_code error;
+    uintmax_t bytes = fs::file_size(ruta, error);
+    if (error) {
+        cerr << "Error al abrir el archivo: " << ruta << endl;
+        return;
+    }
+    double megabytes = bytes / (1024.0 * 1024.0);
+
+    double mejorLineas = 0, mejorBloques = 0;
+    size_t palabrasLineas = 0, palabrasBloques = 0;
+    for (int vuelta = 0; vuelta < 3; ++vuelta) {
+        // Lectura lnea por lnea.
+        auto inicio = chrono::steady_clock::now();
+        {
+            ifstream archivo(ruta);
+            vector<Palabra> palabras;
+            string linea;
+            while (getline(archivo, linea)) {
+                stringstream ss(linea);
+                Palabra p;
+                if (getline(ss, p.espanol, ',') && getline(ss, p.ingles, ',') && getline(ss, p.aleman, ',') &&
+                    getline(ss, p.frances, ',') && getline(ss, p.italiano, ',')) {
+                    palabras.push_back(move(p));
+                }
+            }
+            palabrasLineas = palabras.size();
+        }
+        double segundos = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+        mejorLineas = max(mejorLineas, megabytes / segundos);
+
+        // Lectura por bloques.
+        inicio = chrono::steady_clock::now();
+        {
+            ArchivoPalabras archivo;
+            separarArchivoPalabras(ruta, archivo, palabrasBloques);
+        }
+        segundos = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+        mejorBloques = max(mejorBloques, megabytes / segundos);
+    }
+
+    cout << "\n--- LECTURA DE " << ruta << " (" << megabytes << " MB) ---\n";
+    cout << "Metodo | Palabras | MB/s | Mejora\n";
+    cout << "getline | " << palabrasLineas << " | " << mejorLineas << " | 1x\n";
+    cout << "bloques | " << palabrasBloques << " | " << mejorBloques << " | " << mejorBloques / mejorLineas << "x\n";
+}
+
+
+
+// Funcin para medir la traduccin de textos con el autmata de Aho-Corasick.
+//
+// Parmetros:
+// - raiz: ndice de la raz del rbol AVL.
+//
+// Proceso:
+// 1. Arma un texto de unos 16 MB con palabras del diccionario elegidas al azar (xorshift), palabras
+//    desconocidas y signos de puntuacin.
+// 2. Mide la construccin del autmata (`construirAutomata`).
+// 3. Mide la traduccin del texto al ingls con `traducirTexto` (una sola pasada) y la compara con
+//    separar el texto en palabras y buscar cada una en el rbol AVL.
+//
+// Notas:
+// - La bsqueda palabra por palabra no encuentra las frases de varias palabras; se muestra solo
+//   como referencia de velocidad.
+
+void medirTraduccionTexto(uint32_t raiz) {
+    if (!raiz) {
+        cout << "El diccionario esta vacio.\n";
+        return;
+    }
+
+    // Armar el texto.
+    vector<uint32_t> nodos;
+    recorrerInorden(raiz, nodos);
+    string texto;
+    uint32_t estado = 2463534242u;
+    while (texto.size() < (16u << 20)) {
+        estado ^= estado << 13;
+        estado ^= estado >> 17;
+        estado ^= estado << 5;
+        if (estado % 8 == 0) texto += "xyzzy";
+        else texto += cadenaDe(palabraDe(nodos[estado % nodos.size()]).espanol);
+        texto += (estado % 16 == 1) ? ". " : " ";
+    }
+    double megabytes = texto.size() / (1024.0 * 1024.0);
+
+    auto inicio = chrono::steady_clock::now();
+    construirAutomata(raiz, automataFrases);
+    double construccion = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+
+    size_t traducidas = 0;
+    cargarColumna(IDIOMA_INGLES);
+    inicio = chrono::steady_clock::now();
+    string traducido = traducirTexto(raiz, texto, IDIOMA_INGLES, traducidas);
+    double segundosAutomata = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+
+    // Referencia: separar por palabras y buscar cada una en el rbol.
+    size_t encontradas = 0;
+    string palabra;
+    inicio = chrono::steady_clock::now();
+    for (size_t i = 0; i < texto.size();) {
+        size_t fin = i;
+        while (fin < texto.size() && esLetraTexto(static_cast<unsigned char>(texto[fin]))) ++fin;
+        palabra.assign(texto, i, fin - i);
+        if (fin > i && buscar(raiz, palabra)) ++encontradas;
+        i = fin + 1;
+    }
+    double segundosPalabras = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+
+    cout << "\n--- TRADUCCION DE TEXTO (" << megabytes << " MB, " << automataFrases.entradas.size() << " estados) ---\n";
+    cout << "Construccion del automata: " << construccion << " s\n";
+    cout << "Metodo | Coincidencias | MB/s\n";
+    cout << "automata | " << traducidas << " | " << megabytes / segundosAutomata << "\n";
+    cout << "palabra por palabra | " << encontradas << " | " << megabytes / segundosPalabras << "\n";
+}
+
+
+
+// Funcin para comparar el ndice ponderado con el rbol AVL y el ndice congelado sobre el historial
+// de bsquedas del usuario.
+//
+// Parmetros:
+// - raiz: ndice de la raz del rbol AVL.
+// - ranking: Palabras buscadas por el usuario y cuntas veces (ver `leerRanking`).
+//
+// Proceso:
+// 1. Construye un ndice ponderado y un ndice congelado propios (no toca los del men) y mide la
+//    construccin del ponderado.
+// 2. Para cada palabra del historial cuenta las palabras comparadas en cada estructura y calcula el
+//    promedio pesado por la cantidad de bsquedas, es decir, por bsqueda del historial.
+// 3. Repite el historial en orden aleatorio (xorshift) hasta un milln de bsquedas y mide los
+//    nanosegundos por bsqueda de cada estructura.
+//
+// Notas:
+// - El ndice congelado baja siempre hasta una hoja, por lo que compara unas log2(n) palabras
+//   aunque la palabra sea frecuente.
+
+void medirIndicePonderado(uint32_t raiz, const vector<pair<string, int>>& ranking) {
+    if (!raiz || ranking.empty()) {
+        cout << "No hay diccionario o historial de busquedas para medir.\n";
+        return;
+    }
+
+    auto inicio = chrono::steady_clock::now();
+    IndicePonderado ponderado;
+    construirIndicePonderado(raiz, ranking, ponderado);
+    double construccion = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+    IndiceCongelado congelado;
+    congelarIndice(raiz, congelado);
+    size_t n = congelado.cargas.size() - 1;
+
+    // Comparaciones por bsqueda del historial.
+    uint64_t busquedas = 0, enArbol = 0, enCongelado = 0, enPonderado = 0;
+    bool coinciden = true;
+    for (const auto& par : ranking) {
+        const string& palabra = par.first;
+        uint64_t prefijo = prefijoClave(palabra);
+
+        size_t pasosArbol = 0;
+        uint32_t nodo = raiz;
+        while (nodo) {
+            ++pasosArbol;
+            int comparacion = compararClave(palabra, prefijo, nodo);
+            if (comparacion == 0) break;
+            nodo = comparacion < 0 ? nodoEn(nodo).izquierda : nodoEn(nodo).derecha;
+        }
+
+        size_t pasosCongelado = 0;
+        for (size_t k = 1; k <= n; ++pasosCongelado) {
+            size_t derecha = congelado.prefijos[k] < prefijo;
+            if (congelado.prefijos[k] == prefijo) {
+                derecha = string_view(congelado.texto.data() + congelado.inicioClave[k], congelado.largoClave[k]) < palabra;
+            }
+            k = 2 * k + derecha;
+        }
+
+        size_t pasosPonderado = 0;
+        const PalabraInterna* encontrada = buscarPonderado(ponderado, palabra, &pasosPonderado);
+        if (encontrada != buscarCongelado(congelado, palabra) || (encontrada != nullptr) != (nodo != 0)) coinciden = false;
+
+        busquedas += par.second;
+        enArbol += pasosArbol * par.second;
+        enCongelado += pasosCongelado * par.second;
+        enPonderado += pasosPonderado * par.second;
+    }
+
+    // Repetir el historial en orden aleatorio.
+    vector<const string*> consultas;
+    while (consultas.size() < 1000000) {
+        for (const auto& par : ranking) {
+            for (int i = 0; i < par.second; ++i) consultas.push_back(&par.first);
+        }
+    }
+    uint32_t estado = 2463534242u;
+    for (size_t i = consultas.size() - 1; i > 0; --i) {
+        estado ^= estado << 13;
+        estado ^= estado >> 17;
+        estado ^= estado << 5;
+        swap(consultas[i], consultas[estado % (i + 1)]);
+    }
+
+    size_t encontradas[3] = { 0, 0, 0 };
+    double nanos[3];
+    for (int estructura = 0; estructura < 3; ++estructura) {
+        inicio = chrono::steady_clock::now();
+        for (const string* palabra : consultas) {
+            if (estructura == 0) encontradas[0] += buscar(raiz, *palabra) != 0;
+            else if (estructura == 1) encontradas[1] += buscarCongelado(congelado, *palabra) != nullptr;
+            else encontradas[2] += buscarPonderado(ponderado, *palabra) != nullptr;
+        }
+        nanos[estructura] = chrono::duration<double, nano>(chrono::steady_clock::now() - inicio).count() / consultas.size();
+    }
+    if (encontradas[0] != encontradas[1] || encontradas[0] != encontradas[2]) coinciden = false;
+
+    cout << "\n--- INDICE PONDERADO (" << n << " palabras, " << busquedas << " busquedas de " << ranking.size() << " palabras distintas) ---\n";
+    cout << "Construccion del indice ponderado: " << construccion << " s\n";
+    cout << "Estructura | Comparaciones por busqueda | ns/busqueda\n";
+    cout << "arbol AVL | " << static_cast<double>(enArbol) / busquedas << " | " << nanos[0] << "\n";
+    cout << "indice congelado | " << static_cast<double>(enCongelado) / busquedas << " | " << nanos[1] << "\n";
+    cout << "indice ponderado | " << static_cast<double>(enPonderado) / busquedas << " | " << nanos[2] << "\n";
+    if (!coinciden) cout << "(RESULTADOS DISTINTOS)\n";
+}
+
+
+
+// Funcin para medir el filtro de Bloom con una cantidad de bits por palabra.
+//
+// Parmetros:
+// - raiz: ndice de la raz del rbol AVL.
+// - bitsPorClave: Bits por palabra con los que se reconstruye el filtro (ver `configurarFiltro`).
+//
+// Proceso:
+// 1. Reconstruye el filtro global con `configurarFiltro`; el valor queda configurado.
+// 2. Arma hasta un milln de palabras que no existen (palabras del diccionario con un carcter
+//    agregado) y cuenta cuntas deja pasar el filtro (falsos positivos).
+// 3. Mide los nanosegundos por bsqueda fallida con `buscar`, con el filtro y sin l.
+// 4. Verifica que el filtro deje pasar todas las palabras del diccionario.
+
+void medirFiltroBloom(uint32_t raiz, uint32_t bitsPorClave) {
+    if (!raiz) {
+        cout << "El diccionario esta vacio.\n";
+        return;
+    }
+
+    configurarFiltro(bitsPorClave);
+    const FiltroBloom& filtro = filtroBloom;
+
+    vector<uint32_t> nodos;
+    recorrerInorden(raiz, nodos);
+    size_t paso = nodos.size() / 1000000 + 1;
+    vector<string> ausentes;
+    size_t perdidas = 0;
+    for (size_t i = 0; i < nodos.size(); ++i) {
+        string_view palabra = cadenaDe(palabraDe(nodos[i]).espanol);
+        if (!puedeExistir(palabra)) ++perdidas;
+        if (i % paso == 0) ausentes.emplace_back(string(palabra) + '#');
+    }
+
+    size_t falsosPositivos = 0;
+    for (const string& palabra : ausentes) {
+        if (puedeExistir(palabra)) ++falsosPositivos;
+    }
+
+    // Bsquedas fallidas con el filtro y, sacndolo un momento, sin l.
+    double nanos[2];
+    size_t encontradas = 0;
+    for (int conFiltro = 1; conFiltro >= 0; --conFiltro) {
+        vector<uint64_t> bloques;
+        if (!conFiltro) bloques.swap(filtroBloom.bloques);
+        auto inicio = chrono::steady_clock::now();
+        for (const string& palabra : ausentes) {
+            encontradas += buscar(raiz, palabra) != 0;
+        }
+        nanos[conFiltro] = chrono::duration<double, nano>(chrono::steady_clock::now() - inicio).count() / ausentes.size();
+        if (!conFiltro) bloques.swap(filtroBloom.bloques);
+    }
+
+    // Tasa de un filtro clsico (sin bloques) con los mismos bits por palabra que ocupa este.
+    double bitsReales = filtro.bloques.size() * 64.0 / nodos.size();
+    double teorica = pow(1 - exp(-static_cast<double>(filtro.funciones) / bitsReales), filtro.funciones);
+    cout << "\n--- FILTRO DE BLOOM (" << nodos.size() << " palabras, " << filtro.bitsPorClave << " bits por palabra, "
+        << filtro.funciones << " bits marcados) ---\n";
+    cout << "Memoria: " << filtro.bloques.size() * sizeof(uint64_t) / 1024 << " KB para " << filtro.capacidad << " palabras\n";
+    cout << "Falsos positivos: " << 100.0 * falsosPositivos / ausentes.size() << " % (filtro clasico con "
+        << bitsReales << " bits por palabra: " << 100.0 * teorica << " %)\n";
+    cout << "Busqueda fallida con filtro: " << nanos[1] << " ns | sin filtro: " << nanos[0] << " ns\n";
+    if (perdidas || encontradas) cout << "(EL FILTRO DESCARTO PALABRAS EXISTENTES)\n";
+}
+
+
+
+// Funcin para validar el rbol AVL y mostrar su forma y los contadores de la instrumentacin.
+//
+// Parmetros:
+// - raiz: ndice de la raz del rbol AVL.
+//
+// Proceso:
+// 1. Verifica las invariantes con `validarArbol` y muestra la cantidad de palabras, la altura (junto con la
+//    mnima posible y el mximo terico de un AVL, 1.44 log2(n + 2)) y la profundidad promedio.
+// 2. Si el programa se compil con INSTRUMENTAR_AVL=1, muestra los contadores de `contadoresAVL`:
+//    comparaciones promedio y mximas por bsqueda, comparaciones por insercin y eliminacin, y rotaciones.
+
+void mostrarValidacionArbol(uint32_t raiz) {
+    ResumenArbol resumen;
+    bool valido = validarArbol(raiz, resumen);
+    double n = static_cast<double>(resumen.nodos);
+
+    cout << "\n--- VALIDACION DEL ARBOL AVL ---\n";
+    cout << "Palabras: " << resumen.nodos << " | Nodos vivos en el pool: " << poolNodos.vivos << "\n";
+    cout << "Altura: " << resumen.altura << " (minima posible: " << ceil(log2(n + 1)) << ", maximo AVL: "
+        << floor(1.44 * log2(n + 2)) << ")\n";
+    if (resumen.nodos) {
+        cout << "Profundidad promedio: " << resumen.sumaProfundidades / n << "\n";
+    }
+    if (valido) {
+        cout << "Invariantes correctas (orden, prefijos, balance, altura y tamano).\n";
+    }
+    else {
+        cout << "ERRORES: " << resumen.errores << " (primero: " << resumen.primerError << ")\n";
+    }
+
+#if INSTRUMENTAR_AVL
+    const ContadoresAVL& c = contadoresAVL;
+    uint64_t buscadas = c.busquedas - c.descartadasPorFiltro;
+    cout << "Busquedas: " << c.busquedas << " (descartadas por el filtro: " << c.descartadasPorFiltro << ")\n";
+    if (buscadas) {
+        cout << "Comparaciones por busqueda: " << static_cast<double>(c.comparacionesBusqueda) / buscadas
+            << " (maximo: " << c.profundidadMaximaBusqueda << ")\n";
+    }
+    if (c.inserciones + c.repetidas) {
+        cout << "Inserciones: " << c.inserciones << " (repetidas: " << c.repetidas << ") | Comparaciones por insercion: "
+            << static_cast<double>(c.comparacionesInsercion) / (c.inserciones + c.repetidas) << "\n";
+    }
+    if (c.eliminaciones + c.noEncontradas) {
+        cout << "Eliminaciones: " << c.eliminaciones << " (no encontradas: " << c.noEncontradas << ") | Comparaciones por eliminacion: "
+            << static_cast<double>(c.comparacionesEliminacion) / (c.eliminaciones + c.noEncontradas) << "\n";
+    }
+    cout << "Rotaciones: " << c.rotacionesDerecha << " a la derecha, " << c.rotacionesIzquierda << " a la izquierda\n";
+#else
+    cout << "Contadores desactivados (compilar con INSTRUMENTAR_AVL=1 para activarlos).\n";
+#endif
+}
+
+
+
+
+// Funcin para comparar el trie compacto con el rbol AVL y con el ndice congelado.
+//
+// Parmetros:
+// - raiz: ndice del nodo raz del rbol.
+//
+// Proceso:
+// 1. Construye el trie (`construirTrie`) y un ndice congelado temporal, y muestra la memoria por palabra
+//    de cada estructura.
+// 2. Arma hasta un milln de consultas en orden aleatorio (una de cada cuatro no existe) y mide los
+//    nanosegundos por bsqueda con `buscar`, `buscarCongelado` y `buscarEnTrie`, verificando que las tres
+//    encuentren lo mismo.
+// 3. Compara `intervaloPrefijo` con `intervaloPrefijoTrie` sobre los prefijos de 3 caracteres de las consultas.
+//
+// Notas:
+// - La memoria del rbol cuenta sus nodos y el texto de las claves en el pool de cadenas; la del trie
+//   no cuenta `entradas` (4 bytes por palabra), que se muestra aparte.
+// - `buscar` consulta antes el filtro de Bloom, por lo que sus bsquedas fallidas suelen ser ms baratas.
+
+void medirTrieCompacto(uint32_t raiz) {
+    if (!raiz) {
+        cout << "El diccionario esta vacio.\n";
+        return;
+    }
+
+    // 1. Construir las estructuras y medir su memoria.
+    TrieCompacto trie;
+    auto inicio = chrono::steady_clock::now();
+    construirTrie(raiz, trie);
+    double segundosTrie = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+    IndiceCongelado indice;
+    congelarIndice(raiz, indice);
+
+    vector<uint32_t> nodos;
+    recorrerInorden(raiz, nodos);
+    size_t n = nodos.size();
+    size_t memoriaArbol = n * sizeof(Nodo);
+    for (uint32_t nodo : nodos) {
+        size_t largo = cadenaDe(palabraDe(nodo).espanol).size();
+        memoriaArbol += largo + (largo < 0xFF ? 1 : 5);
+    }
+    size_t memoriaCongelado = indice.prefijos.capacity() * sizeof(uint64_t) + indice.texto.capacity()
+        + (indice.inicioClave.capacity() + indice.largoClave.capacity() + indice.cargas.capacity() + indice.inicioAlfabetico.capacity()) * sizeof(uint32_t)
+        + indice.comunConAnterior.capacity() + indice.minimoComunPorBloque.capacity() + indice.minimoComunPorGrupo.capacity();
+
+    // 2. Consultas en orden aleatorio (xorshift).
+    size_t paso = n / 1000000 + 1;
+    vector<string> consultas;
+    for (size_t i = 0; i < n; i += paso) {
+        consultas.emplace_back(cadenaDe(palabraDe(nodos[i]).espanol));
+        if (consultas.size() % 4 == 0) consultas.back() += '#';
+    }
+    uint32_t estado = 2463534242u;
+    for (size_t i = consultas.size() - 1; i > 0; --i) {
+        estado ^= estado << 13;
+        estado ^= estado >> 17;
+        estado ^= estado << 5;
+        swap(consultas[i], consultas[estado % (i + 1)]);
+    }
+
+    vector<const PalabraInterna*> esperados(consultas.size()), resultados(consultas.size());
+    inicio = chrono::steady_clock::now();
+    for (size_t i = 0; i < consultas.size(); ++i) {
+        uint32_t nodo = buscar(raiz, consultas[i]);
+        esperados[i] = nodo ? &palabraDe(nodo) : nullptr;
+    }
+    double nanosArbol = chrono::duration<double, nano>(chrono::steady_clock::now() - inicio).count() / consultas.size();
+
+    inicio = chrono::steady_clock::now();
+    for (size_t i = 0; i < consultas.size(); ++i) {
+        resultados[i] = buscarCongelado(indice, consultas[i]);
+    }
+    double nanosCongelado = chrono::duration<double, nano>(chrono::steady_clock::now() - inicio).count() / consultas.size();
+    bool coincideCongelado = resultados == esperados;
+
+    inicio = chrono::steady_clock::now();
+    for (size_t i = 0; i < consultas.size(); ++i) {
+        resultados[i] = buscarEnTrie(trie, consultas[i]);
+    }
+    double nanosTrie = chrono::duration<double, nano>(chrono::steady_clock::now() - inicio).count() / consultas.size();
+    bool coincideTrie = resultados == esperados;
+
+    cout << "\n--- TRIE COMPACTO (" << n << " palabras, " << trie.nodos << " nodos, construido en " << segundosTrie << " s) ---\n";
+    cout << "Estructura | Bytes por palabra | ns por busqueda\n";
+    cout << "Arbol AVL (nodos y claves) | " << static_cast<double>(memoriaArbol) / n << " | " << nanosArbol << "\n";
+    cout << "Indice congelado | " << static_cast<double>(memoriaCongelado) / n << " | " << nanosCongelado
+        << (coincideCongelado ? "" : " (RESULTADOS DISTINTOS)") << "\n";
+    cout << "Trie compacto | " << static_cast<double>(memoriaTrie(trie)) / n << " (+" << sizeof(uint32_t) << " de entradas) | "
+        << nanosTrie << (coincideTrie ? "" : " (RESULTADOS DISTINTOS)") << "\n";
+
+    // 3. Intervalos de prefijo.
+    vector<pair<size_t, size_t>> esperadosPrefijo(consultas.size()), resultadosPrefijo(consultas.size());
+    inicio = chrono::steady_clock::now();
+    for (size_t i = 0; i < consultas.size(); ++i) {
+        esperadosPrefijo[i] = intervaloPrefijo(raiz, string_view(consultas[i]).substr(0, 3));
+    }
+    double nanosPrefijoArbol = chrono::duration<double, nano>(chrono::steady_clock::now() - inicio).count() / consultas.size();
+    inicio = chrono::steady_clock::now();
+    for (size_t i = 0; i < consultas.size(); ++i) {
+        resultadosPrefijo[i] = intervaloPrefijoTrie(trie, string_view(consultas[i]).substr(0, 3));
+    }
+    double nanosPrefijoTrie = chrono::duration<double, nano>(chrono::steady_clock::now() - inicio).count() / consultas.size();
+    bool coincidePrefijo = true;
+    for (size_t i = 0; i < consultas.size(); ++i) {
+        // Un intervalo vaco puede comenzar en cualquier posicin.
+        bool vacioArbol = esperadosPrefijo[i].first == esperadosPrefijo[i].second;
+        bool vacioTrie = resultadosPrefijo[i].first == resultadosPrefijo[i].second;
+        if (vacioArbol != vacioTrie || (!vacioArbol && esperadosPrefijo[i] != resultadosPrefijo[i])) coincidePrefijo = false;
+    }
+    cout << "Intervalo de un prefijo de 3 caracteres: arbol " << nanosPrefijoArbol << " ns, trie " << nanosPrefijoTrie << " ns"
+        << (coincidePrefijo ? "" : " (RESULTADOS DISTINTOS)") << "\n";
+}
+
+
+
+
+//==========================FUNCIONES DEL BENCHMARK==========================
+
+
+
+// Estructura con el resultado de una medicin del benchmark (una fila del archivo de resultados).
+//
+// Campos:
+// - motor: Motor del diccionario medido (ver `MotorDiccionario`).
+// - operacion: Funcin medida.
+// - orden: Orden de las palabras: "uniforme" (al azar), "zipf" (pocas palabras concentran casi todas
+//   las bsquedas) u "ordenado" (orden alfabtico).
+// - palabras: Cantidad de palabras del diccionario.
+// - operaciones: Cantidad de operaciones medidas (en las cargas y escrituras de archivo, las palabras).
+// - nsPorOperacion: Duracin promedio de una operacin.
+// - p50, p90, p99, p999, maximo: Percentiles y mximo de la duracin de cada operacin, en nanosegundos.
+//   Son 0 en las operaciones que se miden de una sola vez (la carga y la escritura del archivo).
+// - rotaciones: Rotaciones del rbol AVL durante la medicin (ver `rotacionesContadas`); 0 con la tabla hash
+//   o si el programa no se compil con INSTRUMENTAR_AVL=1.
+// - memoriaPicoKB: Memoria mxima usada por el proceso hasta el final de la medicin.
+
+struct ResultadoBenchmark {
+    string motor;
+    string operacion;
+    string orden;
+    size_t palabras;
+    size_t operaciones;
+    double nsPorOperacion;
+    uint64_t p50;
+    uint64_t p90;
+    uint64_t p99;
+    uint64_t p999;
+    uint64_t maximo;
+    uint64_t rotaciones;
+    uint64_t memoriaPicoKB;
+};
+
+
+
+// Funcin para generar la palabra nmero i de un diccionario sinttico.
+//
+// Parmetros:
+// - i: Nmero de la palabra.
+//
+// Retorno:
+// - Seis letras pseudoaleatorias, para que el orden alfabtico no siga al nmero, seguidas del nmero
+//   escrito en base 26. Como el nmero se escribe completo, dos nmeros distintos nunca dan la misma palabra.
+
+string claveBenchmark(uint64_t i) {
+    uint64_t mezcla = (i + 1) * 0x9E3779B97F4A7C15ull;
+    mezcla ^= mezcla >> 29;
+    string clave;
+    for (int j = 0; j < 6; ++j) {
+        clave += static_cast<char>('a' + mezcla % 26);
+        mezcla /= 26;
+    }
+    do {
+        clave += static_cast<char>('a' + i % 26);
+        i /= 26;
+    } while (i);
+    return clave;
+}
+
+
+
+// Funcin para obtener la memoria mxima que us el proceso hasta ahora.
+//
+// Retorno:
+// - El mximo del conjunto de trabajo (PeakWorkingSetSize) en KB, o 0 si no se pudo consultar.
+
+uint64_t memoriaPicoKB() {
+    PROCESS_MEMORY_COUNTERS contadores = {};
+    contadores.cb = sizeof(contadores);
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &contadores, sizeof(contadores))) return 0;
+    return contadores.PeakWorkingSetSize / 1024;
+}
+
+
+
+// Funcin para resumir las duraciones de una medicin del benchmark.
+//
+// Parmetros:
+// - motor, operacion, orden, palabras, operaciones: Datos de la medicin (ver `ResultadoBenchmark`).
+// - nanos: Duracin total de la medicin.
+// - duraciones: Duracin de cada operacin (se ordena); vaco si la medicin fue de una sola vez.
+// - rotaciones: Rotaciones del rbol AVL durante la medicin.
+//
+// Retorno:
+// - El resultado con el promedio, los percentiles y la memoria mxima del proceso.
+
+ResultadoBenchmark resumirBenchmark(const string& motor, const string& operacion, const string& orden, size_t palabras,
+    size_t operaciones, double nanos, vector<uint32_t>& duraciones, uint64_t rotaciones) {
+    ResultadoBenchmark resultado = { motor, operacion, orden, palabras, operaciones, operaciones ? nanos / operaciones : 0.0,
+        0, 0, 0, 0, 0, rotaciones, memoriaPicoKB() };
+    if (!duraciones.empty()) {
+        sort(duraciones.begin(), duraciones.end());
+        auto percentil = [&duraciones](double fraccion) {
+            return static_cast<uint64_t>(duraciones[min(duraciones.size() - 1, static_cast<size_t>(fraccion * duraciones.size()))]);
+        };
+        resultado.p50 = percentil(0.5);
+        resultado.p90 = percentil(0.9);
+        resultado.p99 = percentil(0.99);
+        resultado.p999 = percentil(0.999);
+        resultado.maximo = duraciones.back();
+    }
+    return resultado;
+}
+
+
+
+// Funcin para verificar que un motor se comporte como un diccionario (pruebas de conformidad).
+//
+// Parmetros:
+// - motor: Motor vaco que se desea verificar; queda vaco al terminar.
+// - error: Variable donde se describe la primera diferencia encontrada.
+//
+// Retorno:
+// - true si el motor se comport igual que un `map` en todas las operaciones, false en caso contrario.
+//
+// Proceso:
+// 1. Arma palabras de prueba: la palabra vaca, una de 300 caracteres, palabras con letras acentuadas y
+//    palabras que comparten sus primeros 8 bytes (el prefijo que compara el rbol), adems de palabras sintticas.
+// 2. Ejecuta 20000 operaciones al azar (agregar, buscar y eliminar, tambin palabras repetidas o ausentes)
+//    y compara cada resultado y cada traduccin con un `map` de referencia.
+// 3. Cada 1000 operaciones compara la cantidad y valida la estructura; al final verifica todas las palabras,
+//    vaca el motor y comprueba que no quede ninguna.
+
+bool verificarMotor(MotorDiccionario& motor, string& error) {
+    vector<string> claves = { "", string(300, 'x'), "\xF1" "and\xFA", "ping\xFCino", "\xE1rbol", "arbol" };
+    for (int i = 0; i < 50; ++i) claves.push_back("prefijocomun" + to_string(i));
+    for (uint64_t i = 0; i < 1500; ++i) claves.push_back(claveBenchmark(i));
+
+    map<string, string> esperado;
+    uint32_t estado = 2463534242u;
+    auto aleatorio = [&estado]() {
+        estado ^= estado << 13;
+        estado ^= estado >> 17;
+        estado ^= estado << 5;
+        return estado;
+    };
+    auto comprobar = [&esperado, &motor, &error](const string& clave) {
+        const PalabraInterna* p = motor.buscar(clave);
+        auto encontrada = esperado.find(clave);
+        if ((p != nullptr) != (encontrada != esperado.end())) {
+            error = "buscar(\"" + clave.substr(0, 20) + "\") " + (p ? "encontro una palabra eliminada" : "no encontro una palabra agregada");
+            return false;
+        }
+        if (p && (cadenaDe(p->espanol) != clave || cadenaDe(p->ingles) != encontrada->second)) {
+            error = "buscar(\"" + clave.substr(0, 20) + "\") devolvio otra palabra o traduccion";
+            return false;
+        }
+        return true;
+    };
+
+    for (int paso = 1; paso <= 20000; ++paso) {
+        const string& clave = claves[aleatorio() % claves.size()];
+        uint32_t operacion = aleatorio() % 10;
+        if (operacion < 5) {
+            string traduccion = "t" + to_string(paso);
+            bool nueva = !esperado.count(clave);
+            if (motor.agregar(Palabra{ clave, traduccion, clave, clave, clave }) != nueva) {
+                error = "agregar(\"" + clave.substr(0, 20) + "\") no informo si la palabra ya estaba";
+                return false;
+            }
+            if (nueva) esperado[clave] = traduccion;
+        }
+        else if (operacion < 8) {
+            if (!comprobar(clave)) return false;
+        }
+        else {
+            if (motor.eliminar(clave) != (esperado.erase(clave) == 1)) {
+                error = "eliminar(\"" + clave.substr(0, 20) + "\") no informo si la palabra estaba";
+                return false;
+            }
+        }
+
+        if (paso % 1000 == 0 && (motor.cantidad() != esperado.size() || !motor.validar())) {
+            error = "cantidad o invariantes incorrectas despues de " + to_string(paso) + " operaciones";
+            return false;
+        }
+    }
+
+    for (const string& clave : claves) {
+        if (!comprobar(clave)) return false;
+    }
+    motor.vaciar();
+    esperado.clear();
+    if (motor.cantidad() != 0 || !motor.validar()) {
+        error = "el motor no quedo vacio";
+        return false;
+    }
+    for (const string& clave : claves) {
+        if (!comprobar(clave)) return false;
+    }
+    return true;
+}
+
+
+
+// Funcin para ejecutar el benchmark de las operaciones del diccionario y guardar los resultados.
+//
+// Parmetros:
+// - rutaResultados: Archivo CSV donde se escriben los resultados (una fila por medicin).
+// - maximoPalabras: Tamao mximo de los diccionarios sintticos (se prueban 1K, 10K, 100K, 1M y 10M).
+// - motores: Motor que se mide ("avl" o "hash", ver `crearMotor`) o "todos".
+//
+// Proceso:
+// 0. Verifica cada motor con `verificarMotor` antes de medirlo.
+// Para cada tamao n, con las palabras de `claveBenchmark`, y para cada motor:
+// 1. `insertar`: agrega las palabras una por una, en orden uniforme y en orden alfabtico.
+// 2. `buscar`: sobre el motor llenado en orden uniforme, busca max(n, 100K) palabras (hasta 1M)
+//    elegidas en forma uniforme, con una distribucin de Zipf (s = 1) y en orden alfabtico.
+// 3. `eliminarPalabra`: elimina la mitad de las palabras en el mismo orden en que se insertaron.
+// Y una sola vez, con el rbol (motor "avl"):
+// 4. `escribirArchivoPalabras` y `cargarPalabras`: escribe el archivo de palabras completo y lo vuelve a cargar.
+// Cada operacin individual se mide por separado para obtener los percentiles. Los resultados se muestran
+// en la consola y se escriben en `rutaResultados` junto con la fecha de compilacin, para comparar versiones.
+//
+// Notas:
+// - Trabaja en la carpeta `C:\\traductorbenchmark`, que se elimina al terminar; no toca el diccionario
+//   del usuario. Se ejecuta con `Traductor.exe --benchmark` (ver `main`), sin iniciar sesin.
+// - La insercin en orden de Zipf no tiene sentido (cada palabra se inserta una vez), por lo que ese
+//   orden solo se usa en las bsquedas.
+// - Despus de cada insercin, eliminacin y carga, valida el motor (fuera de la medicin).
+// - Las operaciones se llaman a travs de `MotorDiccionario`, por lo que todas incluyen el costo de esa llamada.
+// - Medir cada operacin agrega la lectura del reloj (unos 20 ns) a su duracin.
+// - El diccionario de 10M palabras necesita varios GB de memoria; `maximoPalabras` permite omitirlo.
+
+void ejecutarBenchmark(const string& rutaResultados, size_t maximoPalabras, const string& motores) {
+    vector<string> nombresMotores;
+    if (motores == "todos") nombresMotores = { "avl", "hash" };
+    else nombresMotores = { motores };
+    uint32_t raizMotor = 0;
+    TablaHashPalabras tablaMotor;
+    vector<MotorDiccionario> motoresBenchmark(nombresMotores.size());
+    for (size_t m = 0; m < nombresMotores.size(); ++m) {
+        if (!crearMotor(nombresMotores[m], raizMotor, tablaMotor, motoresBenchmark[m])) {
+            cerr << "Motor desconocido: " << nombresMotores[m] << " (use avl, hash o todos).\n";
+            return;
+        }
+    }
+
+    // Trabajar en una carpeta aparte.
+    const string carpeta = "C:\\traductorbenchmark";
+    const string rutaBase = registroCambios.rutaBase;
+    const string rutaCambios = registroCambios.rutaCambios;
+    const string rutaAnterior = registroCambios.rutaAnterior;
+    error_code error;
+    fs::create_directories(carpeta, error);
+    registroCambios.rutaBase = carpeta + "\\palabras.umg";
+    registroCambios.rutaCambios = carpeta + "\\cambios.umg";
+    registroCambios.rutaAnterior = carpeta + "\\cambios_anterior.umg";
+
+    vector<ResultadoBenchmark> resultados;
+    vector<uint32_t> duraciones;
+    uint32_t estado = 2463534242u;
+    auto aleatorio = [&estado]() {
+        estado ^= estado << 13;
+        estado ^= estado >> 17;
+        estado ^= estado << 5;
+        return estado;
+    };
+
+    // Medir `cantidad` operaciones una por una: una lectura del reloj por operacin.
+    auto medir = [&](const string& motor, const string& operacion, const string& orden, size_t palabras, size_t cantidad,
+        const function<void(size_t)>& ejecutar) {
+        duraciones.resize(cantidad);
+        uint64_t rotaciones = rotacionesContadas();
+        auto inicio = chrono::steady_clock::now();
+        auto anterior = inicio;
+        for (size_t i = 0; i < cantidad; ++i) {
+            ejecutar(i);
+            auto ahora = chrono::steady_clock::now();
+            duraciones[i] = static_cast<uint32_t>(chrono::duration_cast<chrono::nanoseconds>(ahora - anterior).count());
+            anterior = ahora;
+        }
+        double nanos = chrono::duration<double, nano>(anterior - inicio).count();
+        resultados.push_back(resumirBenchmark(motor, operacion, orden, palabras, cantidad, nanos, duraciones, rotacionesContadas() - rotaciones));
+    };
+
+    cout << "\n--- BENCHMARK DEL DICCIONARIO ---\n";
+    bool correcto = true;
+    for (MotorDiccionario& motor : motoresBenchmark) {
+        string error;
+        bool conforme = verificarMotor(motor, error);
+        cout << "Conformidad del motor " << motor.nombre << ": " << (conforme ? "correcta" : "ERROR: " + error) << "\n";
+        if (!conforme) correcto = false;
+        liberarPoolNodos();
+        raizMotor = 0;
+        tablaMotor = TablaHashPalabras();
+    }
+
+    cout << "Motor | Operacion | Orden | Palabras | ns/op | p50 | p99 | p99.9 | Rotaciones | Memoria pico (KB)\n";
+    size_t mostrados = 0;
+    ResumenArbol resumen;
+
+    for (size_t n = 1000; n <= maximoPalabras && n <= 10000000; n *= 10) {
+        // Palabras y rdenes (ndices dentro de `claves`).
+        vector<string> claves(n);
+        for (size_t i = 0; i < n; ++i) claves[i] = claveBenchmark(i);
+        vector<uint32_t> uniforme(n);
+        for (size_t i = 0; i < n; ++i) uniforme[i] = static_cast<uint32_t>(i);
+        for (size_t i = n - 1; i > 0; --i) swap(uniforme[i], uniforme[aleatorio() % (i + 1)]);
+        vector<uint32_t> ordenado(uniforme);
+        sort(ordenado.begin(), ordenado.end(), [&claves](uint32_t a, uint32_t b) { return claves[a] < claves[b]; });
+
+        // Bsquedas: uniformes, con Zipf (el rango r se elige con probabilidad proporcional a 1 / r y
+        // corresponde a una palabra al azar) y en orden alfabtico.
+        size_t consultas = min(max(n, static_cast<size_t>(100000)), static_cast<size_t>(1000000));
+        vector<double> acumulada(n);
+        double suma = 0;
+        for (size_t r = 0; r < n; ++r) {
+            suma += 1.0 / (r + 1);
+            acumulada[r] = suma;
+        }
+        vector<uint32_t> busquedas[3];
+        for (size_t i = 0; i < consultas; ++i) {
+            busquedas[0].push_back(aleatorio() % n);
+            size_t rango = upper_bound(acumulada.begin(), acumulada.end(), aleatorio() / 4294967296.0 * suma) - acumulada.begin();
+            busquedas[1].push_back(uniforme[min(rango, n - 1)]);
+            busquedas[2].push_back(ordenado[i % n]);
+        }
+        vector<double>().swap(acumulada);
+
+        const string ordenes[3] = { "uniforme", "zipf", "ordenado" };
+        for (MotorDiccionario& motor : motoresBenchmark) {
+            for (int o = 0; o < 3; o += 2) {
+                const vector<uint32_t>& secuencia = o == 0 ? uniforme : ordenado;
+                liberarPoolNodos();
+                raizMotor = 0;
+                tablaMotor = TablaHashPalabras();
+                medir(motor.nombre, "insertar", ordenes[o], n, n, [&](size_t i) {
+                    const string& clave = claves[secuencia[i]];
+                    motor.agregar(Palabra{ clave, clave, clave, clave, clave });
+                });
+                if (!motor.validar() || motor.cantidad() != n) correcto = false;
+
+                if (o == 0) {
+                    for (int b = 0; b < 3; ++b) {
+                        size_t encontradas = 0;
+                        medir(motor.nombre, "buscar", ordenes[b], n, consultas, [&](size_t i) {
+                            encontradas += motor.buscar(claves[busquedas[b][i]]) != nullptr;
+                        });
+                        if (encontradas != consultas) correcto = false;
+                    }
+                }
+
+                medir(motor.nombre, "eliminarPalabra", ordenes[o], n, n / 2, [&](size_t i) {
+                    motor.eliminar(claves[secuencia[i]]);
+                });
+                if (!motor.validar() || motor.cantidad() != n - n / 2) correcto = false;
+            }
+        }
+        tablaMotor = TablaHashPalabras();
+
+        // Escribir el archivo de palabras completo y volver a cargarlo.
+        vector<VistaPalabra> vistas(n);
+        for (size_t i = 0; i < n; ++i) {
+            const string& clave = claves[ordenado[i]];
+            vistas[i] = { clave, clave, clave, clave, clave };
+        }
+        vector<uint32_t> sinDuraciones;
+        auto inicio = chrono::steady_clock::now();
+        if (!escribirArchivoPalabras(registroCambios.rutaBase, vistas)) correcto = false;
+        double nanos = chrono::duration<double, nano>(chrono::steady_clock::now() - inicio).count();
+        resultados.push_back(resumirBenchmark("avl", "escribirArchivoPalabras", "ordenado", n, n, nanos, sinDuraciones, 0));
+
+        liberarPoolNodos();
+        fs::remove(registroCambios.rutaCambios, error);
+        uint64_t rotaciones = rotacionesContadas();
+        inicio = chrono::steady_clock::now();
+        uint32_t raiz = cargarPalabras();
+        nanos = chrono::duration<double, nano>(chrono::steady_clock::now() - inicio).count();
+        resultados.push_back(resumirBenchmark("avl", "cargarPalabras", "ordenado", n, n, nanos, sinDuraciones, rotacionesContadas() - rotaciones));
+        if (!validarArbol(raiz, resumen) || resumen.nodos != n) correcto = false;
+        liberarPoolNodos();
+
+        for (; mostrados < resultados.size(); ++mostrados) {
+            const ResultadoBenchmark& r = resultados[mostrados];
+            cout << r.motor << " | " << r.operacion << " | " << r.orden << " | " << r.palabras << " | " << r.nsPorOperacion << " | " << r.p50
+                << " | " << r.p99 << " | " << r.p999 << " | " << r.rotaciones << " | " << r.memoriaPicoKB << "\n";
+        }
+    }
+    if (!correcto) cout << "(RESULTADOS INCORRECTOS: un motor no paso la conformidad, no tiene las palabras esperadas o no es valido)\n";
+
+    // Guardar los resultados en CSV.
+    ofstream archivo(rutaResultados, ios::trunc);
+    if (archivo.is_open()) {
+        archivo << "compilacion,motor,operacion,orden,palabras,operaciones,ns_por_operacion,p50_ns,p90_ns,p99_ns,p999_ns,maximo_ns,rotaciones,memoria_pico_kb\n";
+        for (const ResultadoBenchmark& r : resultados) {
+            archivo << __DATE__ " " __TIME__ << ',' << r.motor << ',' << r.operacion << ',' << r.orden << ',' << r.palabras << ',' << r.operaciones
+                << ',' << r.nsPorOperacion << ',' << r.p50 << ',' << r.p90 << ',' << r.p99 << ',' << r.p999 << ',' << r.maximo
+                << ',' << r.rotaciones << ',' << r.memoriaPicoKB << '\n';
+        }
+        cout << "Resultados guardados en " << rutaResultados << "\n";
+    }
+    else {
+        cerr << "Error al abrir " << rutaResultados << " para escritura.\n";
+    }
+
+    fs::remove_all(carpeta, error);
+    registroCambios.rutaBase = rutaBase;
+    registroCambios.rutaCambios = rutaCambios;
+    registroCambios.rutaAnterior = rutaAnterior;
+}
+
+
+
+
+//==========================FUNCIONES DE COMPRESION==========================
+
+
+
+// Estructura para almacenar informacin de un archivo a comprimir.
+// Cada campo representa:
+// - rutaRelativa: Ruta del archivo relativa a la carpeta base de compresin.
+// - contenido: Vector de caracteres que contiene los datos binarios del archivo.
+//
+// Uso:
+// - Esta estructura se utiliza para recopilar y manipular los archivos que sern comprimidos
+//   y descomprimidos mediante el algoritmo de Huffman.
+
+struct ArchivoParaComprimir {
+    string rutaRelativa;      // Ruta relativa del archivo respecto a la carpeta base
+    vector<char> contenido;   // Contenido binario del archivo
+};
+
+
+
+// Funcin para leer completamente un archivo binario y devolver su contenido en un vector de caracteres.
+//
+// Parmetros:
+// - ruta: Ruta completa del archivo que se desea leer.
+//
+// Retorno:
+// - Un vector de caracteres que contiene el contenido binario del archivo.
+//   Si el archivo no se puede abrir, retorna un vector vaco.
+//
+// Notas:
+// - Esta funcin se utiliza para cargar archivos que sern comprimidos o descomprimidos.
+// - El archivo se abre en modo binario para preservar todos los datos tal como estn en disco.
+
+vector<char> leerArchivo(const string& ruta) {
+    ifstream file(ruta, ios::binary);
+    if (!file) {
+        cerr << "No se pudo abrir archivo: " << ruta << "\n";
+        return {};
+    }
+    return vector<char>((istreambuf_iterator<char>(file)), istreambuf_iterator<char>());
+}
+
+
+
+// Funcin para guardar el contenido binario en un archivo.
+//
+// Parmetros:
+// - ruta: Ruta completa del archivo donde se desea guardar el contenido.
+// - contenido: Vector de caracteres que contiene los datos binarios a guardar.
+//
+// Proceso:
+// 1. Abre el archivo en modo binario para escritura.
+// 2. Si no se puede abrir el archivo, muestra un mensaje de error y retorna.
+// 3. Escribe el contenido del vector en el archivo.
+// 4. Cierra el archivo.
+//
+// Notas:
+// - Esta funcin se utiliza para restaurar archivos durante la descompresin o para guardar archivos binarios generados.
+// - Si el archivo no se puede crear o abrir, no se realiza ninguna accin.
+
+void guardarArchivo(const string& ruta, const vector<char>& contenido) {
+    ofstream file(ruta, ios::binary);
+    if (!file) {
+        cerr << "No se pudo guardar archivo: " << ruta << "\n";
+        return;
+    }
+    file.write(contenido.data(), contenido.size());
+}
+
+
+
+// Funcin para recorrer una carpeta de forma recursiva y obtener todos los archivos que contiene,
+// almacenando su ruta relativa y su contenido binario en un vector de estructuras.
+//
+// Parmetros:
+// - carpetaBase: Ruta de la carpeta base desde donde se inicia la bsqueda de archivos.
+// - archivos: Vector de estructuras ArchivoParaComprimir donde se almacenarn los archivos encontrados.
+//
+// Proceso:
+// 1. Utiliza un iterador recursivo para recorrer todos los archivos dentro de la carpeta base y sus subcarpetas.
+// 2. Para cada archivo regular encontrado:
+//    - Obtiene la ruta completa del archivo.
+//    - Calcula la ruta relativa respecto a la carpeta base.
+//    - Lee el contenido binario del archivo usando la funcin leerArchivo.
+//    - Agrega una estructura ArchivoParaComprimir al vector con la ruta relativa y el contenido.
+//
+// Notas:
+// - Solo se procesan archivos regulares (no carpetas).
+// - Esta funcin es utilizada para preparar los archivos antes de la compresin Huffman.
+
+void obtenerArchivos(const string& carpetaBase, vector<ArchivoParaComprimir>& archivos) {
+    for (const auto& entry : fs::recursive_directory_iterator(carpetaBase)) {
+        if (fs::is_regular_file(entry.path())) {
+            string rutaCompleta = entry.path().string();
+            string rutaRelativa = fs::relative(entry.path(), carpetaBase).string();
+            vector<char> contenido = leerArchivo(rutaCompleta);
+            archivos.push_back({ rutaRelativa, contenido });
+        }
+    }
+}
+
+
+
+// Funcin para serializar un conjunto de archivos en un solo buffer binario.
+// El formato del buffer es:
+// [numArchivos][longRuta][ruta][tamContenido][contenido]...
+//
+// Parmetros:
+// - archivos: Vector de estructuras ArchivoParaComprimir que contiene la ruta relativa y el contenido de cada archivo.
+//
+// Retorno:
+// - Un vector de caracteres que representa el buffer binario serializado con todos los archivos.
+//
+// Proceso:
+// 1. Inserta el nmero total de archivos al inicio del buffer.
+// 2. Para cada archivo:
+//    - Inserta la longitud de la ruta relativa.
+//    - Inserta la ruta relativa como cadena de caracteres.
+//    - Inserta el tamao del contenido binario.
+//    - Inserta el contenido binario del archivo.
+//
+// Notas:
+// - Este buffer puede ser comprimido y almacenado, o deserializado posteriormente para reconstruir los archivos.
+// - El formato es compacto y permite reconstruir la estructura de archivos y carpetas original.
+
+vector<char> serializarArchivos(const vector<ArchivoParaComprimir>& archivos) {
+    vector<char> buffer;
+
+    int numArchivos = static_cast<int>(archivos.size());
+    buffer.insert(buffer.end(), reinterpret_cast<char*>(&numArchivos), reinterpret_cast<char*>(&numArchivos) + sizeof(int));
+
+    for (const auto& archivo : archivos) {
+        int lenRuta = static_cast<int>(archivo.rutaRelativa.size());
+        buffer.insert(buffer.end(), reinterpret_cast<char*>(&lenRuta), reinterpret_cast<char*>(&lenRuta) + sizeof(int));
+        buffer.insert(buffer.end(), archivo.rutaRelativa.begin(), archivo.rutaRelativa.end());
+
+        int tamContenido = static_cast<int>(archivo.contenido.size());
+        buffer.insert(buffer.end(), reinterpret_cast<char*>(&tamContenido), reinterpret_cast<char*>(&tamContenido) + sizeof(int));
+        buffer.insert(buffer.end(), archivo.contenido.begin(), archivo.contenido.end());
+    }
+    return buffer;
+}
+
+
+
+// Funcin para deserializar un buffer binario y reconstruir los archivos originales en una carpeta destino.
+// El buffer debe tener el formato: [numArchivos][longRuta][ruta][tamContenido][contenido]...
+//
+// Parmetros:
+// - buffer: Vector de caracteres que contiene los datos serializados de los archivos.
+// - carpetaDestino: Ruta de la carpeta donde se restaurarn los archivos y carpetas.
+//
+// Proceso:
+// 1. Lee el nmero total de archivos almacenados en el buffer.
+// 2. Para cada archivo:
+//    - Lee la longitud de la ruta relativa y la ruta relativa.
+//    - Lee el tamao del contenido y el contenido binario.
+//    - Crea las carpetas necesarias en la ruta destino.
+//    - Guarda el contenido en la ruta correspondiente usando la funcin guardarArchivo.
+//
+// Notas:
+// - Si el buffer est corrupto o incompleto, lanza una excepcin.
+// - Esta funcin se utiliza durante la descompresin para restaurar la estructura original de archivos y carpetas.
+
+void deserializarYReconstruir(const vector<char>& buffer, const string& carpetaDestino) {
+    size_t pos = 0;
+
+    auto leerInt = [&](int& val) {
+        if (pos + sizeof(int) > buffer.size()) throw runtime_error("Buffer corrupto");
+        val = *reinterpret_cast<const int*>(&buffer[pos]);
+        pos += sizeof(int);
+        };
+
+    int numArchivos = 0;
+    leerInt(numArchivos);
+
+    for (int i = 0; i < numArchivos; i++) {
+        int lenRuta = 0;
+        leerInt(lenRuta);
+
+        if (pos + lenRuta > buffer.size()) throw runtime_error("Buffer corrupto");
+        string ruta(buffer.begin() + pos, buffer.begin() + pos + lenRuta);
+        pos += lenRuta;
+
+        int tamContenido = 0;
+        leerInt(tamContenido);
+
+        if (pos + tamContenido > buffer.size()) throw runtime_error("Buffer corrupto");
+        vector<char> contenido(buffer.begin() + pos, buffer.begin() + pos + tamContenido);
+        pos += tamContenido;
+
+        // Crear carpetas necesarias
+        fs::path rutaCompleta = fs::path(carpetaDestino) / ruta;
+        fs::create_directories(rutaCompleta.parent_path());
+
+        // Guardar archivo
+        guardarArchivo(rutaCompleta.string(), contenido);
+    }
+}
+
+
+
+// Estructura para representar un nodo del rbol de Huffman utilizado en la compresin de archivos.
+// Cada nodo puede ser una hoja (carcter y frecuencia) o un nodo interno (suma de frecuencias).
+//
+// Campos:
+// - c: Carcter representado por el nodo (solo vlido en hojas; '\0' en nodos internos).
+// - freq: Frecuencia total de aparicin del carcter o suma de frecuencias de los hijos.
+// - izq: Puntero al hijo izquierdo del nodo Huffman.
+// - der: Puntero al hijo derecho del nodo Huffman.
+//
+// Constructores:
+// - NodoHuffman(char c, int freq): Crea una hoja con un carcter y su frecuencia.
+// - NodoHuffman(NodoHuffman* izq, NodoHuffman* der): Crea un nodo interno a partir de dos hijos.
+//
+// Uso:
+// - Esta estructura se utiliza para construir el rbol de Huffman necesario para la codificacin y decodificacin de datos binarios.
+
+struct NodoHuffman {
+    char c;                // Carcter (solo vlido en hojas)
+    int freq;              // Frecuencia del carcter o suma de frecuencias
+    NodoHuffman* izq;      // Puntero al hijo izquierdo
+    NodoHuffman* der;      // Puntero al hijo derecho
+
+    NodoHuffman(char c, int freq) : c(c), freq(freq), izq(nullptr), der(nullptr) {}
+    NodoHuffman(NodoHuffman* izq, NodoHuffman* der)
+        : c('\0'), freq(izq->freq + der->freq), izq(izq), der(der) {
+    }
+};
+
+
+
+// Estructura comparadora para nodos de Huffman utilizada en la priority_queue.
+// Compara dos punteros a NodoHuffman segn su frecuencia (freq).
+// El nodo con menor frecuencia tendr mayor prioridad (menor freq sale primero).
+//
+// Uso:
+// - Esta estructura se utiliza como comparador en la cola de prioridad (priority_queue)
+//   para construir el rbol de Huffman de manera eficiente.
+
+struct CompareNodo {
+    bool operator()(NodoHuffman* a, NodoHuffman* b) {
+        return a->freq > b->freq;
+    }
+};
+
+
+
+// Funcin para construir el rbol de Huffman a partir de un mapa de frecuencias de caracteres.
+// Utiliza una cola de prioridad (priority_queue) para combinar los nodos de menor frecuencia.
+//
+// Parmetros:
+// - freq: Mapa que asocia cada carcter con su frecuencia de aparicin.
+//
+// Retorno:
+// - Un puntero a la raz del rbol de Huffman construido.
+//
+// Proceso:
+// 1. Crea un nodo hoja para cada carcter y lo inserta en la cola de prioridad.
+// 2. Mientras haya ms de un nodo en la cola:
+//    - Extrae los dos nodos con menor frecuencia.
+//    - Crea un nuevo nodo interno con estos dos nodos como hijos y la suma de sus frecuencias.
+//    - Inserta el nuevo nodo en la cola.
+// 3. El nodo restante en la cola es la raz del rbol de Huffman.
+//
+// Notas:
+// - El rbol de Huffman se utiliza para la compresin y descompresin eficiente de datos binarios.
+
+NodoHuffman* construirArbol(const map<char, int>& freq) {
+    priority_queue<NodoHuffman*, vector<NodoHuffman*>, CompareNodo> pq;
+    for (auto& p : freq) {
+        pq.push(new NodoHuffman(p.first, p.second));
+    }
+    while (pq.size() > 1) {
+        NodoHuffman* a = pq.top(); pq.pop();
+        NodoHuffman* b = pq.top(); pq.pop();
+        pq.push(new NodoHuffman(a, b));
+    }
+    return pq.top();
+}
+
+
+
+// Funcin para construir la tabla de cdigos Huffman a partir del rbol de Huffman.
+// Asigna a cada carcter una cadena de bits nica segn el recorrido del rbol.
+//
+// Parmetros:
+// - nodo: Puntero al nodo actual del rbol de Huffman.
+// - codigo: Cadena que representa el cdigo binario acumulado hasta el nodo actual.
+// - tabla: Mapa donde se almacenarn los cdigos Huffman generados para cada carcter.
+//
+// Proceso:
+// 1. Si el nodo es nulo, retorna (caso base).
+// 2. Si el nodo es una hoja (no tiene hijos), asigna el cdigo acumulado al carcter del nodo.
+// 3. Llama recursivamente para el hijo izquierdo agregando '0' al cdigo.
+// 4. Llama recursivamente para el hijo derecho agregando '1' al cdigo.
+//
+// Notas:
+// - Esta funcin se utiliza para generar los cdigos Huffman necesarios para la compresin y descompresin de datos.
+
+void construirCodigos(NodoHuffman* nodo, const string& codigo, map<char, string>& tabla) {
+    if (!nodo) return;
+    if (!nodo->izq && !nodo->der) { // Es una hoja
+        tabla[nodo->c] = codigo;
+    }
+    construirCodigos(nodo->izq, codigo + "0", tabla);
+    construirCodigos(nodo->der, codigo + "1", tabla);
+}
+
+
+
+// Funcin para liberar la memoria utilizada por un rbol binario (como el rbol de Huffman).
+//
+// Parmetros:
+// - nodo: Puntero al nodo raz del rbol a liberar.
+//
+// Proceso:
+// 1. Llama recursivamente a la funcin para liberar el subrbol izquierdo.
+// 2. Llama recursivamente a la funcin para liberar el subrbol derecho.
+// 3. Elimina el nodo actual.
+//
+// Notas:
+// - Es importante llamar a esta funcin para evitar fugas de memoria cuando se termina de usar el rbol.
+
+void liberarArbol(NodoHuffman* nodo) {
+    if (!nodo) return;
+    liberarArbol(nodo->izq);
+    liberarArbol(nodo->der);
+    delete nodo;
+}
+
+
+
+// Funcin para comprimir un buffer de datos utilizando el algoritmo de Huffman y guardar el resultado en un archivo binario.
+//
+// Parmetros:
+// - buffer: Vector de caracteres que contiene los datos originales a comprimir.
+// - archivoSalida: Ruta del archivo donde se guardar el resultado comprimido.
+//
+// Proceso:
+// 1. Cuenta la frecuencia de cada carcter en el buffer.
+// 2. Construye el rbol de Huffman a partir del mapa de frecuencias.
+// 3. Genera la tabla de cdigos Huffman para cada carcter.
+// 4. Abre el archivo de salida en modo binario.
+// 5. Escribe la tabla de cdigos en el archivo (nmero de entradas, cada carcter, tamao y cdigo).
+// 6. Codifica el buffer original en una cadena de bits usando la tabla de cdigos.
+// 7. Escribe la cantidad de bits codificados y empaqueta los bits en bytes para almacenarlos en el archivo.
+// 8. Libera la memoria del rbol de Huffman.
+//
+// Notas:
+// - Si el archivo no se puede abrir para escritura, muestra un mensaje de error y no realiza la compresin.
+// - El archivo generado puede ser descomprimido usando la funcin correspondiente que lee la tabla y decodifica los bits.
+
+void comprimirBufferConHuffman(const vector<char>& buffer, const string& archivoSalida) {
+    // Contar frecuencias de cada carcter en el buffer
+    map<char, int> freq;
+    for (char c : buffer) freq[c]++;
+
+    // Construir el rbol de Huffman
+    NodoHuffman* raiz = construirArbol(freq);
+
+    // Generar la tabla de cdigos Huffman
+    map<char, string> codigos;
+    construirCodigos(raiz, "", codigos);
+
+    // Abrir el archivo de salida en modo binario
+    ofstream ofs(archivoSalida, ios::binary);
+    if (!ofs.is_open()) {
+        cerr << "No se pudo crear archivo para comprimir\n";
+        liberarArbol(raiz);
+        return;
+    }
+
+    // Guardar el tamao de la tabla de cdigos
+    int tamTabla = static_cast<int>(codigos.size());
+    ofs.write(reinterpret_cast<const char*>(&tamTabla), sizeof(int));
+
+    // Guardar la tabla de cdigos: [char][int tamao cdigo][string cdigo]
+    for (auto& p : codigos) {
+        ofs.write(&p.first, sizeof(char));
+        int tamCod = static_cast<int>(p.second.size());
+        ofs.write(reinterpret_cast<const char*>(&tamCod), sizeof(int));
+        ofs.write(p.second.c_str(), tamCod);
+    }
+
+    // Codificar el buffer original en una cadena de bits
+    string bitsCodificados;
+    for (char c : buffer) bitsCodificados += codigos[c];
+
+    // Escribir la cantidad de bits codificados
+    int bitCount = static_cast<int>(bitsCodificados.size());
+    ofs.write(reinterpret_cast<const char*>(&bitCount), sizeof(int));
+
+    // Empaquetar los bits en bytes y escribirlos en el archivo
+    for (size_t i = 0; i < bitsCodificados.size(); i += 8) {
+        char byte = 0;
+        for (int j = 0; j < 8 && i + j < bitsCodificados.size(); ++j) {
+            if (bitsCodificados[i + j] == '1') {
+                byte |= (1 << (7 - j));
+            }
+        }
+        ofs.write(&byte, sizeof(char));
+    }
+
+    ofs.close();
+    liberarArbol(raiz);
+}
+
+
+
+// Funcin para leer la tabla de cdigos Huffman desde un archivo binario y reconstruir el mapa de decodificacin.
+//
+// Parmetros:
+// - ifs: Flujo de entrada de archivo binario abierto en modo lectura.
+// - tablaReversa: Mapa donde se almacenarn los cdigos Huffman como clave y el carcter correspondiente como valor.
+//
+// Proceso:
+// 1. Lee el nmero de entradas de la tabla de cdigos (int).
+// 2. Para cada entrada:
+//    - Lee el carcter asociado (char).
+//    - Lee el tamao del cdigo (int).
+//    - Lee el cdigo Huffman (string de tamao tamCod).
+//    - Almacena el par (cdigo, carcter) en el mapa tablaReversa.
+//
+// Notas:
+// - Esta funcin se utiliza durante la descompresin para reconstruir la tabla de decodificacin Huffman.
+// - El formato debe coincidir exactamente con el utilizado al guardar la tabla en la compresin.
+
+void leerTabla(ifstream& ifs, map<string, char>& tablaReversa) {
+    int tamTabla;
+    ifs.read(reinterpret_cast<char*>(&tamTabla), sizeof(int));
+
+    for (int i = 0; i < tamTabla; i++) {
+        char c;
+        ifs.read(&c, sizeof(char));
+        int tamCod;
+        ifs.read(reinterpret_cast<char*>(&tamCod), sizeof(int));
+        string codigo(tamCod, ' ');
+        ifs.read(&codigo[0], tamCod);
+        tablaReversa[codigo] = c;
+    }
+}
+
+
+
+// Funcin para descomprimir un archivo comprimido con Huffman y devolver el buffer original.
+//
+// Parmetros:
+// - archivoEntrada: Ruta del archivo .huff comprimido.
+//
+// Retorno:
+// - Un vector de caracteres con el contenido original descomprimido.
+//   Si ocurre un error al abrir o leer el archivo, retorna un vector vaco.
+//
+// Proceso:
+// 1. Abre el archivo en modo binario.
+// 2. Lee la tabla de cdigos Huffman invertida (cdigo -> carcter).
+// 3. Lee la cantidad de bits codificados y los bytes codificados.
+// 4. Decodifica los bits usando la tabla para reconstruir el buffer original.
+//
+// Notas:
+// - Esta funcin es utilizada por descomprimirCarpetaHuffman para restaurar archivos comprimidos.
+
+vector<char> descomprimirArchivoHuffman(const string& archivoEntrada) {
+    ifstream ifs(archivoEntrada, ios::binary);
+    if (!ifs.is_open()) {
+        cerr << "No se pudo abrir archivo para descomprimir\n";
+        return {};
+    }
+
+    // Leer tabla reversa
+    map<string, char> tablaReversa;
+    leerTabla(ifs, tablaReversa);
+
+    // Leer cantidad de bits codificados
+    int bitCount = 0;
+    ifs.read(reinterpret_cast<char*>(&bitCount), sizeof(int));
+
+    // Leer bytes codificados
+    int byteCount = (bitCount + 7) / 8;
+    vector<char> bytesCodificados(byteCount);
+    ifs.read(bytesCodificados.data(), byteCount);
+
+    // Decodificar bits
+    string codigoActual;
+    vector<char> bufferOriginal;
+    for (int i = 0; i < bitCount; i++) {
+        int byteIndex = i / 8;
+        int bitIndex = 7 - (i % 8);
+        bool bit = (bytesCodificados[byteIndex] & (1 << bitIndex)) != 0;
+        codigoActual += bit ? '1' : '0';
+
+        if (tablaReversa.find(codigoActual) != tablaReversa.end()) {
+            bufferOriginal.push_back(tablaReversa[codigoActual]);
+            codigoActual.clear();
+        }
+    }
+
+    ifs.close();
+    return bufferOriginal;
+}
+
+
+
+// Funcin para eliminar todos los archivos y carpetas dentro de una carpeta,
+// excepto un archivo especfico (por ejemplo, el archivo .huff).
+//
+// Parmetros:
+// - rutaCarpeta: Ruta de la carpeta donde se eliminar el contenido.
+// - nombreArchivoHuff: Nombre del archivo que NO debe eliminarse (por ejemplo, "traductor.huff").
+//
+// Proceso:
+// 1. Recorre todos los archivos y subcarpetas dentro de la carpeta especificada.
+// 2. Si el nombre del archivo es igual al archivo que se debe conservar, lo omite.
+// 3. Elimina recursivamente todos los dems archivos y carpetas.
+//
+// Notas:
+// - Esta funcin es til para limpiar la carpeta antes de descomprimir archivos,
+//   asegurando que solo se conserve el archivo comprimido .huff.
+
+void eliminarContenidoExceptoHuff(const string& rutaCarpeta, const string& nombreArchivoHuff) {
+    for (const auto& entry : fs::directory_iterator(rutaCarpeta)) {
+        if (entry.path().filename() == nombreArchivoHuff) continue;
+        fs::remove_all(entry.path());
+    }
+}
+
+
+
+// Funcin principal para comprimir el contenido de una carpeta utilizando Huffman.
+//
+// Parmetros:
+// - rutaCarpeta: Ruta de la carpeta cuyo contenido se desea comprimir.
+// - rutaArchivoDestino: Ruta donde se guardar el archivo comprimido (.huff).
+//
+// Proceso:
+// 1. Obtiene todos los archivos de la carpeta y subcarpetas (excepto el archivo .huff si existe).
+// 2. Serializa los archivos en un solo buffer binario.
+// 3. Si el buffer est vaco, muestra una advertencia y no realiza la compresin.
+// 4. Comprime el buffer utilizando el algoritmo de Huffman y guarda el resultado en el archivo destino.
+//
+// Notas:
+// - Esta funcin es llamada antes de salir del programa para respaldar el estado de la carpeta.
+// - El archivo .huff se excluye para evitar auto-incluirse en la compresin.
+
+void comprimirCarpetaHuffman(const string& rutaCarpeta, const string& rutaArchivoDestino) {
+    vector<ArchivoParaComprimir> archivos;
+    obtenerArchivos(rutaCarpeta, archivos);
+
+    // Excluir el archivo .huff existente
+    archivos.erase(remove_if(archivos.begin(), archivos.end(), [&](const ArchivoParaComprimir& a) {
+        return a.rutaRelativa == "traductor.huff";
+        }), archivos.end());
+
+    vector<char> buffer = serializarArchivos(archivos);
+
+    if (buffer.empty()) {
+        cerr << "Advertencia: El buffer est vaco. No se comprimir nada.\n";
+        return;
+    }
+
+    comprimirBufferConHuffman(buffer, rutaArchivoDestino);
+}
+
+
+
+// Funcin principal para descomprimir el contenido de una carpeta a partir de un archivo comprimido con Huffman.
+//
+// Parmetros:
+// - rutaCarpeta: Ruta de la carpeta donde se restaurarn los archivos descomprimidos.
+// - archivoHuff: Ruta del archivo comprimido (.huff) que contiene los datos serializados y comprimidos.
+//
+// Proceso:
+// 1. Descomprime el archivo .huff y obtiene el buffer binario original.
+// 2. Si el buffer est vaco o ocurre un error, muestra un mensaje y no realiza la restauracin.
+// 3. Antes de restaurar, elimina todo el contenido de la carpeta excepto el archivo .huff (si estuviera en la misma carpeta).
+// 4. Deserializa el buffer y reconstruye los archivos y carpetas originales en la ruta especificada.
+//
+// Notas:
+// - Esta funcin es llamada al inicio del programa si existe un archivo .huff para restaurar el estado anterior.
+// - Si el archivo .huff est en una carpeta separada, la exclusin del .huff es innecesaria pero no afecta el resultado.
+
+void descomprimirCarpetaHuffman(const string& rutaCarpeta, const string& archivoHuff) {
+    vector<char> buffer = descomprimirArchivoHuffman(archivoHuff);
+    if (buffer.empty()) {
+        cerr << "No se pudo descomprimir el archivo o est vaco\n";
+        return;
+    }
+
+    // Antes de restaurar, eliminar todo excepto el archivo .huff
+    eliminarContenidoExceptoHuff(rutaCarpeta, "traductor.huff");
+
+    // Reconstruir archivos
+    deserializarYReconstruir(buffer, rutaCarpeta);
+}
+
+
+
+// Funcin para eliminar todos los archivos y subcarpetas dentro de una carpeta especificada.
+//
+// Parmetros:
+// - rutaCarpeta: Ruta de la carpeta cuyo contenido se desea eliminar.
+//
+// Proceso:
+// 1. Recorre todos los archivos y subcarpetas dentro de la carpeta especificada usando un iterador de directorio.
+// 2. Para cada entrada encontrada (archivo o carpeta), intenta eliminarla recursivamente usando fs::remove_all.
+// 3. Si ocurre un error al eliminar algn archivo o carpeta, muestra un mensaje de error con detalles.
+//
+// Notas:
+// - Esta funcin elimina todo el contenido de la carpeta, pero no elimina la carpeta en s.
+// - Es til para limpiar completamente una carpeta antes de restaurar o comprimir su contenido.
+// - Utiliza manejo de excepciones para evitar que el programa termine si ocurre un error de sistema de archivos.
+
+void eliminarCarpetaContenido(const string& rutaCarpeta) {
+    for (auto& entry : fs::directory_iterator(rutaCarpeta)) {
+        try {
+            fs::remove_all(entry.path());  // Elimina archivos o carpetas recursivamente
+        }
+        catch (const fs::filesystem_error& e) {
+            cerr << "Error al eliminar " << entry.path() << ": " << e.what() << '\n';
+        }
+    }
+}
+
+
+
+
+//==========================FUNCIONES DE TRADUCCIONES COMPRIMIDAS==========================
+
+
+
+// Funcin auxiliar para copiar un rbol de Huffman al arreglo de decodificacin de una columna comprimida.
+//
+// Parmetros:
+// - nodo: Nodo del rbol de Huffman (construido con `construirArbol`).
+// - arbol: Arreglo de decodificacin (ver `ColumnaComprimida`).
+//
+// Retorno:
+// - La posicin del nodo en el arreglo, o -(carcter + 1) si es una hoja.
+
+int32_t aplanarHuffman(NodoHuffman* nodo, vector<int32_t>& arbol) {
+    if (!nodo->izq && !nodo->der) {
+        return -static_cast<int32_t>(static_cast<unsigned char>(nodo->c)) - 1;
+    }
+
+    int32_t posicion = static_cast<int32_t>(arbol.size() / 2);
+    arbol.resize(arbol.size() + 2);
+    int32_t izquierda = aplanarHuffman(nodo->izq, arbol);
+    int32_t derecha = aplanarHuffman(nodo->der, arbol);
+    arbol[2 * posicion] = izquierda;
+    arbol[2 * posicion + 1] = derecha;
+    return posicion;
+}
+
+
+
+// Funcin auxiliar para llenar la tabla de decodificacin rpida de una columna comprimida.
+//
+// Parmetros:
+// - columna: Columna con el rbol ya aplanado.
+// - nodo: Nodo (o hoja) al que se llega con `codigo`.
+// - codigo: Bits ledos hasta `nodo` (el primero es el menos significativo).
+// - largo: Cantidad de bits de `codigo`.
+//
+// Notas:
+// - Una hoja con un cdigo de `largo` bits ocupa todas las posiciones cuyos `largo` bits bajos son `codigo`.
+
+void llenarTablaHuffman(ColumnaComprimida& columna, int32_t nodo, uint32_t codigo, uint32_t largo) {
+    if (nodo < 0) {
+        for (uint32_t valor = codigo; valor < columna.tabla.size(); valor += 1u << largo) {
+            columna.tabla[valor] = (largo << 24) | static_cast<uint32_t>(-nodo - 1);
+        }
+        return;
+    }
+    if (largo == ColumnaComprimida::BITS_TABLA) {
+        columna.tabla[codigo] = static_cast<uint32_t>(nodo);
+        return;
+    }
+    llenarTablaHuffman(columna, columna.arbol[2 * nodo], codigo, largo + 1);
+    llenarTablaHuffman(columna, columna.arbol[2 * nodo + 1], codigo | (1u << largo), largo + 1);
+}
+
+
+
+// Funcin auxiliar para decodificar una traduccin de una columna comprimida.
+//
+// Parmetros:
+// - columna: Columna comprimida.
+// - bit: Bit donde comienza la traduccin.
+// - traduccion: Variable donde se guarda la traduccin (puede ser nullptr para solo saltarla).
+//
+// Retorno:
+// - El bit donde comienza la traduccin siguiente.
+//
+// Proceso:
+// 1. Lee los prximos 64 bits y busca los BITS_TABLA ms bajos en `tabla`: casi siempre obtiene el carcter
+//    y el largo de su cdigo en un solo paso.
+// 2. Si el cdigo es ms largo, contina bit a bit por el rbol desde el nodo que indica la tabla.
+// 3. Termina al decodificar el carcter '\0'.
+
+uint64_t decodificarHuffman(const ColumnaComprimida& columna, uint64_t bit, string* traduccion) {
+    const uint32_t mascara = (1u << ColumnaComprimida::BITS_TABLA) - 1;
+    while (true) {
+        size_t palabra = bit >> 6, desplazamiento = bit & 63;
+        uint64_t ventana = columna.bits[palabra] >> desplazamiento;
+        if (desplazamiento) ventana |= columna.bits[palabra + 1] << (64 - desplazamiento);
+
+        uint32_t valor = columna.tabla[ventana & mascara];
+        uint32_t largo = valor >> 24;
+        char caracter;
+        if (largo) {
+            caracter = static_cast<char>(valor & 0xFF);
+            bit += largo;
+        }
+        else {
+            int32_t nodo = static_cast<int32_t>(valor);
+            bit += ColumnaComprimida::BITS_TABLA;
+            while (nodo >= 0) {
+                nodo = columna.arbol[2 * nodo + ((columna.bits[bit >> 6] >> (bit & 63)) & 1)];
+                ++bit;
+            }
+            caracter = static_cast<char>(-nodo - 1);
+        }
+
+        if (caracter == '\0') return bit;
+        if (traduccion) *traduccion += caracter;
+    }
+}
+
+
+
+// Funcin para comprimir en memoria las traducciones de un idioma con un cdigo de Huffman entrenado con ellas.
+//
+// Parmetros:
+// - idioma: Idioma que se desea comprimir.
+//
+// Retorno:
+// - true si el idioma qued comprimido, false si no se pudo (una traduccin contiene '\0', la columna
+//   ocupa ms de 2^32 bits o un cdigo mide ms de 57 bits).
 //
 // Proceso:
-// 1. Cuenta la frecuencia de cada carcter en el buffer.
-// 2. Construye el rbol de Huffman a partir del mapa de frecuencias.
-// 3. Genera la tabla de cdigos Huffman para cada carcter.
-// 4. Abre el archivo de salida en modo binario.
-// 5. Escribe la tabla de cdigos en el archivo (nmero de entradas, cada carcter, tamao y cdigo).
-// 6. Codifica el buffer original en una cadena de bits usando la tabla de cdigos.
-// 7. Escribe la cantidad de bits codificados y empaqueta los bits en bytes para almacenarlos en el archivo.
-// 8. Libera la memoria del rbol de Huffman.
+// 1. Carga el idioma (`cargarColumna`) y cuenta la frecuencia de cada carcter en sus traducciones, ms un
+//   '\0' final por traduccin.
+// 2. Construye el rbol y los cdigos con `construirArbol` y `construirCodigos` (los mismos de la compresin
+//    de la carpeta) y prepara el rbol aplanado y la tabla para decodificar.
+// 3. Codifica la traduccin de cada posicin de `tablaPalabras` una detrs de otra y anota dnde comienza
+//    cada bloque de PALABRAS_POR_BLOQUE posiciones.
+// 4. Cambia las traducciones del idioma por `SIN_CADENA`, marca el idioma como no cargado y libera su
+//    ndice inverso (que necesita las traducciones).
 //
 // Notas:
-// - Si el archivo no se puede abrir para escritura, muestra un mensaje de error y no realiza la compresin.
-// - El archivo generado puede ser descomprimido usando la funcin correspondiente que lee la tabla y decodifica los bits.
+// - Las cadenas del idioma siguen en el pool hasta llamar a `compactarPoolCadenas` (ver `comprimirTraducciones`).
+// - Si hay ms de 2^30 caracteres, las frecuencias se reducen en proporcin para que sus sumas quepan en `int`;
+//   los cdigos siguen siendo vlidos, aunque un poco menos ajustados.
+
+bool comprimirColumna(int idioma) {
+    cargarColumna(idioma);
+    if (columnasIdiomas.comprimidas[idioma].cantidad) return true;
+
+    const vector<PalabraInterna>& palabras = tablaPalabras.palabras;
+    vector<bool> libre(palabras.size(), false);
+    for (uint32_t entrada : tablaPalabras.libres) libre[entrada] = true;
+
+    // 1. Contar los caracteres de las traducciones y sus terminadores.
+    uint64_t conteo[256] = {};
+    for (size_t entrada = 0; entrada < palabras.size(); ++entrada) {
+        if (libre[entrada]) continue;
+        for (char c : cadenaDe(traduccionDe(palabras[entrada], idioma))) {
+            ++conteo[static_cast<unsigned char>(c)];
+        }
+    }
+    if (conteo[0]) return false;
+    conteo[0] = palabras.size();
+
+    uint64_t caracteres = 0;
+    for (uint64_t cuenta : conteo) caracteres += cuenta;
+    int reduccion = 0;
+    while ((caracteres >> reduccion) > (1u << 30)) ++reduccion;
+    map<char, int> frecuencias;
+    for (int c = 0; c < 256; ++c) {
+        if (conteo[c]) frecuencias[static_cast<char>(c)] = static_cast<int>((conteo[c] >> reduccion) | 1);
+    }
+    if (frecuencias.size() < 2) frecuencias[1] = 1; // Con un solo carcter, su cdigo no tendra bits.
+
+    // 2. Construir el cdigo de Huffman del idioma.
+    NodoHuffman* raiz = construirArbol(frecuencias);
+    map<char, string> tabla;
+    construirCodigos(raiz, "", tabla);
+    ColumnaComprimida columna;
+    aplanarHuffman(raiz, columna.arbol);
+    liberarArbol(raiz);
+    columna.tabla.assign(size_t(1) << ColumnaComprimida::BITS_TABLA, 0);
+    llenarTablaHuffman(columna, 0, 0, 0);
+
+    uint64_t codigos[256] = {};
+    uint32_t largos[256] = {};
+    uint64_t totalBits = 0;
+    for (const auto& codigo : tabla) {
+        if (codigo.second.size() > 57) return false;
+        unsigned char c = static_cast<unsigned char>(codigo.first);
+        for (size_t i = 0; i < codigo.second.size(); ++i) {
+            if (codigo.second[i] == '1') codigos[c] |= uint64_t(1) << i;
+        }
+        largos[c] = static_cast<uint32_t>(codigo.second.size());
+        totalBits += conteo[c] * largos[c];
+    }
+    if (totalBits > 0xFFFFFFFFu) return false;
+
+    // 3. Codificar las traducciones (las posiciones libres quedan vacas).
+    columna.bits.assign(totalBits / 64 + 2, 0); // Una palabra de ms para leer siempre 64 bits seguidos.
+    columna.inicios.resize(palabras.size() / ColumnaComprimida::PALABRAS_POR_BLOQUE + 1);
+    uint64_t posicion = 0;
+    auto escribir = [&columna, &posicion, &codigos, &largos](unsigned char c) {
+        size_t palabra = posicion >> 6, desplazamiento = posicion & 63;
+        columna.bits[palabra] |= codigos[c] << desplazamiento;
+        if (desplazamiento + largos[c] > 64) columna.bits[palabra + 1] |= codigos[c] >> (64 - desplazamiento);
+        posicion += largos[c];
+        };
+    for (size_t entrada = 0; entrada < palabras.size(); ++entrada) {
+        if (entrada % ColumnaComprimida::PALABRAS_POR_BLOQUE == 0) {
+            columna.inicios[entrada / ColumnaComprimida::PALABRAS_POR_BLOQUE] = static_cast<uint32_t>(posicion);
+        }
+        if (!libre[entrada]) {
+            for (char c : cadenaDe(traduccionDe(palabras[entrada], idioma))) {
+                escribir(static_cast<unsigned char>(c));
+            }
+        }
+        escribir(0);
+    }
+    columna.cantidad = palabras.size();
 
-void comprimirBufferConHuffman(const vector<char>& buffer, const string& archivoSalida) {
-    // Contar frecuencias de cada carcter en el buffer
-    map<char, int> freq;
-    for (char c : buffer) freq[c]++;
+    // 4. Las traducciones del idioma ahora se leen de la columna comprimida.
+    if (columnasIdiomas.indexada[idioma]) liberarIndiceInverso(idioma);
+    for (PalabraInterna& p : tablaPalabras.palabras) {
+        traduccionDe(p, idioma) = PoolCadenas::SIN_CADENA;
+    }
+    columnasIdiomas.comprimidas[idioma] = move(columna);
+    columnasIdiomas.cargada[idioma] = false;
+    return true;
+}
 
-    // Construir el rbol de Huffman
-    NodoHuffman* raiz = construirArbol(freq);
 
-    // Generar la tabla de cdigos Huffman
-    map<char, string> codigos;
-    construirCodigos(raiz, "", codigos);
 
-    // Abrir el archivo de salida en modo binario
-    ofstream ofs(archivoSalida, ios::binary);
-    if (!ofs.is_open()) {
-        cerr << "No se pudo crear archivo para comprimir\n";
-        liberarArbol(raiz);
-        return;
-    }
+// Funcin para decodificar la traduccin comprimida de una palabra, sin descomprimir el idioma.
+//
+// Parmetros:
+// - entrada: Posicin de la palabra en `tablaPalabras`.
+// - idioma: Idioma de la traduccin.
+// - traduccion: Variable donde se guarda la traduccin.
+//
+// Retorno:
+// - true si la traduccin estaba comprimida, false si no (se debe leer del pool con `cargarColumna`).
+//
+// Notas:
+// - Comienza en el inicio del bloque de la palabra y salta las traducciones anteriores del bloque
+//   (en promedio PALABRAS_POR_BLOQUE / 2).
 
-    // Guardar el tamao de la tabla de cdigos
-    int tamTabla = static_cast<int>(codigos.size());
-    ofs.write(reinterpret_cast<const char*>(&tamTabla), sizeof(int));
+bool traduccionComprimida(uint32_t entrada, int idioma, string& traduccion) {
+    const ColumnaComprimida& columna = columnasIdiomas.comprimidas[idioma];
+    if (entrada >= columna.cantidad || traduccionDe(tablaPalabras.palabras[entrada], idioma) != PoolCadenas::SIN_CADENA) {
+        return false;
+    }
 
-    // Guardar la tabla de cdigos: [char][int tamao cdigo][string cdigo]
-    for (auto& p : codigos) {
-        ofs.write(&p.first, sizeof(char));
-        int tamCod = static_cast<int>(p.second.size());
-        ofs.write(reinterpret_cast<const char*>(&tamCod), sizeof(int));
-        ofs.write(p.second.c_str(), tamCod);
+    uint64_t bit = columna.inicios[entrada / ColumnaComprimida::PALABRAS_POR_BLOQUE];
+    for (uint32_t anterior = entrada % ColumnaComprimida::PALABRAS_POR_BLOQUE; anterior > 0; --anterior) {
+        bit = decodificarHuffman(columna, bit, nullptr);
     }
+    traduccion.clear();
+    decodificarHuffman(columna, bit, &traduccion);
+    columnasIdiomas.ultimoUso[idioma] = chrono::steady_clock::now();
+    return true;
+}
 
-    // Codificar el buffer original en una cadena de bits
-    string bitsCodificados;
-    for (char c : buffer) bitsCodificados += codigos[c];
 
-    // Escribir la cantidad de bits codificados
-    int bitCount = static_cast<int>(bitsCodificados.size());
-    ofs.write(reinterpret_cast<const char*>(&bitCount), sizeof(int));
 
-    // Empaquetar los bits en bytes y escribirlos en el archivo
-    for (size_t i = 0; i < bitsCodificados.size(); i += 8) {
-        char byte = 0;
-        for (int j = 0; j < 8 && i + j < bitsCodificados.size(); ++j) {
-            if (bitsCodificados[i + j] == '1') {
-                byte |= (1 << (7 - j));
-            }
-        }
-        ofs.write(&byte, sizeof(char));
+// Funcin para devolver al pool de cadenas las traducciones comprimidas de un idioma.
+//
+// Parmetros:
+// - idioma: Idioma comprimido.
+//
+// Notas:
+// - Se llama desde `cargarColumna` cuando una funcin necesita todas las traducciones del idioma (ndice inverso,
+//   traduccin de textos, guardar el diccionario binario, etc.). Decodifica la columna de principio a fin
+//   y despus la libera.
+
+void descomprimirColumna(int idioma) {
+    ColumnaComprimida columna = move(columnasIdiomas.comprimidas[idioma]);
+    columnasIdiomas.comprimidas[idioma] = ColumnaComprimida();
+
+    string traduccion;
+    uint64_t bit = 0;
+    for (size_t entrada = 0; entrada < columna.cantidad; ++entrada) {
+        traduccion.clear();
+        bit = decodificarHuffman(columna, bit, &traduccion);
+        uint32_t& id = traduccionDe(tablaPalabras.palabras[entrada], idioma);
+        if (id == PoolCadenas::SIN_CADENA) id = internarCadena(traduccion);
     }
+}
 
-    ofs.close();
-    liberarArbol(raiz);
+
+
+// Funcin para calcular la memoria que ocupan las cadenas del diccionario.
+//
+// Retorno:
+// - Bytes reservados por el pool de cadenas (texto y tabla hash) y por las columnas comprimidas.
+
+size_t memoriaCadenas() {
+    size_t bytes = poolCadenas.texto.capacity() + poolCadenas.tabla.capacity() * sizeof(uint32_t);
+    for (const ColumnaComprimida& columna : columnasIdiomas.comprimidas) {
+        bytes += (columna.arbol.capacity() + columna.tabla.capacity() + columna.inicios.capacity()) * sizeof(uint32_t)
+            + columna.bits.capacity() * sizeof(uint64_t);
+    }
+    return bytes;
 }
 
 
 
-// Funcin para leer la tabla de cdigos Huffman desde un archivo binario y reconstruir el mapa de decodificacin.
+// Funcin para comprimir en memoria las traducciones de todos los idiomas y mostrar el ahorro (experimental).
 //
 // Parmetros:
-// - ifs: Flujo de entrada de archivo binario abierto en modo lectura.
-// - tablaReversa: Mapa donde se almacenarn los cdigos Huffman como clave y el carcter correspondiente como valor.
+// - raiz: ndice de la raz del rbol AVL (se usa para tomar una muestra de palabras).
 //
 // Proceso:
-// 1. Lee el nmero de entradas de la tabla de cdigos (int).
-// 2. Para cada entrada:
-//    - Lee el carcter asociado (char).
-//    - Lee el tamao del cdigo (int).
-//    - Lee el cdigo Huffman (string de tamao tamCod).
-//    - Almacena el par (cdigo, carcter) en el mapa tablaReversa.
+// 1. Comprime cada idioma con `comprimirColumna` y reconstruye el pool de cadenas (`compactarPoolCadenas`),
+//    que despus solo guarda las palabras en espaol (las claves, que el rbol compara sin decodificar).
+// 2. Muestra la memoria de las cadenas antes y despus, los bits por carcter de cada idioma y el tiempo
+//    promedio de `traduccionComprimida` sobre una muestra de palabras.
 //
 // Notas:
-// - Esta funcin se utiliza durante la descompresin para reconstruir la tabla de decodificacin Huffman.
-// - El formato debe coincidir exactamente con el utilizado al guardar la tabla en la compresin.
+// - Es experimental: solo se activa con la opcin 9 de la medicin de rendimiento y no es un modo permanente.
+//   Las bsquedas (`mostrarTraduccion`) decodifican solo la traduccin que se muestra, pero las funciones que
+//   recorren un idioma completo lo descomprimen en el pool (`cargarColumna`) y el idioma queda descomprimido.
+// - El ahorro depende de cuntas traducciones se repiten, porque el pool ya guarda una sola vez cada cadena:
+//   con 20 000 palabras distintas la memoria de las cadenas baj de 1984 KB a 775 KB, pero con el diccionario
+//   de 1 000 000 de palabras solo de 47104 KB a 46955 KB (0.3 %).
+
+void comprimirTraducciones(uint32_t raiz) {
+    size_t antes = memoriaCadenas();
+    uint64_t caracteres[CANTIDAD_IDIOMAS] = {};
+    for (int idioma = 0; idioma < CANTIDAD_IDIOMAS; ++idioma) {
+        cargarColumna(idioma);
+        for (uint32_t entrada = 0; entrada < tablaPalabras.palabras.size(); ++entrada) {
+            caracteres[idioma] += cadenaDe(traduccionDe(tablaPalabras.palabras[entrada], idioma)).size();
+        }
+    }
 
-void leerTabla(ifstream& ifs, map<string, char>& tablaReversa) {
-    int tamTabla;
-    ifs.read(reinterpret_cast<char*>(&tamTabla), sizeof(int));
+    auto inicio = chrono::steady_clock::now();
+    bool comprimido[CANTIDAD_IDIOMAS];
+    for (int idioma = 0; idioma < CANTIDAD_IDIOMAS; ++idioma) {
+        comprimido[idioma] = comprimirColumna(idioma);
+    }
+    compactarPoolCadenas();
+    double segundos = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+    size_t despues = memoriaCadenas();
+
+    const char* nombres[CANTIDAD_IDIOMAS] = { "Ingles", "Aleman", "Frances", "Italiano" };
+    cout << "\n--- TRADUCCIONES COMPRIMIDAS (" << tamano(raiz) << " palabras, " << segundos << " s) ---\n";
+    cout << "Memoria de las cadenas: " << antes / 1024 << " KB antes, " << despues / 1024 << " KB despues\n";
+    for (int idioma = 0; idioma < CANTIDAD_IDIOMAS; ++idioma) {
+        const ColumnaComprimida& columna = columnasIdiomas.comprimidas[idioma];
+        if (!comprimido[idioma]) {
+            cout << nombres[idioma] << ": no se pudo comprimir\n";
+            continue;
+        }
+        size_t bytes = columna.bits.size() * sizeof(uint64_t) + columna.inicios.size() * sizeof(uint32_t);
+        cout << nombres[idioma] << ": " << bytes / 1024 << " KB";
+        if (caracteres[idioma]) {
+            cout << " (" << static_cast<double>(bytes) * 8 / caracteres[idioma]
+                << " bits por caracter, con los terminadores y los inicios de bloque)";
+        }
+        cout << "\n";
+    }
 
-    for (int i = 0; i < tamTabla; i++) {
-        char c;
-        ifs.read(&c, sizeof(char));
-        int tamCod;
-        ifs.read(reinterpret_cast<char*>(&tamCod), sizeof(int));
-        string codigo(tamCod, ' ');
-        ifs.read(&codigo[0], tamCod);
-        tablaReversa[codigo] = c;
+    // Medir la decodificacin de una muestra de palabras.
+    vector<uint32_t> nodos;
+    recorrerInorden(raiz, nodos);
+    if (nodos.empty() || !comprimido[IDIOMA_INGLES]) return;
+    size_t paso = nodos.size() / 4096 + 1;
+    string traduccion;
+    size_t decodificadas = 0, largo = 0;
+    inicio = chrono::steady_clock::now();
+    for (size_t i = 0; i < nodos.size(); i += paso) {
+        if (traduccionComprimida(nodoEn(nodos[i]).entrada, IDIOMA_INGLES, traduccion)) {
+            ++decodificadas;
+            largo += traduccion.size();
+        }
+    }
+    double nanos = chrono::duration<double, nano>(chrono::steady_clock::now() - inicio).count();
+    if (decodificadas) {
+        cout << "Decodificar una traduccion: " << nanos / decodificadas << " ns (" << static_cast<double>(largo) / decodificadas
+            << " caracteres en promedio)\n";
     }
 }
 
 
 
-// Funcin para descomprimir un archivo comprimido con Huffman y devolver el buffer original.
+
+//==========================FUNCIONES DEL TRADUCTOR==========================
+
+
+
+// Funcin para reproducir un texto en forma de audio utilizando PowerShell.
 //
 // Parmetros:
-// - archivoEntrada: Ruta del archivo .huff comprimido.
+// - texto: Texto que se desea reproducir (normalmente una traduccin).
 //
-// Retorno:
-// - Un vector de caracteres con el contenido original descomprimido.
-//   Si ocurre un error al abrir o leer el archivo, retorna un vector vaco.
+// Notas:
+// - La reproduccin de audio requiere que PowerShell est disponible en el sistema.
+
+void reproducirAudio(const string& texto) {
+    string comando = "powershell -Command \"Add-Type -AssemblyName System.Speech; "
+        "$speak = New-Object System.Speech.Synthesis.SpeechSynthesizer; "
+        "$speak.Speak('" + texto + "');\"";
+    system(comando.c_str());
+}
+
+
+
+// Funcin para guardar una palabra buscada en el historial del usuario.
+//
+// Parmetros:
+// - palabraBuscada: Palabra en espaol que se busc.
+// - rutaUsuario: Ruta de la carpeta del usuario actual, donde se almacenan los archivos.
 //
 // Proceso:
-// 1. Abre el archivo en modo binario.
-// 2. Lee la tabla de cdigos Huffman invertida (cdigo -> carcter).
-// 3. Lee la cantidad de bits codificados y los bytes codificados.
-// 4. Decodifica los bits usando la tabla para reconstruir el buffer original.
+// 1. Encripta la palabra con `encriptarPalabra` y aplica XOR con la llave del usuario.
+// 2. Guarda el resultado en `conversion.umg` (utilizado por el historial y el ranking).
+// 3. Guarda la palabra original en `informacion_original.umg`.
+// 4. Suma la bsqueda al contador del ndice ponderado (ver `actualizarIndicePonderado`).
+
+void registrarBusqueda(const string& palabraBuscada, const string& rutaUsuario) {
+    // Encriptar la palabra buscada.
+    string palabraEncriptada = encriptarPalabra(palabraBuscada);
+
+    // Leer la llave desde el archivo del usuario.
+    ifstream llaveFile(rutaUsuario + "\\llave.umg");
+    string llave;
+    getline(llaveFile, llave);
+    llaveFile.close();
+
+    // Aplicar XOR sobre la palabra encriptada con la llave.
+    string palabraFinal = aplicarXOR(palabraEncriptada, llave);
+
+    // Guardar la palabra encriptada con XOR en el archivo `conversion.umg`.
+    ofstream archivoConversion(rutaUsuario + "\\conversion.umg", ios::app);
+    if (archivoConversion.is_open()) {
+        archivoConversion << palabraFinal << endl;
+        archivoConversion.close();
+    }
+    else {
+        cerr << "Error al abrir conversion.umg para escritura.\n";
+    }
+
+    // Guardar la palabra original en el archivo `informacion_original.umg`.
+    ofstream archivoOriginal(rutaUsuario + "\\informacion_original.umg", ios::app);
+    if (archivoOriginal.is_open()) {
+        archivoOriginal << palabraBuscada << endl;
+        archivoOriginal.close();
+    }
+    else {
+        cerr << "Error al abrir informacion_original.umg para escritura.\n";
+    }
+
+    ++indicePonderado.busquedas;
+}
+
+
+
+// Funcin para buscar una palabra en el diccionario, mostrar su traduccin en el idioma seleccionado
+// y guardar la palabra buscada en los archivos correspondientes.
+//
+// Parmetros:
+// - indice: ndice congelado del rbol AVL que contiene las palabras y sus traducciones.
+// - binario: Diccionario binario; mientras est abierto (el rbol todava se carga), se busca en l.
+// - rutaUsuario: Ruta de la carpeta del usuario actual, donde se almacenan los archivos.
+//
+// Proceso:
+// 1. Solicita al usuario una palabra en espaol y la busca en el diccionario binario mapeado
+//    (`buscarBinario`) o, si ya se cerr, en el ndice congelado pasando por la cach (`buscarConCache`).
+// 2. Si la palabra existe, permite seleccionar un idioma para mostrar la traduccin. Mientras el
+//    diccionario binario est abierto, la traduccin se lee de la columna mapeada del idioma
+//    (`traduccionBinaria`); si el idioma est comprimido en memoria, se decodifica solo esta traduccin
+//    (`traduccionComprimida`); si no, se carga el idioma en memoria con `cargarColumna` la primera vez.
+// 3. Reproduce la traduccin en forma de audio con `reproducirAudio`.
+// 4. Guarda la palabra buscada con `registrarBusqueda` en dos archivos:
+//    - `conversion.umg`: La palabra encriptada y procesada con XOR.
+//    - `informacion_original.umg`: La palabra original.
 //
 // Notas:
-// - Esta funcin es utilizada por descomprimirCarpetaHuffman para restaurar archivos comprimidos.
+// - Si la palabra no se encuentra tal como se escribi, se busca sin distinguir maysculas ni acentos
+//   (`buscarNormalizada`): con una sola coincidencia se contina con ella, y con varias ("papa" y "pap")
+//   se deja elegir. La palabra se muestra y se registra con su escritura original.
+// - Si tampoco as se encuentra, muestra un mensaje de error y ofrece las palabras ms parecidas
+//   (`buscarAproximadas`); si el usuario elige una, contina con ella. Ambas bsquedas necesitan el
+//   ndice congelado, por lo que antes se espera a que termine la carga (`esperarCargaBinaria`).
+
+void mostrarTraduccion(const IndiceCongelado& indice, DiccionarioBinario& binario, const string& rutaUsuario) {
+    string palabraBuscada;
+    int idioma;
 
-vector<char> descomprimirArchivoHuffman(const string& archivoEntrada) {
-    ifstream ifs(archivoEntrada, ios::binary);
-    if (!ifs.is_open()) {
-        cerr << "No se pudo abrir archivo para descomprimir\n";
-        return {};
+    // Solicitar al usuario la palabra en espaol que desea buscar.
+    cout << "\nIngrese una palabra en espanol: ";
+    cin >> palabraBuscada;
+
+    // Buscar la palabra en el diccionario binario (si el rbol todava se carga) o en el ndice congelado.
+    const PalabraInterna* palabra = nullptr;
+    size_t fila = 0;
+    bool encontrada;
+    if (binario.datos) {
+        encontrada = buscarBinario(binario, palabraBuscada, fila);
+    }
+    else {
+        palabra = buscarConCache(indice, palabraBuscada);
+        encontrada = palabra != nullptr;
     }
 
-    // Leer tabla reversa
-    map<string, char> tablaReversa;
-    leerTabla(ifs, tablaReversa);
+    if (!encontrada) {
+        esperarCargaBinaria(binario);
 
-    // Leer cantidad de bits codificados
-    int bitCount = 0;
-    ifs.read(reinterpret_cast<char*>(&bitCount), sizeof(int));
+        // Buscar sin distinguir maysculas ni acentos y continuar con la escritura original.
+        vector<uint32_t> coincidencias = buscarNormalizada(indice, palabraBuscada);
+        if (coincidencias.size() == 1) {
+            palabraBuscada = string(cadenaDe(tablaPalabras.palabras[coincidencias[0]].espanol));
+            cout << "Palabra encontrada: " << palabraBuscada << endl;
+        }
+        else if (!coincidencias.empty()) {
+            cout << "Palabras encontradas:\n";
+            for (size_t i = 0; i < coincidencias.size(); ++i) {
+                cout << i + 1 << ". " << cadenaDe(tablaPalabras.palabras[coincidencias[i]].espanol) << endl;
+            }
+            cout << "Opcion: ";
+            int eleccion;
+            cin >> eleccion;
+            if (eleccion < 1 || eleccion > static_cast<int>(coincidencias.size())) return;
+            palabraBuscada = string(cadenaDe(tablaPalabras.palabras[coincidencias[eleccion - 1]].espanol));
+        }
+        encontrada = !coincidencias.empty();
+        if (encontrada) palabra = buscarConCache(indice, palabraBuscada);
+    }
 
-    // Leer bytes codificados
-    int byteCount = (bitCount + 7) / 8;
-    vector<char> bytesCodificados(byteCount);
-    ifs.read(bytesCodificados.data(), byteCount);
+    if (!encontrada) {
+        cout << "Palabra no encontrada.\n";
 
-    // Decodificar bits
-    string codigoActual;
-    vector<char> bufferOriginal;
-    for (int i = 0; i < bitCount; i++) {
-        int byteIndex = i / 8;
-        int bitIndex = 7 - (i % 8);
-        bool bit = (bytesCodificados[byteIndex] & (1 << bitIndex)) != 0;
-        codigoActual += bit ? '1' : '0';
+        // Sugerir las palabras ms parecidas (1 error en palabras cortas, hasta 2 en las dems).
+        vector<Sugerencia> sugerencias = buscarAproximadas(indice, palabraBuscada, palabraBuscada.size() <= 4 ? 1 : 2, 5);
+        if (sugerencias.empty()) return;
 
-        if (tablaReversa.find(codigoActual) != tablaReversa.end()) {
-            bufferOriginal.push_back(tablaReversa[codigoActual]);
-            codigoActual.clear();
+        cout << "Quiso decir:\n";
+        for (size_t i = 0; i < sugerencias.size(); ++i) {
+            cout << i + 1 << ". " << sugerencias[i].palabra << endl;
         }
+        cout << "0. Ninguna\n";
+        cout << "Opcion: ";
+        int eleccion;
+        cin >> eleccion;
+        if (eleccion < 1 || eleccion > static_cast<int>(sugerencias.size())) return;
+
+        // Continuar con la palabra sugerida.
+        palabraBuscada = string(sugerencias[eleccion - 1].palabra);
+        palabra = buscarConCache(indice, palabraBuscada);
     }
 
-    ifs.close();
-    return bufferOriginal;
+    // Solicitar al usuario que seleccione un idioma para la traduccin.
+    cout << "Seleccione el idioma:\n";
+    cout << "1. Ingles\n2. Aleman\n3. Frances\n4. Italiano\n";
+    cout << "Opcion: ";
+    cin >> idioma;
+    if (idioma < 1 || idioma > CANTIDAD_IDIOMAS) {
+        cout << "Traduccion: Opcion no valida.\n";
+        return;
+    }
+
+    // Leer la traduccin de la columna mapeada, de la columna comprimida en memoria (decodificando solo esta
+    // traduccin) o, si no se puede, del diccionario en memoria.
+    string_view vista;
+    string traduccion;
+    if (binario.datos && traduccionBinaria(binario, fila, idioma - 1, vista)) {
+        traduccion = string(vista);
+    }
+    else {
+        if (binario.datos) {
+            esperarCargaBinaria(binario);
+            palabra = buscarConCache(indice, palabraBuscada);
+        }
+        uint32_t entrada = static_cast<uint32_t>(palabra - tablaPalabras.palabras.data());
+        if (!traduccionComprimida(entrada, idioma - 1, traduccion)) {
+            cargarColumna(idioma - 1);
+            traduccion = string(cadenaDe(traduccionDe(*palabra, idioma - 1)));
+        }
+    }
+
+    cout << "Traduccion: " << traduccion << endl;
+
+    // Reproducir la traduccin en forma de audio utilizando PowerShell.
+    reproducirAudio(traduccion);
+
+    // Guardar la palabra buscada en el historial del usuario.
+    registrarBusqueda(palabraBuscada, rutaUsuario);
 }
 
 
 
-// Funcin para eliminar todos los archivos y carpetas dentro de una carpeta,
-// excepto un archivo especfico (por ejemplo, el archivo .huff).
+// Funcin para buscar una palabra escrita en ingls, alemn, francs o italiano y mostrar su
+// traduccin en cualquier otro idioma (incluido el espaol).
 //
 // Parmetros:
-// - rutaCarpeta: Ruta de la carpeta donde se eliminar el contenido.
-// - nombreArchivoHuff: Nombre del archivo que NO debe eliminarse (por ejemplo, "traductor.huff").
+// - raiz: ndice del nodo raz del rbol AVL.
+// - rutaUsuario: Ruta de la carpeta del usuario actual, donde se almacenan los archivos.
 //
 // Proceso:
-// 1. Recorre todos los archivos y subcarpetas dentro de la carpeta especificada.
-// 2. Si el nombre del archivo es igual al archivo que se debe conservar, lo omite.
-// 3. Elimina recursivamente todos los dems archivos y carpetas.
+// 1. Solicita el idioma de origen y la palabra, y la busca en el ndice inverso de ese idioma
+//    con `buscarPorTraduccion` (el ndice se construye la primera vez con `asegurarIndiceInverso`).
+// 2. Si la palabra existe, permite seleccionar el idioma de destino y carga sus traducciones.
+// 3. Muestra la traduccin de cada palabra encontrada (una misma traduccin puede corresponder a
+//    varias palabras en espaol) y reproduce la primera en forma de audio.
+// 4. Guarda en el historial la palabra en espaol de cada coincidencia con `registrarBusqueda`.
 //
 // Notas:
-// - Esta funcin es til para limpiar la carpeta antes de descomprimir archivos,
-//   asegurando que solo se conserve el archivo comprimido .huff.
+// - Las traducciones entre dos idiomas distintos del espaol (por ejemplo, de ingls a alemn)
+//   pasan por la palabra en espaol que las une.
 
-void eliminarContenidoExceptoHuff(const string& rutaCarpeta, const string& nombreArchivoHuff) {
-    for (const auto& entry : fs::directory_iterator(rutaCarpeta)) {
-        if (entry.path().filename() == nombreArchivoHuff) continue;
-        fs::remove_all(entry.path());
+void mostrarTraduccionInversa(uint32_t raiz, const string& rutaUsuario) {
+    const char* nombresIdiomas[CANTIDAD_IDIOMAS] = { "ingles", "aleman", "frances", "italiano" };
+    int origen, destino;
+    string palabraBuscada;
+
+    // Solicitar el idioma de origen.
+    cout << "\nSeleccione el idioma de origen:\n";
+    cout << "1. Ingles\n2. Aleman\n3. Frances\n4. Italiano\n";
+    cout << "Opcion: ";
+    cin >> origen;
+    if (origen < 1 || origen > CANTIDAD_IDIOMAS) {
+        cout << "Opcion no valida.\n";
+        return;
+    }
+
+    // Solicitar la palabra y buscarla en el ndice inverso del idioma de origen.
+    cout << "Ingrese una palabra en " << nombresIdiomas[origen - 1] << ": ";
+    cin >> palabraBuscada;
+
+    asegurarIndiceInverso(raiz, origen - 1);
+    vector<uint32_t> entradas = buscarPorTraduccion(origen - 1, palabraBuscada);
+    if (entradas.empty()) {
+        cout << "Palabra no encontrada.\n";
+        return;
+    }
+
+    // Solicitar el idioma de destino.
+    cout << "Seleccione el idioma de destino:\n";
+    cout << "1. Espanol\n2. Ingles\n3. Aleman\n4. Frances\n5. Italiano\n";
+    cout << "Opcion: ";
+    cin >> destino;
+    if (destino < 1 || destino > CANTIDAD_IDIOMAS + 1) {
+        cout << "Opcion no valida.\n";
+        return;
+    }
+    if (destino > 1) cargarColumna(destino - 2);
+
+    // Mostrar la traduccin de cada coincidencia.
+    string primeraTraduccion;
+    for (uint32_t entrada : entradas) {
+        const PalabraInterna& palabra = tablaPalabras.palabras[entrada];
+        string traduccion(cadenaDe(destino == 1 ? palabra.espanol : traduccionDe(palabra, destino - 2)));
+        cout << "Traduccion: " << traduccion << " (" << cadenaDe(palabra.espanol) << ")\n";
+        if (primeraTraduccion.empty()) primeraTraduccion = traduccion;
+    }
+
+    // Reproducir la primera traduccin en forma de audio.
+    reproducirAudio(primeraTraduccion);
+
+    // Guardar en el historial las palabras en espaol encontradas.
+    for (uint32_t entrada : entradas) {
+        registrarBusqueda(string(cadenaDe(tablaPalabras.palabras[entrada].espanol)), rutaUsuario);
     }
 }
 
 
 
-// Funcin principal para comprimir el contenido de una carpeta utilizando Huffman.
+// Funcin para mostrar las palabras en espaol que comienzan con un texto (autocompletado).
 //
 // Parmetros:
-// - rutaCarpeta: Ruta de la carpeta cuyo contenido se desea comprimir.
-// - rutaArchivoDestino: Ruta donde se guardar el archivo comprimido (.huff).
+// - raiz: ndice del nodo raz del rbol AVL.
 //
 // Proceso:
-// 1. Obtiene todos los archivos de la carpeta y subcarpetas (excepto el archivo .huff si existe).
-// 2. Serializa los archivos en un solo buffer binario.
-// 3. Si el buffer est vaco, muestra una advertencia y no realiza la compresin.
-// 4. Comprime el buffer utilizando el algoritmo de Huffman y guarda el resultado en el archivo destino.
+// 1. Solicita al usuario el inicio de la palabra.
+// 2. Cuenta las coincidencias con `intervaloPrefijo` y muestra las primeras con `autocompletar`.
 //
 // Notas:
-// - Esta funcin es llamada antes de salir del programa para respaldar el estado de la carpeta.
-// - El archivo .huff se excluye para evitar auto-incluirse en la compresin.
-
-void comprimirCarpetaHuffman(const string& rutaCarpeta, const string& rutaArchivoDestino) {
-    vector<ArchivoParaComprimir> archivos;
-    obtenerArchivos(rutaCarpeta, archivos);
+// - Solo se recorren las palabras que se muestran, aunque el prefijo tenga miles de coincidencias.
 
-    // Excluir el archivo .huff existente
-    archivos.erase(remove_if(archivos.begin(), archivos.end(), [&](const ArchivoParaComprimir& a) {
-        return a.rutaRelativa == "traductor.huff";
-        }), archivos.end());
+void mostrarAutocompletado(uint32_t raiz) {
+    const size_t MAXIMO_SUGERENCIAS = 20;
+    string prefijo;
 
-    vector<char> buffer = serializarArchivos(archivos);
+    cout << "\nIngrese el inicio de la palabra en espanol: ";
+    cin >> prefijo;
 
-    if (buffer.empty()) {
-        cerr << "Advertencia: El buffer est vaco. No se comprimir nada.\n";
+    pair<size_t, size_t> intervalo = intervaloPrefijo(raiz, prefijo);
+    size_t total = intervalo.second - intervalo.first;
+    if (total == 0) {
+        cout << "No hay palabras que comiencen con \"" << prefijo << "\".\n";
         return;
     }
 
-    comprimirBufferConHuffman(buffer, rutaArchivoDestino);
+    cout << "Palabras que comienzan con \"" << prefijo << "\" (" << total << "):\n";
+    for (uint32_t nodo : autocompletar(raiz, prefijo, MAXIMO_SUGERENCIAS)) {
+        cout << "- " << cadenaDe(palabraDe(nodo).espanol) << endl;
+    }
+    if (total > MAXIMO_SUGERENCIAS) {
+        cout << "... y " << total - MAXIMO_SUGERENCIAS << " mas.\n";
+    }
 }
 
 
 
-// Funcin principal para descomprimir el contenido de una carpeta a partir de un archivo comprimido con Huffman.
+// Funcin para traducir un texto completo (una o varias lneas) escrito en espaol.
 //
 // Parmetros:
-// - rutaCarpeta: Ruta de la carpeta donde se restaurarn los archivos descomprimidos.
-// - archivoHuff: Ruta del archivo comprimido (.huff) que contiene los datos serializados y comprimidos.
+// - raiz: ndice del nodo raz del rbol AVL.
 //
 // Proceso:
-// 1. Descomprime el archivo .huff y obtiene el buffer binario original.
-// 2. Si el buffer est vaco o ocurre un error, muestra un mensaje y no realiza la restauracin.
-// 3. Antes de restaurar, elimina todo el contenido de la carpeta excepto el archivo .huff (si estuviera en la misma carpeta).
-// 4. Deserializa el buffer y reconstruye los archivos y carpetas originales en la ruta especificada.
+// 1. Solicita el idioma de destino.
+// 2. Lee lneas hasta encontrar una lnea vaca y las traduce juntas con `traducirTexto`, que toma
+//    en cada posicin la palabra o frase ms larga del diccionario (por ejemplo, "buenos dias" antes
+//    que "buenos").
+// 3. Muestra el texto traducido y la cantidad de palabras o frases traducidas.
 //
 // Notas:
-// - Esta funcin es llamada al inicio del programa si existe un archivo .huff para restaurar el estado anterior.
-// - Si el archivo .huff est en una carpeta separada, la exclusin del .huff es innecesaria pero no afecta el resultado.
+// - Las palabras que no estn en el diccionario se dejan como estn.
 
-void descomprimirCarpetaHuffman(const string& rutaCarpeta, const string& archivoHuff) {
-    vector<char> buffer = descomprimirArchivoHuffman(archivoHuff);
-    if (buffer.empty()) {
-        cerr << "No se pudo descomprimir el archivo o est vaco\n";
+void mostrarTraduccionTexto(uint32_t raiz) {
+    int idioma;
+    cout << "\nSeleccione el idioma:\n";
+    cout << "1. Ingles\n2. Aleman\n3. Frances\n4. Italiano\n";
+    cout << "Opcion: ";
+    cin >> idioma;
+    if (idioma < 1 || idioma > CANTIDAD_IDIOMAS) {
+        cout << "Opcion no valida.\n";
         return;
     }
 
-    // Antes de restaurar, eliminar todo excepto el archivo .huff
-    eliminarContenidoExceptoHuff(rutaCarpeta, "traductor.huff");
+    // Leer el texto hasta una lnea vaca.
+    cout << "Ingrese el texto en espanol (termine con una linea vacia):\n";
+    cin.ignore((numeric_limits<streamsize>::max)(), '\n'); // Descartar el fin de lnea de la opcin.
+    string texto, linea;
+    while (getline(cin, linea) && !linea.empty()) {
+        texto += linea;
+        texto += '\n';
+    }
 
-    // Reconstruir archivos
-    deserializarYReconstruir(buffer, rutaCarpeta);
+    size_t traducidas = 0;
+    string traduccion = traducirTexto(raiz, texto, idioma - 1, traducidas);
+    cout << "Traduccion (" << traducidas << " palabras o frases traducidas):\n" << traduccion;
 }
 
 
 
-// Funcin para eliminar todos los archivos y subcarpetas dentro de una carpeta especificada.
+// Funcin para combinar el diccionario con una lista de palabras de un archivo (unin, diferencia o interseccin).
 //
 // Parmetros:
-// - rutaCarpeta: Ruta de la carpeta cuyo contenido se desea eliminar.
+// - raiz: ndice del nodo raz del rbol AVL.
+//
+// Retorno:
+// - El ndice de la raz del rbol despus de la operacin.
 //
 // Proceso:
-// 1. Recorre todos los archivos y subcarpetas dentro de la carpeta especificada usando un iterador de directorio.
-// 2. Para cada entrada encontrada (archivo o carpeta), intenta eliminarla recursivamente usando fs::remove_all.
-// 3. Si ocurre un error al eliminar algn archivo o carpeta, muestra un mensaje de error con detalles.
+// 1. Solicita la operacin y la ruta del archivo, que tiene el mismo formato que `palabras.umg`.
+// 2. Lee la lista con `leerArchivoPalabras` (ordenada y sin repetidas).
+// 3. Aplica la operacin con `aplicarOperacionMasiva` y muestra las palabras agregadas y eliminadas y el tiempo.
 //
 // Notas:
-// - Esta funcin elimina todo el contenido de la carpeta, pero no elimina la carpeta en s.
-// - Es til para limpiar completamente una carpeta antes de restaurar o comprimir su contenido.
-// - Utiliza manejo de excepciones para evitar que el programa termine si ocurre un error de sistema de archivos.
+// - Sirve para importar la lista de un proveedor (unin) o retirar un lote de palabras obsoletas (diferencia)
+//   sin agregar o eliminar las palabras una por una; los cambios se registran una sola vez al final.
 
-void eliminarCarpetaContenido(const string& rutaCarpeta) {
-    for (auto& entry : fs::directory_iterator(rutaCarpeta)) {
-        try {
-            fs::remove_all(entry.path());  // Elimina archivos o carpetas recursivamente
-        }
-        catch (const fs::filesystem_error& e) {
-            cerr << "Error al eliminar " << entry.path() << ": " << e.what() << '\n';
-        }
+uint32_t combinarConLista(uint32_t raiz) {
+    int opcion;
+    cout << "\n--- COMBINAR CON UNA LISTA DE PALABRAS ---\n";
+    cout << "1. Agregar las palabras de la lista (union)\n";
+    cout << "2. Eliminar las palabras de la lista (diferencia)\n";
+    cout << "3. Conservar solo las palabras de la lista (interseccion)\n";
+    cout << "Seleccione una opcion: ";
+    cin >> opcion;
+    if (opcion < 1 || opcion > 3) {
+        cout << "Opcion no valida.\n";
+        return raiz;
     }
-}
-
 
+    string ruta;
+    cout << "Ingrese la ruta del archivo de la lista (formato espanol,ingles,aleman,frances,italiano): ";
+    cin >> ruta;
+    ArchivoPalabras archivo;
+    size_t registros = 0;
+    if (!leerArchivoPalabras(ruta, archivo, registros)) {
+        cout << "No se pudo abrir el archivo: " << ruta << "\n";
+        return raiz;
+    }
 
+    size_t agregadas = 0, eliminadas = 0;
+    auto inicio = chrono::steady_clock::now();
+    raiz = aplicarOperacionMasiva(raiz, archivo.palabras, static_cast<OperacionMasiva>(opcion - 1), agregadas, eliminadas);
+    double milisegundos = chrono::duration<double, milli>(chrono::steady_clock::now() - inicio).count();
 
-//==========================FUNCIONES DEL TRADUCTOR==========================
+    cout << "Palabras en la lista: " << archivo.palabras.size() << " | Agregadas: " << agregadas
+        << " | Eliminadas: " << eliminadas << "\n";
+    cout << "El diccionario tiene " << tamano(raiz) << " palabras (" << milisegundos << " ms).\n";
+    return raiz;
+}
 
 
 
-// Funcin para buscar una palabra en el rbol AVL, mostrar su traduccin en el idioma seleccionado
-// y guardar la palabra buscada en los archivos correspondientes.
+// Funcin para recorrer el diccionario completo en orden alfabtico, una pgina a la vez.
 //
 // Parmetros:
-// - raiz: Puntero al nodo raz del rbol AVL que contiene las palabras y sus traducciones.
-// - rutaUsuario: Ruta de la carpeta del usuario actual, donde se almacenan los archivos.
+// - raiz: ndice del nodo raz del rbol AVL.
 //
 // Proceso:
-// 1. Solicita al usuario una palabra en espaol para buscar en el rbol AVL.
-// 2. Si la palabra existe, permite seleccionar un idioma para mostrar la traduccin.
-// 3. Reproduce la traduccin en forma de audio utilizando PowerShell.
-// 4. Guarda la palabra buscada en dos archivos:
-//    - `conversion.umg`: La palabra encriptada y procesada con XOR.
-//    - `informacion_original.umg`: La palabra original.
+// 1. Coloca un cursor en la primera palabra de la pgina actual con `posicionarCursor`.
+// 2. Muestra hasta PALABRAS_POR_PAGINA palabras con sus traducciones avanzando el cursor.
+// 3. Permite ir a la pgina siguiente, a la anterior o saltar a una palabra (usando `posicionDe`).
 //
 // Notas:
-// - Si la palabra no se encuentra en el rbol, muestra un mensaje de error.
-// - Utiliza las funciones `encriptarPalabra` y `aplicarXOR` para proteger los datos antes de guardarlos.
-// - La reproduccin de audio requiere que PowerShell est disponible en el sistema.
-
-void mostrarTraduccion(Nodo* raiz, const string& rutaUsuario) {
-    string palabraBuscada;
-    int idioma;
-
-    // Solicitar al usuario la palabra en espaol que desea buscar.
-    cout << "\nIngrese una palabra en espanol: ";
-    cin >> palabraBuscada;
-
-    // Buscar la palabra en el rbol AVL.
-    Nodo* nodo = buscar(raiz, palabraBuscada);
-    if (!nodo) {
-        cout << "Palabra no encontrada.\n";
-        return;
-    }
-
-    // Solicitar al usuario que seleccione un idioma para la traduccin.
-    cout << "Seleccione el idioma:\n";
-    cout << "1. Ingles\n2. Aleman\n3. Frances\n4. Italiano\n";
-    cout << "Opcion: ";
-    cin >> idioma;
-
-    string traduccion;
-    cout << "Traduccion: ";
-    switch (idioma) {
-    case 1:
-        traduccion = nodo->palabra.ingles;
-        cout << traduccion;
-        break;
-    case 2:
-        traduccion = nodo->palabra.aleman;
-        cout << traduccion;
-        break;
-    case 3:
-        traduccion = nodo->palabra.frances;
-        cout << traduccion;
-        break;
-    case 4:
-        traduccion = nodo->palabra.italiano;
-        cout << traduccion;
-        break;
-    default:
-        cout << "Opcion no valida.";
+// - Cada pgina cuesta O(log n + PALABRAS_POR_PAGINA); el diccionario nunca se copia completo.
+// - Muestra los cuatro idiomas, por lo que antes carga las traducciones que falten (`cargarColumnas`).
+
+void explorarDiccionario(uint32_t raiz) {
+    const size_t PALABRAS_POR_PAGINA = 20;
+    size_t total = tamano(raiz);
+    if (total == 0) {
+        cout << "El diccionario esta vacio.\n";
         return;
     }
-    cout << endl;
-
-    // Reproducir la traduccin en forma de audio utilizando PowerShell.
-    string comando = "powershell -Command \"Add-Type -AssemblyName System.Speech; "
-        "$speak = New-Object System.Speech.Synthesis.SpeechSynthesizer; "
-        "$speak.Speak('" + traduccion + "');\"";
-    system(comando.c_str());
-
-    // Encriptar la palabra buscada.
-    string palabraEncriptada = encriptarPalabra(palabraBuscada);
+    cargarColumnas();
 
-    // Leer la llave desde el archivo del usuario.
-    ifstream llaveFile(rutaUsuario + "\\llave.umg");
-    string llave;
-    getline(llaveFile, llave);
-    llaveFile.close();
+    CursorPalabras cursor;
+    size_t inicio = 0;
+    char opcion;
 
-    // Aplicar XOR sobre la palabra encriptada con la llave.
-    string palabraFinal = aplicarXOR(palabraEncriptada, llave);
+    do {
+        // Mostrar la pgina que comienza en `inicio`.
+        posicionarCursor(cursor, raiz, inicio);
+        cout << "\n--- DICCIONARIO (palabras " << inicio + 1 << " a " << min(inicio + PALABRAS_POR_PAGINA, total)
+            << " de " << total << ") ---\n";
+        for (size_t i = 0; i < PALABRAS_POR_PAGINA; ++i) {
+            uint32_t nodo = siguienteNodo(cursor);
+            if (!nodo) break;
+
+            const PalabraInterna& palabra = palabraDe(nodo);
+            cout << cadenaDe(palabra.espanol) << ": " << cadenaDe(palabra.ingles) << ", "
+                << cadenaDe(palabra.aleman) << ", " << cadenaDe(palabra.frances) << ", "
+                << cadenaDe(palabra.italiano) << endl;
+        }
 
-    // Guardar la palabra encriptada con XOR en el archivo `conversion.umg`.
-    ofstream archivoConversion(rutaUsuario + "\\conversion.umg", ios::app);
-    if (archivoConversion.is_open()) {
-        archivoConversion << palabraFinal << endl;
-        archivoConversion.close();
-    }
-    else {
-        cerr << "Error al abrir conversion.umg para escritura.\n";
-    }
+        cout << "s. Siguiente  a. Anterior  i. Ir a una palabra  q. Volver\n";
+        cout << "Opcion: ";
+        cin >> opcion;
 
-    // Guardar la palabra original en el archivo `informacion_original.umg`.
-    ofstream archivoOriginal(rutaUsuario + "\\informacion_original.umg", ios::app);
-    if (archivoOriginal.is_open()) {
-        archivoOriginal << palabraBuscada << endl;
-        archivoOriginal.close();
-    }
-    else {
-        cerr << "Error al abrir informacion_original.umg para escritura.\n";
-    }
+        if (opcion == 's' && inicio + PALABRAS_POR_PAGINA < total) {
+            inicio += PALABRAS_POR_PAGINA;
+        }
+        else if (opcion == 'a') {
+            inicio = inicio > PALABRAS_POR_PAGINA ? inicio - PALABRAS_POR_PAGINA : 0;
+        }
+        else if (opcion == 'i') {
+            string palabra;
+            cout << "Ingrese la palabra (o el inicio de la palabra) en espanol: ";
+            cin >> palabra;
+            inicio = min(posicionDe(raiz, palabra), total - 1); // Si es mayor que todas, mostrar la ltima.
+        }
+    } while (opcion != 'q');
 }
 
 
@@ -1607,11 +10763,15 @@ void mostrarHistorial(const string& rutaUsuario) {
 
 
 
-// Funcin para mostrar el ranking de palabras ms buscadas por el usuario.
+// Funcin para leer el ranking de palabras ms buscadas por el usuario.
 // Las palabras se desencriptan, se cuentan sus frecuencias y se ordenan en orden descendente.
 //
 // Parmetros:
 // - rutaUsuario: Ruta de la carpeta del usuario actual, donde se encuentra el archivo `conversion.umg`.
+// - ranking: Vector donde se guardan los pares (palabra, veces), de la ms buscada a la menos buscada.
+//
+// Retorno:
+// - true si el archivo se pudo abrir, false en caso contrario.
 //
 // Proceso:
 // 1. Abre el archivo `conversion.umg` que contiene las palabras encriptadas con XOR.
@@ -1622,19 +10782,16 @@ void mostrarHistorial(const string& rutaUsuario) {
 //    - Incrementa el contador de frecuencia de la palabra en un mapa.
 // 4. Convierte el mapa de frecuencias en un vector de pares clave-valor.
 // 5. Ordena el vector en orden descendente segn la frecuencia de las palabras.
-// 6. Muestra el ranking de palabras ms buscadas en la consola.
 //
 // Notas:
-// - Si el archivo `conversion.umg` no existe o no se puede abrir, muestra un mensaje de error.
 // - Utiliza las funciones `deshacerXOR` y `desencriptarPalabra` para procesar las palabras.
 // - La llave debe coincidir con la utilizada para encriptar las palabras, de lo contrario, el resultado ser incorrecto.
 
-void mostrarRanking(const string& rutaUsuario) {
+bool leerRanking(const string& rutaUsuario, vector<pair<string, int>>& ranking) {
     string rutaArchivo = rutaUsuario + "\\conversion.umg";
     ifstream archivo(rutaArchivo);
     if (!archivo.is_open()) {
-        cerr << "Error al abrir conversion.umg para lectura.\n";
-        return;
+        return false;
     }
 
     // Leer la llave desde el archivo del usuario.
@@ -1660,12 +10817,35 @@ void mostrarRanking(const string& rutaUsuario) {
     archivo.close();
 
     // Convertir el mapa a un vector de pares para ordenar.
-    vector<pair<string, int>> ranking(frecuenciaPalabras.begin(), frecuenciaPalabras.end());
+    ranking.assign(frecuenciaPalabras.begin(), frecuenciaPalabras.end());
 
     // Ordenar el vector por frecuencia en orden descendente.
     sort(ranking.begin(), ranking.end(), [](const pair<string, int>& a, const pair<string, int>& b) {
         return a.second > b.second;
         });
+    return true;
+}
+
+
+
+// Funcin para mostrar el ranking de palabras ms buscadas por el usuario.
+//
+// Parmetros:
+// - rutaUsuario: Ruta de la carpeta del usuario actual, donde se encuentra el archivo `conversion.umg`.
+//
+// Proceso:
+// 1. Lee el ranking con `leerRanking`.
+// 2. Muestra el ranking de palabras ms buscadas en la consola.
+//
+// Notas:
+// - Si el archivo `conversion.umg` no existe o no se puede abrir, muestra un mensaje de error.
+
+void mostrarRanking(const string& rutaUsuario) {
+    vector<pair<string, int>> ranking;
+    if (!leerRanking(rutaUsuario, ranking)) {
+        cerr << "Error al abrir conversion.umg para lectura.\n";
+        return;
+    }
 
     // Mostrar el ranking de palabras ms buscadas.
     cout << "\n--- RANKING DE PALABRAS MS BUSCADAS ---\n";
@@ -1676,36 +10856,112 @@ void mostrarRanking(const string& rutaUsuario) {
 
 
 
-// Funcin para guardar el contenido del rbol AVL en un archivo utilizando un recorrido inorden.
-// El recorrido inorden asegura que las palabras se guarden en orden alfabtico.
+// Funcin para preparar la cach de bsquedas con las palabras ms buscadas por el usuario.
 //
 // Parmetros:
-// - nodo: Puntero al nodo actual del rbol AVL que se est procesando.
-// - archivoOut: Flujo de salida hacia el archivo donde se guardarn las palabras.
+// - rutaUsuario: Ruta de la carpeta del usuario actual.
 //
-// Proceso:
-// 1. Si el nodo actual es nulo, retorna (caso base de la recursin).
-// 2. Llama recursivamente a la funcin para procesar el subrbol izquierdo.
-// 3. Escribe la palabra y sus traducciones en el archivo en formato CSV (separadas por comas).
-// 4. Llama recursivamente a la funcin para procesar el subrbol derecho.
+// Notas:
+// - Solo anota las palabras (hasta CacheBusquedas::CAPACIDAD) en `porCalentar`; se buscan con
+//   `calentarCache` cuando el ndice congelado est completo.
+// - Si el usuario todava no tiene historial, no hace nada.
+
+void prepararCacheUsuario(const string& rutaUsuario) {
+    vector<pair<string, int>> ranking;
+    if (!leerRanking(rutaUsuario, ranking)) return;
+
+    cacheBusquedas.porCalentar.clear();
+    for (const auto& par : ranking) {
+        if (cacheBusquedas.porCalentar.size() >= CacheBusquedas::CAPACIDAD) break;
+        cacheBusquedas.porCalentar.push_back(par.first);
+    }
+}
+
+
+
+// Funcin para reconstruir el ndice ponderado cuando cambi el diccionario o el historial.
+//
+// Parmetros:
+// - raiz: ndice del nodo raz del rbol AVL.
+// - rutaUsuario: Ruta de la carpeta del usuario actual.
 //
 // Notas:
-// - El archivo debe estar abierto antes de llamar a esta funcin.
-// - Cada lnea del archivo contiene una palabra en espaol y sus traducciones en otros idiomas.
+// - Se llama desde el men cuando el rbol est completo. Solo lee el historial y reconstruye el ndice
+//   si est desactualizado (se agreg o elimin una palabra) o si el usuario hizo al menos
+//   IndicePonderado::BUSQUEDAS_POR_RECONSTRUCCION bsquedas desde la ltima construccin.
 
-void guardarEnArchivo(Nodo* nodo, ofstream& archivoOut) {
-    if (!nodo) return; // Caso base: si el nodo es nulo, no hace nada.
+void actualizarIndicePonderado(uint32_t raiz, const string& rutaUsuario) {
+    IndicePonderado& indice = indicePonderado;
+    if (indice.vigente && indice.busquedas < IndicePonderado::BUSQUEDAS_POR_RECONSTRUCCION) return;
+
+    vector<pair<string, int>> ranking;
+    leerRanking(rutaUsuario, ranking);
+    construirIndicePonderado(raiz, ranking, indice);
+}
 
-    // Recorrer el subrbol izquierdo.
-    guardarEnArchivo(nodo->izquierda, archivoOut);
 
-    // Escribir la palabra y sus traducciones en el archivo.
-    archivoOut << nodo->palabra.espanol << "," << nodo->palabra.ingles << ","
-        << nodo->palabra.aleman << "," << nodo->palabra.frances << ","
-        << nodo->palabra.italiano << endl;
 
-    // Recorrer el subrbol derecho.
-    guardarEnArchivo(nodo->derecha, archivoOut);
+// Funcin para mostrar las mediciones de rendimiento disponibles y ejecutar la elegida.
+//
+// Parmetros:
+// - raiz: ndice del nodo raz del rbol; la medicin concurrente puede cambiarlo por la versin
+//   final del rbol (con las mismas palabras).
+// - rutaUsuario: Ruta de la carpeta del usuario actual (su historial se usa en la opcin 6).
+//
+// Notas:
+// - Despus de llamarla, el ndice congelado debe reconstruirse con `congelarIndice`.
+
+void medirRendimiento(uint32_t& raiz, const string& rutaUsuario) {
+    int opcion;
+    cout << "\n--- MEDIR RENDIMIENTO ---\n";
+    cout << "1. Lectura concurrente (varios hilos lectores y un escritor)\n";
+    cout << "2. Busqueda por lotes comparada con la busqueda individual\n";
+    cout << "3. Lectura del archivo de palabras (MB/s)\n";
+    cout << "4. Traduccion de textos completos (MB/s)\n";
+    cout << "5. Estadisticas de la cache de busquedas\n";
+    cout << "6. Indice ponderado por el historial (comparaciones por busqueda)\n";
+    cout << "7. Filtro de Bloom (falsos positivos y busquedas fallidas)\n";
+    cout << "8. Validar el arbol AVL y mostrar sus contadores\n";
+    cout << "9. Comprimir las traducciones en memoria (Huffman por idioma, experimental)\n";
+    cout << "10. Trie compacto comparado con el arbol AVL (memoria y busquedas)\n";
+    cout << "Seleccione una opcion: ";
+    cin >> opcion;
+
+    if (opcion == 1) {
+        medirLecturaConcurrente(raiz);
+    }
+    else if (opcion == 2) {
+        medirBusquedaPorLotes(raiz);
+    }
+    else if (opcion == 3) {
+        medirLecturaArchivo();
+    }
+    else if (opcion == 4) {
+        medirTraduccionTexto(raiz);
+    }
+    else if (opcion == 5) {
+        mostrarEstadisticasCache();
+    }
+    else if (opcion == 6) {
+        vector<pair<string, int>> ranking;
+        leerRanking(rutaUsuario, ranking);
+        medirIndicePonderado(raiz, ranking);
+    }
+    else if (opcion == 7) {
+        uint32_t bitsPorClave;
+        cout << "Bits por palabra del filtro (actual: " << filtroBloom.bitsPorClave << "): ";
+        cin >> bitsPorClave;
+        medirFiltroBloom(raiz, bitsPorClave);
+    }
+    else if (opcion == 8) {
+        mostrarValidacionArbol(raiz);
+    }
+    else if (opcion == 9) {
+        comprimirTraducciones(raiz);
+    }
+    else if (opcion == 10) {
+        medirTrieCompacto(raiz);
+    }
 }
 
 
@@ -1870,18 +11126,47 @@ void registrarUsuario() {
 // Funcin principal del programa.
 // Controla el flujo general: descompresin inicial, autenticacin, men principal y compresin final.
 //
+// Parmetros:
+// - argc, argv: Argumentos de la lnea de comandos. `Traductor.exe --benchmark [archivo.csv] [mximo] [motor]`
+//   ejecuta solo el benchmark (ver `ejecutarBenchmark`) y termina, sin iniciar sesin. El motor puede ser
+//   "avl", "hash" o "todos" (el valor por omisin).
+//
 // Proceso general:
 // 1. Si existe un archivo comprimido (.huff), descomprime la carpeta de trabajo al iniciar.
 // 2. Solicita al usuario iniciar sesin o registrarse hasta que la autenticacin sea exitosa.
-// 3. Carga las palabras al rbol AVL desde el archivo principal de palabras.
-// 4. Muestra un men con opciones para buscar, agregar, eliminar palabras, ver historial y ranking.
-// 5. Al salir, comprime el contenido de la carpeta y elimina los archivos originales para mantener solo el respaldo comprimido.
+// 3. Abre el diccionario binario (`diccionario.umg`) para buscar de inmediato y construye el rbol AVL en
+//    segundo plano; si el binario no existe o no es vlido, carga las palabras desde el archivo principal
+//    de palabras y su registro de cambios. Las traducciones de cada idioma se cargan la primera vez que se usan.
+// 4. Muestra un men con opciones para buscar (desde el espaol o desde otro idioma), agregar,
+//    eliminar palabras, ver historial y ranking, autocompletar, explorar el diccionario por pginas,
+//    medir el rendimiento del diccionario, traducir textos completos y combinar el diccionario con una lista
+//    de palabras (unin, diferencia o interseccin).
+// 5. Al salir, espera la compactacin del registro de cambios en curso, guarda el orden de los
+//    ndices inversos (`indices.umg`) y, si qued desactualizado, el diccionario binario con una columna
+//    por idioma; comprime el contenido de la carpeta y elimina los archivos originales para mantener
+//    solo el respaldo comprimido.
+//
+// Notas:
+// - El diccionario binario y sus columnas se guardan en `C:\\traductorbinario`, que no se comprime: al
+//   iniciar se mapean directamente, sin esperar a que se descomprima una copia de ellos. Los de versiones
+//   anteriores, guardados dentro de `C:\\traductor`, se eliminan al salir para que no se sigan comprimiendo.
+// 6. Libera la memoria del rbol AVL devolviendo los bloques del pool de nodos.
+
+int main(int argc, char* argv[]) {
+    // 0. Modo benchmark: medir las operaciones del diccionario sobre diccionarios sintticos y salir
+    if (argc > 1 && string(argv[1]) == "--benchmark") {
+        string rutaResultados = argc > 2 ? argv[2] : "benchmark.csv";
+        size_t maximoPalabras = argc > 3 ? static_cast<size_t>(strtoull(argv[3], nullptr, 10)) : 10000000;
+        string motores = argc > 4 ? argv[4] : "todos";
+        ejecutarBenchmark(rutaResultados, maximoPalabras, motores);
+        return 0;
+    }
 
-int main() {
     // Rutas principales para la compresin y descompresin
     const string rutaCarpetaHuffman = "C:\\traductorhuffman";
     const string archivoHuff = rutaCarpetaHuffman + "\\traductor.huff";
     const string rutaCarpeta = "C:\\traductor";
+    const string rutaDiccionarioBinario = "C:\\traductorbinario\\diccionario.umg";
 
     // 1. Descomprimir al inicio si existe el archivo comprimido
     if (fs::exists(archivoHuff)) {
@@ -1912,11 +11197,22 @@ int main() {
         }
     }
 
-    // 3. Definir la ruta de la carpeta del usuario autenticado
+    // 3. Definir la ruta de la carpeta del usuario autenticado y anotar sus palabras ms buscadas para la cach
     string rutaUsuario = "C:\\traductor\\usuarios\\" + usuarioActual;
-
-    // 4. Cargar las palabras al rbol AVL desde el archivo principal
-    Nodo* raiz = cargarPalabras();
+    prepararCacheUsuario(rutaUsuario);
+
+    // 4. Abrir el diccionario binario si est vigente: las bsquedas comienzan enseguida sobre el archivo
+    //    mapeado mientras el rbol AVL se construye en segundo plano. Si no, cargar las palabras desde el texto.
+    uint32_t raiz = 0;
+    IndiceCongelado indice;
+    DiccionarioBinario binario;
+    if (abrirDiccionarioBinario(rutaDiccionarioBinario, binario)) {
+        iniciarCargaBinaria(binario, raiz, indice);
+    }
+    else {
+        raiz = cargarPalabras();
+        congelarIndice(raiz, indice); // Congelar el rbol en un ndice contiguo para las bsquedas
+    }
 
     int opcion;
     // 5. Bucle principal del men de usuario
@@ -1927,33 +11223,53 @@ int main() {
         cout << "3. Eliminar una palabra\n";
         cout << "4. Mostrar historial de palabras buscadas\n";
         cout << "5. Mostrar ranking de palabras ms buscadas\n";
-        cout << "6. Salir\n";
+        cout << "6. Buscar una palabra desde otro idioma\n";
+        cout << "7. Buscar palabras por su inicio (autocompletar)\n";
+        cout << "8. Explorar el diccionario en orden alfabetico\n";
+        cout << "9. Medir el rendimiento del diccionario\n";
+        cout << "10. Traducir un texto completo\n";
+        cout << "11. Combinar el diccionario con una lista de palabras\n";
+        cout << "12. Salir\n";
         cout << "Seleccione una opcion: ";
         cin >> opcion;
 
+        // Las opciones que usan el rbol AVL (y la salida) esperan a que termine de cargarse
+        if (opcion != 1 && opcion != 4 && opcion != 5) {
+            esperarCargaBinaria(binario);
+        }
+
+        // Con el ndice completo: cargar la cach con las palabras frecuentes del usuario (solo la primera vez),
+        // reconstruir el ndice ponderado si cambi el diccionario o el historial y, si falta memoria,
+        // liberar los idiomas que no se usan hace tiempo
+        if (!binario.datos) {
+            calentarCache(indice);
+            actualizarIndicePonderado(raiz, rutaUsuario);
+            liberarColumnasFrias();
+        }
+
         // Ejecutar la opcin seleccionada
         if (opcion == 1) {
-            mostrarTraduccion(raiz, rutaUsuario); // Buscar y traducir una palabra
+            mostrarTraduccion(indice, binario, rutaUsuario); // Buscar y traducir una palabra
         }
         else if (opcion == 2) {
-            raiz = agregarPalabra(raiz, "C:\\traductor\\palabras.umg"); // Agregar una nueva palabra
+            raiz = agregarPalabra(raiz); // Agregar una nueva palabra
+            congelarIndice(raiz, indice); // Reconstruir el ndice de bsqueda
         }
         else if (opcion == 3) {
             string palabra;
             cout << "Ingrese la palabra en espanol que desea eliminar: ";
             cin >> palabra;
 
-            raiz = eliminarPalabra(raiz, palabra); // Eliminar una palabra del rbol
-
-            // Reescribir el archivo de palabras tras la eliminacin
-            ofstream archivoOut("C:\\traductor\\palabras.umg");
-            if (!archivoOut.is_open()) {
-                cerr << "Error al abrir el archivo para reescribir.\n";
+            if (!buscar(raiz, palabra)) {
+                cout << "La palabra no existe en el diccionario.\n";
             }
             else {
-                guardarEnArchivo(raiz, archivoOut);
-                archivoOut.close();
-                cout << "Palabra eliminada y archivo actualizado.\n";
+                raiz = eliminarPalabra(raiz, palabra); // Eliminar una palabra del rbol
+                congelarIndice(raiz, indice); // Reconstruir el ndice de bsqueda
+
+                // Anotar la eliminacin en el registro de cambios
+                registrarEliminada(palabra, tamano(raiz));
+                cout << "Palabra eliminada y cambio registrado.\n";
             }
         }
         else if (opcion == 4) {
@@ -1962,15 +11278,52 @@ int main() {
         else if (opcion == 5) {
             mostrarRanking(rutaUsuario); // Mostrar ranking de palabras ms buscadas
         }
-        // Si la opcin es 6, el bucle termina y el programa sale
+        else if (opcion == 6) {
+            mostrarTraduccionInversa(raiz, rutaUsuario); // Buscar desde ingls, alemn, francs o italiano
+        }
+        else if (opcion == 7) {
+            mostrarAutocompletado(raiz); // Mostrar las palabras que comienzan con un texto
+        }
+        else if (opcion == 8) {
+            explorarDiccionario(raiz); // Recorrer el diccionario por pginas
+        }
+        else if (opcion == 9) {
+            medirRendimiento(raiz, rutaUsuario); // Medir la lectura concurrente o la bsqueda por lotes
+            congelarIndice(raiz, indice); // Reconstruir el ndice con la versin final del rbol
+        }
+        else if (opcion == 10) {
+            mostrarTraduccionTexto(raiz); // Traducir una oracin o un documento
+        }
+        else if (opcion == 11) {
+            raiz = combinarConLista(raiz); // Unin, diferencia o interseccin con una lista de palabras
+            congelarIndice(raiz, indice); // Reconstruir el ndice de bsqueda
+        }
+        // Si la opcin es 12, el bucle termina y el programa sale
 
-    } while (opcion != 6);
+    } while (opcion != 12);
 
-    // 6. Al salir, comprimir la carpeta y limpiar archivos originales
+    // 6. Al salir, terminar la compactacin en curso, guardar el orden de los ndices inversos y, si el
+    //    diccionario cambi, el diccionario binario con sus columnas; comprimir la carpeta y limpiar archivos originales
     cout << "Saliendo del programa...\n";
+    esperarCompactacion();
+    guardarIndicesInversos(raiz, "C:\\traductor\\indices.umg");
+    if (!diccionarioBinarioVigente(rutaDiccionarioBinario, tamano(raiz))) {
+        cargarColumnas(); // Todas las traducciones deben estar en memoria para guardarlas
+        cerrarColumnas();
+        guardarDiccionarioBinario(raiz, rutaDiccionarioBinario);
+    }
+    cerrarColumnas();
+    for (const char* anterior : { "diccionario.umg", "columna_ingles.umg", "columna_aleman.umg", "columna_frances.umg", "columna_italiano.umg" }) {
+        error_code error;
+        fs::remove(rutaCarpeta + "\\" + anterior, error); // Copias de versiones anteriores dentro de la carpeta comprimida
+    }
     comprimirCarpetaHuffman(rutaCarpeta, archivoHuff);
     eliminarCarpetaContenido("C:\\traductor");
 
+    // 7. Liberar de una sola vez la memoria de todos los nodos del rbol
+    liberarPoolNodos();
+    raiz = 0;
+
     return 0;
 }
 